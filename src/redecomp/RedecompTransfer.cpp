@@ -44,6 +44,14 @@ void RedecompTransfer::TransferToParallel(
   gf_transfer_->TransferToParallel(src, dst);
 }
 
+void RedecompTransfer::AccumulateToParallel(
+  const mfem::GridFunction& src,
+  mfem::ParGridFunction& dst
+) const
+{
+  gf_transfer_->AccumulateToParallel(src, dst);
+}
+
 void RedecompTransfer::TransferToSerial(
   const mfem::QuadratureFunction& src, 
   mfem::QuadratureFunction& dst
@@ -5,6 +5,8 @@
 
 #include "MatrixTransfer.hpp"
 
+#include <algorithm>
+
 #include "axom/slic.hpp"
 
 #include "redecomp/RedecompMesh.hpp"
@@ -47,9 +49,40 @@ std::unique_ptr<mfem::HypreParMatrix> MatrixTransfer::TransferToParallel(
   bool parallel_assemble
 ) const
 {
-  auto J_sparse = TransferToParallelSparse(test_elem_idx, trial_elem_idx, src_elem_mat);
-  J_sparse.Finalize();
-  return ConvertToHypreParMatrix(J_sparse, parallel_assemble);
+  auto& pattern = getTransferPattern(test_elem_idx, trial_elem_idx);
+  fillTransferPattern(pattern, getElemMatPointers({&src_elem_mat}));
+  if (!pattern.parent_J_hypre_)
+  {
+    buildHyprePattern(pattern);
+  }
+
+  // fill values of the cached HypreParMatrix in place
+  pattern.parent_J_hypre_->HostReadWrite();
+  hypre_ParCSRMatrix* J_hypre = *pattern.parent_J_hypre_;
+  auto csr_data = pattern.parent_J_.GetData();
+  auto diag_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(J_hypre));
+  for (int k{0}; k < pattern.hypre_diag_csr_idx_.size(); ++k)
+  {
+    diag_data[k] = csr_data[pattern.hypre_diag_csr_idx_[k]];
+  }
+  auto offd_data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(J_hypre));
+  for (int k{0}; k < pattern.hypre_offd_csr_idx_.size(); ++k)
+  {
+    offd_data[k] = csr_data[pattern.hypre_offd_csr_idx_[k]];
+  }
+
+  if (!parallel_assemble)
+  {
+    return std::make_unique<mfem::HypreParMatrix>(*pattern.parent_J_hypre_);
+  }
+  else
+  {
+    return std::unique_ptr<mfem::HypreParMatrix>(mfem::RAP(
+      parent_test_fes_.Dof_TrueDof_Matrix(),
+      pattern.parent_J_hypre_.get(),
+      parent_trial_fes_.Dof_TrueDof_Matrix()
+    ));
+  }
 }
 
 mfem::SparseMatrix MatrixTransfer::TransferToParallelSparse(
@@ -58,43 +91,119 @@ mfem::SparseMatrix MatrixTransfer::TransferToParallelSparse(
   const axom::Array<mfem::DenseMatrix>& src_elem_mat
 ) const
 {
-  auto parentJ = mfem::SparseMatrix(
-    parent_test_fes_.GetVSize(), 
-    parent_trial_fes_.GlobalVSize()
+  return TransferToParallelSparse(test_elem_idx, trial_elem_idx, {&src_elem_mat});
+}
+
+mfem::SparseMatrix MatrixTransfer::TransferToParallelSparse(
+  const axom::Array<int>& test_elem_idx,
+  const axom::Array<int>& trial_elem_idx, 
+  const std::vector<const axom::Array<mfem::DenseMatrix>*>& src_elem_mat_blocks
+) const
+{
+  auto& pattern = getTransferPattern(test_elem_idx, trial_elem_idx);
+  fillTransferPattern(pattern, getElemMatPointers(src_elem_mat_blocks));
+  return mfem::SparseMatrix(pattern.parent_J_);
+}
+
+void MatrixTransfer::ClearTransferPatterns() const
+{
+  patterns_.clear();
+}
+
+std::unique_ptr<mfem::HypreParMatrix> MatrixTransfer::ConvertToHypreParMatrix(
+  mfem::SparseMatrix& sparse,
+  bool parallel_assemble
+) const
+{
+  SLIC_ERROR_IF(sparse.Height() != parent_test_fes_.GetVSize(), 
+    "Height of sparse must match number of test ParFiniteElementSpace L-dofs.");
+  SLIC_ERROR_IF(sparse.Width() != parent_trial_fes_.GlobalVSize(), 
+    "Width of sparse must match number of trial ParFiniteElementSpace global dofs.");
+
+  auto J_full = std::make_unique<mfem::HypreParMatrix>(
+    getMPIUtility().MPIComm(), parent_test_fes_.GetVSize(), 
+    parent_test_fes_.GlobalVSize(), parent_trial_fes_.GlobalVSize(),
+    sparse.GetI(), sparse.GetJ(), sparse.GetData(),
+    parent_test_fes_.GetDofOffsets(), parent_trial_fes_.GetDofOffsets()
   );
+  if (!parallel_assemble)
+  {
+    return J_full;
+  }
+  else
+  {
+    auto J_true = std::unique_ptr<mfem::HypreParMatrix>(mfem::RAP(
+      parent_test_fes_.Dof_TrueDof_Matrix(),
+      J_full.get(),
+      parent_trial_fes_.Dof_TrueDof_Matrix()
+    ));
+    return J_true;
+  }
+}
 
+MatrixTransfer::TransferPattern& MatrixTransfer::getTransferPattern(
+  const axom::Array<int>& test_elem_idx,
+  const axom::Array<int>& trial_elem_idx
+) const
+{
   // verify inputs
-  SLIC_ERROR_IF(test_elem_idx.size() != trial_elem_idx.size() 
-    || test_elem_idx.size() != src_elem_mat.size(),
-    "Element index arrays and element Jacobian contribution array must be the same size.");
-  for (int i{0}; i < src_elem_mat.size(); ++i)
+  SLIC_ERROR_IF(test_elem_idx.size() != trial_elem_idx.size(),
+    "Element index arrays must be the same size.");
+  for (int i{0}; i < test_elem_idx.size(); ++i)
   {
-    auto test_e = test_elem_idx[i];
-    auto trial_e = trial_elem_idx[i];
+    SLIC_ERROR_IF(test_elem_idx[i] < 0, "Invalid primary index value.");
+    SLIC_ERROR_IF(trial_elem_idx[i] < 0, "Invalid secondary index value.");
+  }
 
-    SLIC_ERROR_IF(test_e < 0, "Invalid primary index value.");
-    SLIC_ERROR_IF(trial_e < 0, "Invalid secondary index value.");
+  // find the newest cached pattern matching the element lists on this rank
+  auto match = -1;
+  for (int p{static_cast<int>(patterns_.size()) - 1}; p >= 0; --p)
+  {
+    const auto& pattern = *patterns_[static_cast<size_t>(p)];
+    if (pattern.test_elem_idx_.size() == test_elem_idx.size()
+      && pattern.trial_elem_idx_.size() == trial_elem_idx.size()
+      && std::equal(test_elem_idx.begin(), test_elem_idx.end(), pattern.test_elem_idx_.begin())
+      && std::equal(trial_elem_idx.begin(), trial_elem_idx.end(), pattern.trial_elem_idx_.begin()))
+    {
+      match = p;
+      break;
+    }
+  }
+  // the symbolic phase is collective, so the cached pattern can only be reused
+  // if it matches on every rank
+  auto min_match = getMPIUtility().AllreduceValue(match, MPI_MIN);
+  auto max_match = getMPIUtility().AllreduceValue(match, MPI_MAX);
+  if (min_match != -1 && min_match == max_match)
+  {
+    return *patterns_[static_cast<size_t>(match)];
+  }
 
-    auto n_test_elem_vdofs = 
-      redecomp_test_fes_.GetFE(test_e)->GetDof() * redecomp_test_fes_.GetVDim();
-    auto n_trial_elem_vdofs = 
-      redecomp_trial_fes_.GetFE(trial_e)->GetDof() * redecomp_trial_fes_.GetVDim();
-      
-    SLIC_ERROR_IF(src_elem_mat[i].Height() != n_test_elem_vdofs,
-      "The number of test DOFs does not match the size of the element DenseMatrix.");
-    SLIC_ERROR_IF(src_elem_mat[i].Width() != n_trial_elem_vdofs,
-      "The number of trial DOFs does not match the size of the element DenseMatrix.");
+  if (static_cast<int>(patterns_.size()) >= max_cached_patterns_)
+  {
+    patterns_.erase(patterns_.begin());
   }
+  patterns_.push_back(buildTransferPattern(test_elem_idx, trial_elem_idx));
+  return *patterns_.back();
+}
+
+std::unique_ptr<MatrixTransfer::TransferPattern> MatrixTransfer::buildTransferPattern(
+  const axom::Array<int>& test_elem_idx,
+  const axom::Array<int>& trial_elem_idx
+) const
+{
+  auto pattern = std::make_unique<TransferPattern>();
+  pattern->test_elem_idx_ = test_elem_idx;
+  pattern->trial_elem_idx_ = trial_elem_idx;
 
   auto test_redecomp = dynamic_cast<const RedecompMesh*>(redecomp_test_fes_.GetMesh());
   auto trial_redecomp = dynamic_cast<const RedecompMesh*>(redecomp_trial_fes_.GetMesh());
 
   // List of entries in src_elem_mat that belong on each parent test space rank.
   // This is needed so we know which rank to send entries in src_elem_mat to. 
-  auto send_array_ids = buildSendArrayIDs(test_elem_idx);
+  pattern->send_array_ids_ = buildSendArrayIDs(test_elem_idx);
   // Number of matrix entries to be sent to each parent test space rank.  This
   // is used to size the array of element matrix values to be sent to other ranks.
-  auto send_num_mat_entries = buildSendNumMatEntries(test_elem_idx, trial_elem_idx);
+  pattern->send_num_mat_entries_ = buildSendNumMatEntries(test_elem_idx, trial_elem_idx);
   // Number of test and trial vdofs received from test space redecomp ranks.
   // This is used to determine the beginning and end of each element matrix
   // received as a single array of values and the beginning and end of vdof indices
@@ -111,8 +220,131 @@ mfem::SparseMatrix MatrixTransfer::TransferToParallelSparse(
   // determines the offset for each trial element.
   auto recv_trial_elem_dofs = 
     buildRecvTrialElemDofs(*trial_redecomp, test_elem_idx, trial_elem_idx);
-  
-  // aggregate dense matrix values, send and assemble
+
+  // build the CSR pattern of the parent matrix
+  auto parent_J = mfem::SparseMatrix(
+    parent_test_fes_.GetVSize(), 
+    parent_trial_fes_.GlobalVSize()
+  );
+  const auto& test_p2r_elems = test_redecomp->getParentToRedecompElems();
+  auto n_ranks = getMPIUtility().NRanks();
+  for (int src{0}; src < n_ranks; ++src)
+  {
+    auto trial_dof_ct = 0;
+    for (int e{0}; e < recv_test_elem_offsets[src].size(); ++e)
+    {
+      auto test_elem_id = test_p2r_elems.first[src][recv_test_elem_offsets[src][e]];
+      auto test_elem_dofs = mfem::Array<int>();
+      parent_test_fes_.GetElementVDofs(test_elem_id, test_elem_dofs);
+      for (int j{0}; j < recv_mat_sizes[src](e, 1); ++j)
+      {
+        for (int i{0}; i < test_elem_dofs.Size(); ++i)
+        {
+          parent_J.Add(test_elem_dofs[i], recv_trial_elem_dofs[src][trial_dof_ct + j], 0.0);
+        }
+      }
+      trial_dof_ct += recv_mat_sizes[src](e, 1);
+    }
+  }
+  // keep zero entries: they are part of the pattern
+  parent_J.Finalize(0);
+  parent_J.SortColumnIndices();
+
+  // map each received value to its location in the CSR data array
+  pattern->recv_csr_idx_ = MPIArray<int>(&getMPIUtility());
+  auto I = parent_J.GetI();
+  auto J = parent_J.GetJ();
+  for (int src{0}; src < n_ranks; ++src)
+  {
+    auto& recv_csr_idx = pattern->recv_csr_idx_[src];
+    auto n_vals = 0;
+    for (int e{0}; e < recv_mat_sizes[src].shape()[0]; ++e)
+    {
+      n_vals += recv_mat_sizes[src](e, 0) * recv_mat_sizes[src](e, 1);
+    }
+    recv_csr_idx.resize(n_vals);
+    auto trial_dof_ct = 0;
+    auto dof_ct = 0;
+    for (int e{0}; e < recv_test_elem_offsets[src].size(); ++e)
+    {
+      auto test_elem_id = test_p2r_elems.first[src][recv_test_elem_offsets[src][e]];
+      auto test_elem_dofs = mfem::Array<int>();
+      parent_test_fes_.GetElementVDofs(test_elem_id, test_elem_dofs);
+      for (int j{0}; j < recv_mat_sizes[src](e, 1); ++j)
+      {
+        auto trial_dof = recv_trial_elem_dofs[src][trial_dof_ct + j];
+        for (int i{0}; i < test_elem_dofs.Size(); ++i)
+        {
+          auto row = test_elem_dofs[i];
+          auto col_it = std::lower_bound(&J[I[row]], &J[I[row+1]], trial_dof);
+          // received values are column major (from mfem::DenseMatrix)
+          recv_csr_idx[dof_ct + i + j*test_elem_dofs.Size()] = 
+            static_cast<int>(col_it - J);
+        }
+      }
+      trial_dof_ct += recv_mat_sizes[src](e, 1);
+      dof_ct += recv_mat_sizes[src](e, 0) * recv_mat_sizes[src](e, 1);
+    }
+  }
+  pattern->parent_J_.Swap(parent_J);
+
+  ++num_symbolic_setups_;
+
+  return pattern;
+}
+
+std::vector<const mfem::DenseMatrix*> MatrixTransfer::getElemMatPointers(
+  const std::vector<const axom::Array<mfem::DenseMatrix>*>& src_elem_mat_blocks
+)
+{
+  auto src_elem_mat = std::vector<const mfem::DenseMatrix*>();
+  auto n_elem_mat = 0;
+  for (auto block : src_elem_mat_blocks)
+  {
+    n_elem_mat += block->size();
+  }
+  src_elem_mat.reserve(static_cast<size_t>(n_elem_mat));
+  for (auto block : src_elem_mat_blocks)
+  {
+    for (const auto& elem_mat : *block)
+    {
+      src_elem_mat.push_back(&elem_mat);
+    }
+  }
+  return src_elem_mat;
+}
+
+void MatrixTransfer::fillTransferPattern(
+  TransferPattern& pattern,
+  const std::vector<const mfem::DenseMatrix*>& src_elem_mat
+) const
+{
+  // verify inputs
+  SLIC_ERROR_IF(pattern.test_elem_idx_.size() != static_cast<axom::IndexType>(src_elem_mat.size()),
+    "Element index arrays and element Jacobian contribution array must be the same size.");
+  for (int i{0}; i < pattern.test_elem_idx_.size(); ++i)
+  {
+    auto test_e = pattern.test_elem_idx_[i];
+    auto trial_e = pattern.trial_elem_idx_[i];
+
+    auto n_test_elem_vdofs = 
+      redecomp_test_fes_.GetFE(test_e)->GetDof() * redecomp_test_fes_.GetVDim();
+    auto n_trial_elem_vdofs = 
+      redecomp_trial_fes_.GetFE(trial_e)->GetDof() * redecomp_trial_fes_.GetVDim();
+      
+    SLIC_ERROR_IF(src_elem_mat[i]->Height() != n_test_elem_vdofs,
+      "The number of test DOFs does not match the size of the element DenseMatrix.");
+    SLIC_ERROR_IF(src_elem_mat[i]->Width() != n_trial_elem_vdofs,
+      "The number of trial DOFs does not match the size of the element DenseMatrix.");
+  }
+
+  pattern.parent_J_ = 0.0;
+  auto csr_data = pattern.parent_J_.GetData();
+  const auto& send_array_ids = pattern.send_array_ids_;
+  const auto& send_num_mat_entries = pattern.send_num_mat_entries_;
+  const auto& recv_csr_idx = pattern.recv_csr_idx_;
+
+  // aggregate dense matrix values, send and sum into the CSR data
   getMPIUtility().SendRecvEach(
     type<axom::Array<double>>(), 
     [&send_array_ids, &send_num_mat_entries, &src_elem_mat](axom::IndexType dst)
@@ -122,86 +354,57 @@ mfem::SparseMatrix MatrixTransfer::TransferToParallelSparse(
       for (auto src_array_idx : send_array_ids[dst])
       {
         send_vals.append(axom::ArrayView<double>(
-          src_elem_mat[src_array_idx].Data(),
-          src_elem_mat[src_array_idx].Width() * src_elem_mat[src_array_idx].Height()
+          src_elem_mat[src_array_idx]->Data(),
+          src_elem_mat[src_array_idx]->Width() * src_elem_mat[src_array_idx]->Height()
         ));
       }
 
       return send_vals;
     },
-    [this, test_redecomp, &parentJ, &recv_mat_sizes, &recv_trial_elem_dofs, &recv_test_elem_offsets](
-      axom::Array<double>&& send_vals,
-      axom::IndexType src
-    )
+    [csr_data, &recv_csr_idx](axom::Array<double>&& send_vals, axom::IndexType src)
     {
-      if (recv_trial_elem_dofs[src].empty())
+      for (int k{0}; k < send_vals.size(); ++k)
       {
-        return;
-      }
-      auto trial_dof_ct = 0;
-      auto dof_ct = 0;
-      // element loop
-      for (int e{0}; e < recv_test_elem_offsets[src].size(); ++e)
-      {
-        auto test_elem_id = test_redecomp->getParentToRedecompElems()
-          .first[src][recv_test_elem_offsets[src][e]];
-        auto test_elem_dofs = mfem::Array<int>();
-        parent_test_fes_.GetElementVDofs(test_elem_id, test_elem_dofs);
-        auto trial_elem_dofs = mfem::Array<int>(
-          &recv_trial_elem_dofs[src][trial_dof_ct],
-          recv_mat_sizes[src](e, 1)
-        );
-        // trial loop
-        for (int j{0}; j < trial_elem_dofs.Size(); ++j)
-        {
-          // test loop
-          for (int i{0}; i < test_elem_dofs.Size(); ++i)
-          {
-            parentJ.Add(
-              test_elem_dofs[i], 
-              trial_elem_dofs[j],
-              // send_vals comes from mfem::SparseMatrix (column major)
-              send_vals[dof_ct + i + j*test_elem_dofs.Size()]
-            );
-          }
-        }
-        trial_dof_ct += recv_mat_sizes[src](e, 1);
-        dof_ct += recv_mat_sizes[src](e, 0) * recv_mat_sizes[src](e, 1);
+        csr_data[recv_csr_idx[src][k]] += send_vals[k];
       }
     }
   );
-
-  return parentJ;
 }
 
-std::unique_ptr<mfem::HypreParMatrix> MatrixTransfer::ConvertToHypreParMatrix(
-  mfem::SparseMatrix& sparse,
-  bool parallel_assemble
-) const
+void MatrixTransfer::buildHyprePattern(TransferPattern& pattern) const
 {
-  SLIC_ERROR_IF(sparse.Height() != parent_test_fes_.GetVSize(), 
-    "Height of sparse must match number of test ParFiniteElementSpace L-dofs.");
-  SLIC_ERROR_IF(sparse.Width() != parent_trial_fes_.GlobalVSize(), 
-    "Width of sparse must match number of trial ParFiniteElementSpace global dofs.");
-
-  auto J_full = std::make_unique<mfem::HypreParMatrix>(
+  // The HypreParMatrix constructor splits the CSR matrix into diagonal and
+  // off-diagonal blocks and may reorder entries within a row. Tagging each
+  // entry with its (1-based) CSR index recovers the map from hypre entries to
+  // CSR entries.
+  auto& parent_J = pattern.parent_J_;
+  auto tags = mfem::Vector(parent_J.NumNonZeroElems());
+  for (int k{0}; k < tags.Size(); ++k)
+  {
+    tags[k] = static_cast<double>(k + 1);
+  }
+  pattern.parent_J_hypre_ = std::make_unique<mfem::HypreParMatrix>(
     getMPIUtility().MPIComm(), parent_test_fes_.GetVSize(), 
     parent_test_fes_.GlobalVSize(), parent_trial_fes_.GlobalVSize(),
-    sparse.GetI(), sparse.GetJ(), sparse.GetData(),
+    parent_J.GetI(), parent_J.GetJ(), tags.GetData(),
     parent_test_fes_.GetDofOffsets(), parent_trial_fes_.GetDofOffsets()
   );
-  if (!parallel_assemble)
+
+  pattern.parent_J_hypre_->HostRead();
+  hypre_ParCSRMatrix* J_hypre = *pattern.parent_J_hypre_;
+  auto diag = hypre_ParCSRMatrixDiag(J_hypre);
+  auto diag_data = hypre_CSRMatrixData(diag);
+  pattern.hypre_diag_csr_idx_.resize(hypre_CSRMatrixNumNonzeros(diag));
+  for (int k{0}; k < pattern.hypre_diag_csr_idx_.size(); ++k)
   {
-    return J_full;
+    pattern.hypre_diag_csr_idx_[k] = static_cast<int>(diag_data[k]) - 1;
   }
-  else
+  auto offd = hypre_ParCSRMatrixOffd(J_hypre);
+  auto offd_data = hypre_CSRMatrixData(offd);
+  pattern.hypre_offd_csr_idx_.resize(hypre_CSRMatrixNumNonzeros(offd));
+  for (int k{0}; k < pattern.hypre_offd_csr_idx_.size(); ++k)
   {
-    auto J_true = std::unique_ptr<mfem::HypreParMatrix>(mfem::RAP(
-      parent_test_fes_.Dof_TrueDof_Matrix(),
-      J_full.get(),
-      parent_trial_fes_.Dof_TrueDof_Matrix()
-    ));
-    return J_true;
+    pattern.hypre_offd_csr_idx_[k] = static_cast<int>(offd_data[k]) - 1;
   }
 }
 
@@ -6,6 +6,9 @@
 #ifndef SRC_REDECOMP_MATRIXTRANSFER_HPP_
 #define SRC_REDECOMP_MATRIXTRANSFER_HPP_
 
+#include <memory>
+#include <vector>
+
 #include "mfem.hpp"
 
 #include "redecomp/common/TypeDefs.hpp"
@@ -24,14 +27,21 @@ class RedecompMesh;
  * DenseMatrix contributions on mfem::FiniteElementSpaces on a RedecompMesh,
  * then returns a mfem::HypreParMatrix on the ldofs or tdofs of
  * mfem::ParFiniteElementSpaces on the parent mfem::ParMesh. Alternatively, a
- * two-stage transfer process is available. First, TransferToParallel() creates
- * an un-finalized mfem::SparseMatrix with ldofs on the rows and global ldofs on
- * the columns. This mfem::SparseMatrix is designed to be passed to a
+ * two-stage transfer process is available. First, TransferToParallelSparse()
+ * creates a finalized mfem::SparseMatrix with ldofs on the rows and global ldofs
+ * on the columns. This mfem::SparseMatrix is designed to be passed to a
  * mfem::HypreParMatrix constructor (done through the ConvertToHypreParMatrix()
  * method).  The two-stage process allows easier manipulation of matrix
- * contributions before the matrix is finalized.  Both square and rectangular
+ * contributions before the mfem::HypreParMatrix is created.  Both square and rectangular
  * matrices are supported, necessitating test and trial finite element spaces in
  * the constructor.
+ *
+ * Each transfer is split into a symbolic and a numeric phase.  The symbolic
+ * phase builds the communication metadata and the CSR (and, if requested,
+ * mfem::HypreParMatrix) pattern on the parent mesh.  It is cached, keyed on the
+ * test and trial element index lists, and is only redone when the lists change
+ * on any rank.  The numeric phase ships element matrix values and fills them in
+ * place in the cached pattern.
  */
 class MatrixTransfer
 {
@@ -78,11 +88,12 @@ public:
    * @param test_elem_idx List of element IDs on the redecomp test space
    * @param trial_elem_idx List of element IDs on the redecomp trial space
    * @param src List of element-level dense matrices from the redecomp mesh
-   * @return mfem::SparseMatrix on the parent mesh (ldofs on the rows, global
-   * ldofs on the columns) in linked-list format
+   * @return Finalized mfem::SparseMatrix on the parent mesh (ldofs on the rows,
+   * global ldofs on the columns)
    *
-   * @note Linked-list format is returned here to enable additional matrix
-   * contributions to be added before Finalize() is called on the SparseMatrix
+   * @note The returned matrix is a copy of the cached pattern, so it can be
+   * modified by the caller. Column indices are sorted in each row and entries
+   * with a zero value are kept in the pattern.
    */
   mfem::SparseMatrix TransferToParallelSparse(
     const axom::Array<int>& test_elem_idx,
@@ -90,6 +101,25 @@ public:
     const axom::Array<mfem::DenseMatrix>& src_elem_mat
   ) const;
 
+  /**
+   * @brief Transfers element RedecompMesh matrices stored in several arrays to
+   * parent mfem::ParMesh
+   *
+   * @param test_elem_idx List of element IDs on the redecomp test space
+   * @param trial_elem_idx List of element IDs on the redecomp trial space
+   * @param src_elem_mat_blocks Arrays of element-level dense matrices from the
+   * redecomp mesh.  The element index lists refer to the matrices of all arrays
+   * in order, so contributions held in separate arrays are transferred together
+   * without copying them into one array.
+   * @return Finalized mfem::SparseMatrix on the parent mesh (ldofs on the rows,
+   * global ldofs on the columns)
+   */
+  mfem::SparseMatrix TransferToParallelSparse(
+    const axom::Array<int>& test_elem_idx,
+    const axom::Array<int>& trial_elem_idx, 
+    const std::vector<const axom::Array<mfem::DenseMatrix>*>& src_elem_mat_blocks
+  ) const;
+
   /**
    * @brief Converts SparseMatrix from TransferToParallel to HypreParMatrix
    *
@@ -107,7 +137,135 @@ public:
     bool parallel_assemble = true
   ) const;
 
+  /**
+   * @brief Releases all cached transfer patterns
+   *
+   * @note The next transfer will redo the symbolic phase.
+   */
+  void ClearTransferPatterns() const;
+
+  /**
+   * @brief Returns the number of times the symbolic phase has been performed
+   *
+   * @return int 
+   */
+  int GetNumSymbolicSetups() const { return num_symbolic_setups_; }
+
 private:
+  /**
+   * @brief Cached symbolic transfer data for a given pair of element index lists
+   */
+  struct TransferPattern
+  {
+    /**
+     * @brief List of element IDs on the redecomp test space (key)
+     */
+    axom::Array<int> test_elem_idx_;
+
+    /**
+     * @brief List of element IDs on the redecomp trial space (key)
+     */
+    axom::Array<int> trial_elem_idx_;
+
+    /**
+     * @brief List of entries in the element matrix array that belong on each
+     * parent test space rank
+     */
+    MPIArray<int> send_array_ids_;
+
+    /**
+     * @brief Number of matrix entries to be sent to each parent test space rank
+     */
+    axom::Array<int> send_num_mat_entries_;
+
+    /**
+     * @brief Index into the CSR data array of parent_J_ of each matrix value
+     * received from each redecomp rank
+     */
+    MPIArray<int> recv_csr_idx_;
+
+    /**
+     * @brief Finalized matrix on the parent mesh (ldofs on the rows, global
+     * ldofs on the columns)
+     */
+    mfem::SparseMatrix parent_J_;
+
+    /**
+     * @brief mfem::HypreParMatrix with the pattern of parent_J_ (created on the
+     * first call of TransferToParallel())
+     */
+    std::unique_ptr<mfem::HypreParMatrix> parent_J_hypre_;
+
+    /**
+     * @brief Index into the CSR data array of parent_J_ of each entry in the
+     * diagonal block of parent_J_hypre_
+     */
+    axom::Array<int> hypre_diag_csr_idx_;
+
+    /**
+     * @brief Index into the CSR data array of parent_J_ of each entry in the
+     * off-diagonal block of parent_J_hypre_
+     */
+    axom::Array<int> hypre_offd_csr_idx_;
+  };
+
+  /**
+   * @brief Returns the cached pattern for the given element index lists,
+   * performing the symbolic phase if no rank has a matching cached pattern
+   *
+   * @param test_elem_idx List of element IDs on the redecomp test space
+   * @param trial_elem_idx List of element IDs on the redecomp trial space
+   * @return TransferPattern& 
+   *
+   * @note This method must be called on all ranks.
+   */
+  TransferPattern& getTransferPattern(
+    const axom::Array<int>& test_elem_idx,
+    const axom::Array<int>& trial_elem_idx
+  ) const;
+
+  /**
+   * @brief Performs the symbolic phase of the transfer
+   *
+   * @param test_elem_idx List of element IDs on the redecomp test space
+   * @param trial_elem_idx List of element IDs on the redecomp trial space
+   * @return std::unique_ptr<TransferPattern> 
+   */
+  std::unique_ptr<TransferPattern> buildTransferPattern(
+    const axom::Array<int>& test_elem_idx,
+    const axom::Array<int>& trial_elem_idx
+  ) const;
+
+  /**
+   * @brief Performs the numeric phase of the transfer, filling the values of
+   * pattern.parent_J_ in place
+   *
+   * @param pattern Cached pattern for the element index lists of src_elem_mat
+   * @param src_elem_mat Pointers to the element-level dense matrices from the
+   * redecomp mesh
+   */
+  void fillTransferPattern(
+    TransferPattern& pattern,
+    const std::vector<const mfem::DenseMatrix*>& src_elem_mat
+  ) const;
+
+  /**
+   * @brief Returns pointers to the element matrices of a list of arrays, in order
+   *
+   * @param src_elem_mat_blocks Arrays of element-level dense matrices
+   * @return std::vector<const mfem::DenseMatrix*> 
+   */
+  static std::vector<const mfem::DenseMatrix*> getElemMatPointers(
+    const std::vector<const axom::Array<mfem::DenseMatrix>*>& src_elem_mat_blocks
+  );
+
+  /**
+   * @brief Creates the mfem::HypreParMatrix pattern of pattern.parent_J_ and
+   * the map of its entries to the CSR data of pattern.parent_J_
+   *
+   * @param pattern Cached pattern with a finalized parent_J_
+   */
+  void buildHyprePattern(TransferPattern& pattern) const;
   /**
    * @brief Returns a map of the corresponding parent rank for a given redecomp index
    * 
@@ -222,6 +380,24 @@ private:
    */
   axom::Array<int> trial_r2p_elem_rank_;
 
+  /**
+   * @brief Maximum number of transfer patterns cached at a time
+   */
+  static constexpr int max_cached_patterns_ = 4;
+
+  /**
+   * @brief Cached transfer patterns, ordered from oldest to newest
+   *
+   * @note Patterns are created and evicted collectively, so a given position
+   * refers to the same transfer on all ranks.
+   */
+  mutable std::vector<std::unique_ptr<TransferPattern>> patterns_;
+
+  /**
+   * @brief Number of times the symbolic phase has been performed
+   */
+  mutable int num_symbolic_setups_ { 0 };
+
 };
 
 } // end namespace redecomp
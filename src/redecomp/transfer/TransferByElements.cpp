@@ -5,6 +5,8 @@
 
 #include "TransferByElements.hpp"
 
+#include <vector>
+
 #include "axom/slic.hpp"
 
 #include "redecomp/RedecompMesh.hpp"
@@ -157,4 +159,73 @@ void TransferByElements::TransferToParallel(
   }
 }
 
+void TransferByElements::AccumulateToParallel(
+  const mfem::GridFunction& src, 
+  mfem::ParGridFunction& dst
+) const
+{
+  // checks to make sure src and dst are valid
+  auto redecomp = dynamic_cast<RedecompMesh*>(src.FESpace()->GetMesh());
+  SLIC_ERROR_ROOT_IF(redecomp == nullptr,
+    "The Mesh of GridFunction dst must be a Redecomp mesh.");
+  SLIC_ERROR_ROOT_IF(dst.ParFESpace()->GetParMesh() != &redecomp->getParent(),
+    "The Meshes of the specified GridFunctions are not related in a"
+    "Redecomp -> ParMesh relationship.");
+  SLIC_ERROR_ROOT_IF(strcmp(dst.FESpace()->FEColl()->Name(), 
+    src.FESpace()->FEColl()->Name()) != 0, 
+    "The FiniteElementCollections of the specified GridFunctions are not"
+    "the same.");
+  SLIC_ERROR_ROOT_IF(dst.FESpace()->GetVDim() != src.FESpace()->GetVDim(),
+    "The vdim of the FiniteElementSpaces of the specified GridFunctions are"
+    "not the same.");
+
+  // build DOF values of all elements (including ghosts) for each parent rank.
+  // a DOF is shared by neighboring elements, so only its first appearance
+  // carries its value; later appearances send zero.
+  auto n_ranks = redecomp->getMPIUtility().NRanks();
+  auto src_dofs = MPIArray<double>(&redecomp->getMPIUtility());
+  auto vdof_sent = std::vector<bool>(static_cast<size_t>(src.Size()), false);
+  auto elem_vdofs = mfem::Array<int>();
+  auto dof_vals = mfem::Vector();
+  for (int r{0}; r < n_ranks; ++r)
+  {
+    auto first_el = redecomp->getRedecompToParentElemOffsets()[r];
+    auto last_el = redecomp->getRedecompToParentElemOffsets()[r+1];
+    auto vdof_ct = 0;
+    for (int e{first_el}; e < last_el; ++e)
+    {
+      src.FESpace()->GetElementVDofs(e, elem_vdofs);
+      src.GetSubVector(elem_vdofs, dof_vals);
+      for (int i{0}; i < elem_vdofs.Size(); ++i)
+      {
+        auto vdof = mfem::FiniteElementSpace::DecodeDof(elem_vdofs[i]);
+        if (vdof_sent[static_cast<size_t>(vdof)])
+        {
+          dof_vals[i] = 0.0;
+        }
+        vdof_sent[static_cast<size_t>(vdof)] = true;
+      }
+      src_dofs[r].insert(vdof_ct, dof_vals.Size(), dof_vals.GetData());
+      vdof_ct += dof_vals.Size();
+    }
+  }
+
+  // send and receive DOF values from other ranks
+  auto dst_dofs = MPIArray<double>(&redecomp->getMPIUtility());
+  dst_dofs.SendRecvArrayEach(src_dofs);
+
+  // add received DOF values to local DOFs
+  for (int r{0}; r < n_ranks; ++r)
+  {
+    auto vdof_ct = 0;
+    for (int e{0}; e < redecomp->getParentToRedecompElems().first[r].size(); ++e)
+    {
+      dst.FESpace()->GetElementVDofs(redecomp->getParentToRedecompElems().first[r][e], elem_vdofs);
+      auto recv_vals = mfem::Vector(&dst_dofs[r][vdof_ct], elem_vdofs.Size());
+      dst.AddElementVector(elem_vdofs, recv_vals);
+      vdof_ct += elem_vdofs.Size();
+    }
+  }
+}
+
 } // end namespace redecomp
@@ -51,6 +51,27 @@ public:
     const mfem::GridFunction& src, 
     mfem::ParGridFunction& dst
   ) const override;
+
+  /**
+   * @brief Sums RedecompMesh-based mfem::GridFunction values, including values
+   * on ghost elements, into a parent-based mfem::ParGridFunction
+   *
+   * Each redecomp DOF value is added to exactly one parent rank, so the sum of
+   * shared DOF values over all parent ranks equals the sum of the redecomp
+   * values over all redecomp ranks.  This arrangement of DOF values is in line
+   * with dual vectors in MFEM and is appropriate for fields where each
+   * redecomp rank holds a partial contribution, e.g. forces from face-pairs
+   * evaluated on only one rank.
+   *
+   * @param src A redecomp GridFunction to be summed into the corresponding
+   * parent ParGridFunction (dst)
+   * @param dst A parent ParGridFunction which receives values from a redecomp
+   * GridFunction (src)
+   */
+  void AccumulateToParallel(
+    const mfem::GridFunction& src, 
+    mfem::ParGridFunction& dst
+  ) const override;
   
 };
 
@@ -5,7 +5,9 @@
 
 #include "TransferByNodes.hpp"
 
+#include <limits>
 #include <unordered_set>
+#include <vector>
 
 #include "axom/slic.hpp"
 
@@ -131,11 +133,18 @@ void TransferByNodes::TransferToParallel(
   dst_dofs.SendRecvEach(
     [&src, src_fes, &src_nodes](int dst_rank)
     {
-      auto src_dofs = axom::Array<double, 2>();
       auto n_vdofs = src_fes->GetVDim();
       auto n_src_dofs = src_nodes.first[dst_rank].size();
-      src_dofs.reserve(n_vdofs*n_src_dofs);
-      src_dofs.resize(axom::ArrayOptions::Uninitialized(), n_vdofs, n_src_dofs);
+      // the whole array is sent, so it is sized to the sent DOFs only
+      auto n_sent_dofs = 0;
+      for (int j{0}; j < n_src_dofs; ++j)
+      {
+        if (!src_nodes.second[dst_rank][j])
+        {
+          ++n_sent_dofs;
+        }
+      }
+      auto src_dofs = axom::Array<double, 2>(axom::ArrayOptions::Uninitialized(), n_vdofs, n_sent_dofs);
       auto dof_ct = 0;
       for (int j{0}; j < n_src_dofs; ++j)
       {
@@ -149,7 +158,6 @@ void TransferByNodes::TransferToParallel(
           ++dof_ct;
         }
       }
-      src_dofs.shrink();
       return src_dofs;
     }
   );
@@ -172,9 +180,313 @@ void TransferByNodes::TransferToParallel(
         ++dof_ct;
       }
     }
+    SLIC_ASSERT_MSG(dof_ct == dst_dofs[i].shape()[1],
+      "Number of received DOFs does not match the non-ghost node list.");
   }
 }
 
+void TransferByNodes::AccumulateToParallel(
+  const mfem::GridFunction& src, 
+  mfem::ParGridFunction& dst
+) const
+{
+  // define transfer specific data
+  auto src_fes = src.FESpace();
+  auto dst_fes = dst.ParFESpace();
+  // r2p = redecomp to parent
+  const auto& src_nodes = r2p_nodes_;
+  // p2r = parent to redecomp
+  const auto& dst_nodes = p2r_nodes_;
+
+  // checks to make sure src and dst are valid
+  SLIC_ERROR_ROOT_IF(src.FESpace() != redecomp_fes_,
+    "The FiniteElementSpace of GridFunction src must match the FiniteElementSpace "
+    "in TransferByNodes.");
+  SLIC_ERROR_ROOT_IF(dst.ParFESpace() != parent_fes_,
+    "The ParFiniteElementSpace of GridFunction dst must match the ParFiniteElementSpace "
+    "in TransferByNodes.");
+
+  // build DOF values of all nodes (including ghosts) for each parent rank.  a
+  // node may belong on more than one parent rank, so only its first
+  // appearance carries its value; later appearances send zero.
+  auto n_vdofs = src_fes->GetVDim();
+  auto n_ranks = redecomp_->getMPIUtility().NRanks();
+  auto src_dofs = MPIArray<double, 2>(&redecomp_->getMPIUtility());
+  auto node_sent = std::vector<bool>(static_cast<size_t>(src_fes->GetNDofs()), false);
+  for (int r{0}; r < n_ranks; ++r)
+  {
+    auto n_src_dofs = src_nodes.first[r].size();
+    src_dofs[r].resize(n_vdofs, n_src_dofs);
+    for (int j{0}; j < n_src_dofs; ++j)
+    {
+      auto node = static_cast<size_t>(src_nodes.first[r][j]);
+      for (int d{0}; d < n_vdofs; ++d)
+      {
+        src_dofs[r](d, j) = node_sent[node] ? 0.0 :
+          src(src_fes->DofToVDof(src_nodes.first[r][j], d));
+      }
+      node_sent[node] = true;
+    }
+  }
+
+  // send and receive DOF values from other ranks
+  auto dst_dofs = MPIArray<double, 2>(&redecomp_->getMPIUtility());
+  dst_dofs.SendRecvArrayEach(src_dofs);
+
+  // add received DOF values to dst
+  for (int i{0}; i < n_ranks; ++i)
+  {
+    for (int j{0}; j < dst_nodes.first[i].size(); ++j)
+    {
+      for (int d{0}; d < n_vdofs; ++d)
+      {
+        dst(dst_fes->DofToVDof(dst_nodes.first[i][j], d)) += dst_dofs[i](d, j);
+      }
+    }
+  }
+}
+
+void TransferByNodes::TransferToSerialReducedGhosts(
+  const mfem::ParGridFunction& src,
+  mfem::GridFunction& dst
+) const
+{
+  // define transfer-specific data
+  auto src_fes = src.ParFESpace();
+  auto dst_fes = dst.FESpace();
+  // p2r = parent to redecomp
+  const auto& src_nodes = p2r_nodes_;
+  // r2p = redecomp to parent
+  const auto& dst_nodes = r2p_nodes_;
+
+  // checks to make sure src and dst are valid
+  SLIC_ERROR_ROOT_IF(dst_fes != redecomp_fes_,
+    "The FiniteElementSpace of GridFunction dst must match the FiniteElementSpace "
+    "in TransferByNodes.");
+  SLIC_ERROR_ROOT_IF(src_fes != parent_fes_,
+    "The ParFiniteElementSpace of GridFunction src must match the ParFiniteElementSpace "
+    "in TransferByNodes.");
+
+  // send and receive non-ghost DOF values in double precision
+  auto dst_dofs = MPIArray<double, 2>(&redecomp_->getMPIUtility());
+  dst_dofs.SendRecvEach(
+    [&src, src_fes, &src_nodes](int dst_rank)
+    {
+      auto n_vdofs = src_fes->GetVDim();
+      auto n_src_dofs = src_nodes.first[dst_rank].size();
+      // the whole array is sent, so it is sized to the sent DOFs only
+      auto n_sent_dofs = 0;
+      for (int j{0}; j < n_src_dofs; ++j)
+      {
+        if (!src_nodes.second[dst_rank][j])
+        {
+          ++n_sent_dofs;
+        }
+      }
+      auto src_dofs = axom::Array<double, 2>(axom::ArrayOptions::Uninitialized(), n_vdofs, n_sent_dofs);
+      auto dof_ct = 0;
+      for (int j{0}; j < n_src_dofs; ++j)
+      {
+        if (!src_nodes.second[dst_rank][j])
+        {
+          for (int d{0}; d < n_vdofs; ++d)
+          {
+            src_dofs(d, dof_ct) =
+              src(src_fes->DofToVDof(src_nodes.first[dst_rank][j], d));
+          }
+          ++dof_ct;
+        }
+      }
+      return src_dofs;
+    }
+  );
+
+  // send and receive ghost-only DOF values in single precision
+  auto dst_ghost_dofs = MPIArray<float, 2>(&redecomp_->getMPIUtility());
+  dst_ghost_dofs.SendRecvEach(
+    [&src, src_fes, &src_nodes](int dst_rank)
+    {
+      auto n_vdofs = src_fes->GetVDim();
+      auto n_src_dofs = src_nodes.first[dst_rank].size();
+      // the whole array is sent, so it is sized to the sent DOFs only
+      auto n_sent_dofs = 0;
+      for (int j{0}; j < n_src_dofs; ++j)
+      {
+        if (src_nodes.second[dst_rank][j])
+        {
+          ++n_sent_dofs;
+        }
+      }
+      auto src_dofs = axom::Array<float, 2>(axom::ArrayOptions::Uninitialized(), n_vdofs, n_sent_dofs);
+      auto dof_ct = 0;
+      for (int j{0}; j < n_src_dofs; ++j)
+      {
+        if (src_nodes.second[dst_rank][j])
+        {
+          for (int d{0}; d < n_vdofs; ++d)
+          {
+            src_dofs(d, dof_ct) = static_cast<float>(
+              src(src_fes->DofToVDof(src_nodes.first[dst_rank][j], d)));
+          }
+          ++dof_ct;
+        }
+      }
+      return src_dofs;
+    }
+  );
+
+  // map received DOF values to local DOFs.  ghost values are mapped first so
+  // exact values of nodes shared with another parent rank take precedence.
+  auto n_vdofs = src_fes->GetVDim();
+  auto n_ranks = redecomp_->getMPIUtility().NRanks();
+  for (int i{0}; i < n_ranks; ++i)
+  {
+    auto dof_ct = 0;
+    for (int j{0}; j < dst_nodes.first[i].size(); ++j)
+    {
+      if (dst_nodes.second[i][j])
+      {
+        for (int d{0}; d < n_vdofs; ++d)
+        {
+          dst(dst_fes->DofToVDof(dst_nodes.first[i][j], d))
+            = static_cast<double>(dst_ghost_dofs[i](d, dof_ct));
+        }
+        ++dof_ct;
+      }
+    }
+    SLIC_ASSERT_MSG(dof_ct == dst_ghost_dofs[i].shape()[1],
+      "Number of received ghost DOFs does not match the ghost node list.");
+  }
+  for (int i{0}; i < n_ranks; ++i)
+  {
+    auto dof_ct = 0;
+    for (int j{0}; j < dst_nodes.first[i].size(); ++j)
+    {
+      if (!dst_nodes.second[i][j])
+      {
+        for (int d{0}; d < n_vdofs; ++d)
+        {
+          dst(dst_fes->DofToVDof(dst_nodes.first[i][j], d))
+            = dst_dofs[i](d, dof_ct);
+        }
+        ++dof_ct;
+      }
+    }
+    SLIC_ASSERT_MSG(dof_ct == dst_dofs[i].shape()[1],
+      "Number of received DOFs does not match the non-ghost node list.");
+  }
+}
+
+void TransferByNodes::TransferGhostElemsToSerial(
+  const mfem::ParGridFunction& src,
+  mfem::GridFunction& dst,
+  const axom::Array<int>& redecomp_elems
+) const
+{
+  // define transfer-specific data
+  auto src_fes = src.ParFESpace();
+  auto dst_fes = dst.FESpace();
+  // p2r = parent to redecomp
+  const auto& src_nodes = p2r_nodes_;
+  // r2p = redecomp to parent
+  const auto& dst_nodes = r2p_nodes_;
+
+  // checks to make sure src and dst are valid
+  SLIC_ERROR_ROOT_IF(dst_fes != redecomp_fes_,
+    "The FiniteElementSpace of GridFunction dst must match the FiniteElementSpace "
+    "in TransferByNodes.");
+  SLIC_ERROR_ROOT_IF(src_fes != parent_fes_,
+    "The ParFiniteElementSpace of GridFunction src must match the ParFiniteElementSpace "
+    "in TransferByNodes.");
+
+  // find DOFs of the requested elements...
+  auto requested_dofs = std::unordered_set<int>();
+  for (auto e : redecomp_elems)
+  {
+    auto elem_dofs = mfem::Array<int>();
+    dst_fes->GetElementDofs(e, elem_dofs);
+    for (auto elem_dof : elem_dofs)
+    {
+      requested_dofs.insert(elem_dof);
+    }
+  }
+  // ...which did not receive an exact value from any parent rank
+  auto n_ranks = redecomp_->getMPIUtility().NRanks();
+  for (int i{0}; i < n_ranks; ++i)
+  {
+    for (int j{0}; j < dst_nodes.first[i].size(); ++j)
+    {
+      if (!dst_nodes.second[i][j])
+      {
+        requested_dofs.erase(dst_nodes.first[i][j]);
+      }
+    }
+  }
+
+  // request each remaining DOF from one parent rank by its index in the node list
+  auto dst_requests = MPIArray<int>(&redecomp_->getMPIUtility());
+  for (int i{0}; i < n_ranks; ++i)
+  {
+    for (int j{0}; j < dst_nodes.first[i].size(); ++j)
+    {
+      if (requested_dofs.erase(dst_nodes.first[i][j]) > 0)
+      {
+        dst_requests[i].push_back(j);
+      }
+    }
+  }
+  auto src_requests = MPIArray<int>(&redecomp_->getMPIUtility());
+  src_requests.SendRecvEach(
+    [&dst_requests](int dst_rank)
+    {
+      return dst_requests[dst_rank];
+    }
+  );
+
+  // send and receive exact values of the requested DOFs
+  auto dst_dofs = MPIArray<double, 2>(&redecomp_->getMPIUtility());
+  dst_dofs.SendRecvEach(
+    [&src, src_fes, &src_nodes, &src_requests](int dst_rank)
+    {
+      auto src_dofs = axom::Array<double, 2>();
+      auto n_vdofs = src_fes->GetVDim();
+      auto n_src_dofs = src_requests[dst_rank].size();
+      src_dofs.reserve(n_vdofs*n_src_dofs);
+      src_dofs.resize(axom::ArrayOptions::Uninitialized(), n_vdofs, n_src_dofs);
+      for (int d{0}; d < n_vdofs; ++d)
+      {
+        for (int k{0}; k < n_src_dofs; ++k)
+        {
+          src_dofs(d, k) = src(src_fes->DofToVDof(
+            src_nodes.first[dst_rank][src_requests[dst_rank][k]], d));
+        }
+      }
+      return src_dofs;
+    }
+  );
+
+  // map received DOF values to local DOFs
+  auto n_vdofs = src_fes->GetVDim();
+  for (int i{0}; i < n_ranks; ++i)
+  {
+    for (int k{0}; k < dst_requests[i].size(); ++k)
+    {
+      for (int d{0}; d < n_vdofs; ++d)
+      {
+        dst(dst_fes->DofToVDof(dst_nodes.first[i][dst_requests[i][k]], d))
+          = dst_dofs[i](d, k);
+      }
+    }
+  }
+}
+
+double TransferByNodes::GhostRoundingBound(double max_abs_value)
+{
+  // rounding to the nearest float has a relative error of at most half of
+  // epsilon; use the full epsilon to be conservative
+  return max_abs_value * std::numeric_limits<float>::epsilon();
+}
+
 EntityIndexByRank TransferByNodes::P2RNodeList(bool use_global_ids)
 {
   // p2r = parent to redecomp
@@ -88,6 +88,76 @@ public:
     mfem::ParGridFunction& dst
   ) const override;
 
+  /**
+   * @brief Sums RedecompMesh-based mfem::GridFunction values, including values
+   * on ghost elements, into a parent-based mfem::ParGridFunction
+   *
+   * Each redecomp DOF value is added to exactly one parent rank, so the sum of
+   * shared DOF values over all parent ranks equals the sum of the redecomp
+   * values over all redecomp ranks.  This arrangement of DOF values is in line
+   * with dual vectors in MFEM and is appropriate for fields where each
+   * redecomp rank holds a partial contribution, e.g. forces from face-pairs
+   * evaluated on only one rank.
+   *
+   * @param src A redecomp GridFunction to be summed into the corresponding
+   * parent ParGridFunction (dst)
+   * @param dst A parent ParGridFunction which receives values from a redecomp
+   * GridFunction (src)
+   */
+  void AccumulateToParallel(
+    const mfem::GridFunction& src, 
+    mfem::ParGridFunction& dst
+  ) const override;
+
+  /**
+   * @brief Copies parent-based mfem::ParGridFunction values to a
+   * RedecompMesh-based mfem::GridFunction, sending values on ghost-only nodes
+   * in single precision
+   *
+   * Values on nodes belonging only to ghost elements are generally only needed
+   * for search and proximity filtering, so sending them as float halves their
+   * communication volume.  Geometric tolerances using these values should be
+   * inflated by GhostRoundingBound(), and exact values can be obtained for
+   * selected elements with TransferGhostElemsToSerial().
+   *
+   * @param src A parent ParGridFunction to be copied to corresponding redecomp
+   * GridFunction (dst)
+   * @param dst A redecomp GridFunction which receives values from a parent
+   * ParGridFunction (src)
+   */
+  void TransferToSerialReducedGhosts(
+    const mfem::ParGridFunction& src,
+    mfem::GridFunction& dst
+  ) const;
+
+  /**
+   * @brief Copies exact parent-based mfem::ParGridFunction values on the
+   * ghost-only nodes of the given RedecompMesh elements
+   *
+   * @note This method is collective; ranks without elements to update must
+   * call it with an empty list.
+   *
+   * @param src A parent ParGridFunction to be copied to corresponding redecomp
+   * GridFunction (dst)
+   * @param dst A redecomp GridFunction which receives values from a parent
+   * ParGridFunction (src)
+   * @param redecomp_elems List of RedecompMesh elements whose values are needed
+   */
+  void TransferGhostElemsToSerial(
+    const mfem::ParGridFunction& src,
+    mfem::GridFunction& dst,
+    const axom::Array<int>& redecomp_elems
+  ) const;
+
+  /**
+   * @brief Returns the largest error of a value rounded to float by
+   * TransferToSerialReducedGhosts()
+   *
+   * @param max_abs_value Largest magnitude of the transferred values
+   * @return Bound on the absolute rounding error
+   */
+  static double GhostRoundingBound(double max_abs_value);
+
   /**
    * @brief Determine list of parent nodes to send to RedecompMesh
    *
@@ -54,6 +54,9 @@ MPI_Datatype MPIUtility::GetMPIType<bool>() const { return MPI_C_BOOL; }
 template <>
 MPI_Datatype MPIUtility::GetMPIType<double>() const { return MPI_DOUBLE; }
 
+template <>
+MPI_Datatype MPIUtility::GetMPIType<float>() const { return MPI_FLOAT; }
+
 template <>
 MPI_Datatype MPIUtility::GetMPIType<int>() const { return MPI_INT; }
 
@@ -22,6 +22,9 @@ namespace redecomp {
 class MassMatrixTest : public testing::TestWithParam<std::pair<std::string, int>> {
 protected:
   double max_error_;
+  double max_cached_error_;
+  double max_block_error_;
+  int num_symbolic_setups_;
   void SetUp() override
   {
     auto mesh_file = GetParam().first;
@@ -75,12 +78,46 @@ protected:
     mass_diff -= mass_direct;
     max_error_ = mass_diff.MaxMaxNorm();
     max_error_ = redecomp_mesh.getMPIUtility().AllreduceValue(max_error_, MPI_MAX);
+
+    // repeat the transfer with the same element lists and scaled values: the
+    // cached pattern should be reused and filled with the new values
+    for (auto& elem_mat : elem_mats)
+    {
+      elem_mat *= 2.0;
+    }
+    auto redecomp_hpm2 = matrix_xfer.TransferToParallel(elem_idx, elem_idx, elem_mats);
+    mfem::SparseMatrix redecomp_sm2;
+    redecomp_hpm2->MergeDiagAndOffd(redecomp_sm2);
+    redecomp_sm2.ToDenseMatrix(mass_diff);
+    mass_direct *= 2.0;
+    mass_diff -= mass_direct;
+    max_cached_error_ = mass_diff.MaxMaxNorm();
+    max_cached_error_ = redecomp_mesh.getMPIUtility().AllreduceValue(max_cached_error_, MPI_MAX);
+
+    // the element matrices split over two arrays give the same matrix
+    auto n_first = n_els / 2;
+    axom::Array<mfem::DenseMatrix> elem_mats_first { 0, n_first };
+    axom::Array<mfem::DenseMatrix> elem_mats_second { 0, n_els - n_first };
+    for (int i{0}; i < n_els; ++i)
+    {
+      (i < n_first ? elem_mats_first : elem_mats_second).push_back(elem_mats[i]);
+    }
+    auto sm_whole = matrix_xfer.TransferToParallelSparse(elem_idx, elem_idx, elem_mats);
+    auto sm_blocks = matrix_xfer.TransferToParallelSparse(
+      elem_idx, elem_idx, {&elem_mats_first, &elem_mats_second});
+    sm_blocks.Add(-1.0, sm_whole);
+    max_block_error_ = sm_blocks.MaxNorm();
+    max_block_error_ = redecomp_mesh.getMPIUtility().AllreduceValue(max_block_error_, MPI_MAX);
+    num_symbolic_setups_ = matrix_xfer.GetNumSymbolicSetups();
   }
 };
 
 TEST_P(MassMatrixTest, mass_matrix_transfer)
 {
   EXPECT_LT(max_error_, 1.0e-13);
+  EXPECT_LT(max_cached_error_, 1.0e-13);
+  EXPECT_LT(max_block_error_, 1.0e-13);
+  EXPECT_EQ(num_symbolic_setups_, 1);
 
   MPI_Barrier(MPI_COMM_WORLD);
 }
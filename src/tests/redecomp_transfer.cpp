@@ -9,6 +9,7 @@
 
 #include "tribol/config.hpp"
 #include "redecomp/redecomp.hpp"
+#include "redecomp/transfer/TransferByNodes.hpp"
 
 namespace redecomp {
 
@@ -113,6 +114,36 @@ TEST_P(TransferTest, node_gridfn_transfer)
   MPI_Barrier(MPI_COMM_WORLD);
 }
 
+TEST_P(TransferTest, node_gridfn_reduced_ghost_transfer)
+{
+  auto transfer_map = TransferByNodes(*par_vector_space_, *redecomp_vector_space_);
+  transfer_map.TransferToSerial(*orig_, *xfer_);
+  auto reduced_xfer = mfem::GridFunction(redecomp_vector_space_.get());
+  transfer_map.TransferToSerialReducedGhosts(*orig_, reduced_xfer);
+
+  // ghost values are within the rounding bound
+  auto max_abs = redecomp_mesh_->getMPIUtility().AllreduceValue(orig_->Normlinf(), MPI_MAX);
+  auto tol = TransferByNodes::GhostRoundingBound(max_abs);
+  for (int i{0}; i < xfer_->Size(); ++i)
+  {
+    EXPECT_NEAR(reduced_xfer[i], (*xfer_)[i], tol);
+  }
+
+  // exact values are recovered on request
+  auto redecomp_elems = axom::Array<int>(0, redecomp_mesh_->GetNE());
+  for (int e{0}; e < redecomp_mesh_->GetNE(); ++e)
+  {
+    redecomp_elems.push_back(e);
+  }
+  transfer_map.TransferGhostElemsToSerial(*orig_, reduced_xfer, redecomp_elems);
+  for (int i{0}; i < xfer_->Size(); ++i)
+  {
+    EXPECT_EQ(reduced_xfer[i], (*xfer_)[i]);
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
 INSTANTIATE_TEST_SUITE_P(redecomp, TransferTest, testing::Values(
   std::make_pair("/data/star.mesh", 1),
   std::make_pair("/data/star.mesh", 3),
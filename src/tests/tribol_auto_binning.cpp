@@ -0,0 +1,116 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/utils/TestUtils.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/search/AutoBinning.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <vector>
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test BINNING_AUTO
+ */
+class AutoBinningTest : public ::testing::Test
+{
+
+public:
+
+   tribol::TestMesh m_mesh;
+
+   void setupAndUpdate()
+   {
+      int err = this->m_mesh.setupPenaltyBlocksAndUpdate();
+      EXPECT_EQ( err, 0 );
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      // call clear() on mesh object to be safe
+      this->m_mesh.clear();
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( AutoBinningTest, trials_match_grid )
+{
+   // forces and pairs from a BINNING_GRID update
+   setupAndUpdate();
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   const tribol::IndexT num_pairs = cs.getNumActivePairs();
+   EXPECT_GT( num_pairs, 0 );
+
+   const int num_nodes = this->m_mesh.numTotalNodes;
+   std::vector<RealT> fz1( this->m_mesh.fz1, this->m_mesh.fz1 + num_nodes );
+   std::vector<RealT> fz2( this->m_mesh.fz2, this->m_mesh.fz2 + num_nodes );
+
+   // try an alternative method every other search
+   cs.setBinningMethod( tribol::BINNING_AUTO );
+   tribol::setAutoBinningInterval( 0, 1 );
+
+   RealT tol = 1.e-12;
+   for (int cycle{1}; cycle <= 6; ++cycle)
+   {
+      this->m_mesh.zeroForces();
+      RealT dt = 1.;
+      tribol::update( cycle, cycle, dt );
+
+      // the method is selected, the scheme still reports BINNING_AUTO, and 
+      // every method finds the same active pairs
+      auto& data = cs.getAutoBinningData();
+      EXPECT_NE( data.m_method, tribol::BINNING_AUTO );
+      EXPECT_NE( data.m_method, tribol::BINNING_CARTESIAN_PRODUCT );
+      EXPECT_EQ( cs.getBinningMethod(), tribol::BINNING_AUTO );
+      EXPECT_EQ( cs.getNumActivePairs(), num_pairs );
+      for (int n{0}; n < num_nodes; ++n)
+      {
+         EXPECT_NEAR( this->m_mesh.fz1[n], fz1[n], tol );
+         EXPECT_NEAR( this->m_mesh.fz2[n], fz2[n], tol );
+      }
+   }
+
+   // both the grid and the BVH have been timed
+   auto& data = cs.getAutoBinningData();
+   EXPECT_GE( data.m_cost[tribol::BINNING_GRID], 0. );
+   EXPECT_GE( data.m_cost[tribol::BINNING_BVH], 0. );
+}
+
+TEST_F( AutoBinningTest, method_names )
+{
+   EXPECT_STREQ( tribol::getBinningMethodName( tribol::BINNING_GRID ), "BINNING_GRID" );
+   EXPECT_STREQ( tribol::getBinningMethodName( tribol::BINNING_BVH ), "BINNING_BVH" );
+   EXPECT_STREQ( tribol::getBinningMethodName( tribol::BINNING_HASH_GRID ), "BINNING_HASH_GRID" );
+   EXPECT_STREQ( tribol::getBinningMethodName( tribol::BINNING_AUTO ), "BINNING_AUTO" );
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
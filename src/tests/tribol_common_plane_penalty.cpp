@@ -103,6 +103,17 @@ void checkMeshPenalties( tribol::CouplingScheme const * cs,
       RealT penalty_diff_2 = std::abs( mesh2.getElementData().m_penalty_stiffness - penalty );
       EXPECT_LE( penalty_diff_1, tol );
       EXPECT_LE( penalty_diff_2, tol );
+
+      // check the precomputed per-face penalty stiffness
+      for (auto mesh_view : { mesh1.getView(), mesh2.getView() })
+      {
+         EXPECT_TRUE( mesh_view.hasFacePenaltyStiffness() );
+         for (tribol::IndexT kf = 0; kf < mesh_view.numberOfElements(); ++kf)
+         {
+            RealT face_diff = std::abs( mesh_view.getFacePenaltyStiffness()[ kf ] - penalty );
+            EXPECT_LE( face_diff, tol );
+         }
+      }
    }
    else if ( std::strcmp( penaltyType, "face" ) == 0 )
    {
@@ -421,6 +432,52 @@ TEST_F( CommonPlaneTest, constant_penalty_check )
    tribol::finalize();
 }
 
+TEST_F( CommonPlaneTest, tet_constant_penalty_check )
+{
+   this->m_mesh.mortarMeshId = 0;
+   this->m_mesh.nonmortarMeshId = 1;
+
+   // triangular contact faces with 0.1 interpenetration gap
+   RealT z_max1 = 1.05;
+   RealT z_min2 = 0.95;
+
+   this->m_mesh.setupContactMeshTet( 4, 4, 4, 0., 0., 0., 1., 1., z_max1,
+                                     5, 5, 5, 0., 0., z_min2, 1., 1., 2.,
+                                     0., 0. );
+
+   // call tribol setup and update
+   tribol::TestControlParameters parameters; // struct does not hold info right now
+   parameters.penalty_ratio = false;
+   parameters.const_penalty = 0.75;
+
+   int test_mesh_update_err = 
+      this->m_mesh.tribolSetupAndUpdate( tribol::COMMON_PLANE, tribol::PENALTY, 
+                                         tribol::FRICTIONLESS, tribol::NO_CASE, false, parameters );
+
+   EXPECT_EQ( test_mesh_update_err, 0 );
+
+   tribol::CouplingScheme* couplingScheme = 
+      &tribol::CouplingSchemeManager::getInstance().at( 0 );
+   EXPECT_GT( couplingScheme->getNumActivePairs(), 0 );
+
+   // check the pressures
+   RealT gap = z_min2 - z_max1;
+   RealT pressure = tribol::ComputePenaltyStiffnessPerArea( parameters.const_penalty, parameters.const_penalty ) * gap;
+   checkPressures( couplingScheme, pressure, 1.E-8 );
+   checkForceSense( couplingScheme );
+
+   // the face bases are a partition of unity, so the forces on the two 
+   // surfaces balance
+   RealT fz_sum = 0.;
+   for (int n=0; n<this->m_mesh.numTotalNodes; ++n)
+   {
+      fz_sum += this->m_mesh.fz1[n] + this->m_mesh.fz2[n];
+   }
+   EXPECT_NEAR( fz_sum, 0., 1.E-10 );
+
+   tribol::finalize();
+}
+
 TEST_F( CommonPlaneTest, element_penalty_check )
 {
    this->m_mesh.mortarMeshId = 0;
@@ -516,6 +573,46 @@ TEST_F( CommonPlaneTest, element_penalty_check )
    tribol::finalize();
 }
 
+TEST_F( CommonPlaneTest, negative_thickness_check )
+{
+   this->m_mesh.mortarMeshId = 0;
+   this->m_mesh.nonmortarMeshId = 1;
+
+   this->m_mesh.setupContactMeshHex( 4, 4, 4, 0., 0., 0., 1., 1., 1.05,
+                                     5, 5, 5, 0., 0., 0.95, 1., 1., 2.,
+                                     0., 0. );
+
+   this->m_mesh.allocateAndSetVelocities( m_mesh.mortarMeshId, 0., 0., 0. );
+   this->m_mesh.allocateAndSetVelocities( m_mesh.nonmortarMeshId, 0., 0., 0. );
+
+   // a negative element thickness gives an invalid element penalty stiffness
+   this->m_mesh.allocateAndSetElementThickness( m_mesh.mortarMeshId, -0.25 );
+   this->m_mesh.allocateAndSetBulkModulus( m_mesh.mortarMeshId, 1. );
+   this->m_mesh.allocateAndSetElementThickness( m_mesh.nonmortarMeshId, 0.2 );
+   this->m_mesh.allocateAndSetBulkModulus( m_mesh.nonmortarMeshId, 1. );
+
+   tribol::TestControlParameters parameters; 
+   parameters.penalty_ratio = true;
+   parameters.const_penalty = 0.75;
+   parameters.dt = 1.e-3;
+
+   this->m_mesh.tribolSetupAndUpdate( tribol::COMMON_PLANE, tribol::PENALTY, 
+                                      tribol::FRICTIONLESS, tribol::NO_CASE, false, parameters );
+
+   // the coupling scheme fails init() and is skipped by the update
+   tribol::CouplingScheme* couplingScheme = 
+      &tribol::CouplingSchemeManager::getInstance().at( 0 );
+   EXPECT_FALSE( couplingScheme->init() );
+   EXPECT_EQ( couplingScheme->getNumActivePairs(), 0 );
+   for (int i=0; i<this->m_mesh.numTotalNodes; ++i)
+   {
+      EXPECT_EQ( this->m_mesh.fz1[i], 0. );
+      EXPECT_EQ( this->m_mesh.fz2[i], 0. );
+   }
+
+   tribol::finalize();
+}
+
 TEST_F( CommonPlaneTest, tied_contact_check )
 {
    this->m_mesh.mortarMeshId = 0;
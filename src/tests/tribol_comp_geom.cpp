@@ -13,6 +13,7 @@
 #include "tribol/mesh/InterfacePairs.hpp"
 #include "tribol/mesh/MeshData.hpp"
 #include "tribol/geom/GeomUtilities.hpp"
+#include "tribol/geom/Polygon.hpp"
 
 // Axom includes
 #include "axom/slic.hpp"
@@ -292,6 +293,54 @@ TEST_F( CompGeomTest, poly_area_centroid_2 )
    EXPECT_LE( diff_mag, tol );
 }
 
+TEST_F( CompGeomTest, padded_polygon_ops )
+{
+   // This test checks the padded polygon area, centroid, orientation and 
+   // reversal kernels against the raw-array geometry routines
+   RealT xA[4] = { 0., 1., 1., 0. };
+   RealT yA[4] = { 0., 0., 1., 1. };
+   RealT xB[4] = { 0.5, 1.5, 1.5, 0.5 };
+   RealT yB[4] = { 0.25, 0.25, 1.25, 1.25 };
+
+   tribol::Polygon2D<tribol::overlap_polygon_capacity> polyA;
+   tribol::Polygon2D<tribol::overlap_polygon_capacity> polyB;
+   EXPECT_TRUE( polyA.assign( xA, yA, 4 ) );
+   EXPECT_TRUE( polyB.assign( xB, yB, 4 ) );
+
+   RealT tol = 1.e-12;
+   EXPECT_NEAR( polyA.area(), tribol::Area2DPolygon( xA, yA, 4 ), tol );
+   EXPECT_NEAR( tribol::ConvexPolygonArea( xA, yA, 4 ), 1., tol );
+   EXPECT_TRUE( polyA.isCCW() );
+   EXPECT_EQ( polyA.isCCW(), tribol::CheckPolyOrientation( xA, yA, 4 ) );
+
+   RealT cX, cY;
+   EXPECT_TRUE( polyA.centroid( cX, cY ) );
+   EXPECT_NEAR( cX, 0.5, tol );
+   EXPECT_NEAR( cY, 0.5, tol );
+
+   // reversing the ordering flips the orientation, not the area
+   auto polyR = polyA;
+   polyR.reverse();
+   EXPECT_FALSE( polyR.isCCW() );
+   EXPECT_NEAR( polyR.area(), 1., tol );
+
+   // padded kernels on the overlap from the general intersection routine
+   RealT polyX[ tribol::overlap_polygon_capacity ];
+   RealT polyY[ tribol::overlap_polygon_capacity ];
+   int numPolyVert = 0;
+   RealT area = 0.;
+   tribol::Intersection2DPolygon( xA, yA, 4, xB, yB, 4, 1.e-8, 1.e-8,
+                                  polyX, polyY, numPolyVert, area );
+   tribol::Polygon2D<tribol::overlap_polygon_capacity> overlap;
+   EXPECT_TRUE( overlap.assign( polyX, polyY, numPolyVert ) );
+   EXPECT_EQ( overlap.numVerts, 4 );
+   EXPECT_NEAR( overlap.area(), 0.375, tol );
+   EXPECT_NEAR( area, overlap.area(), tol );
+   EXPECT_TRUE( overlap.centroid( cX, cY ) );
+   EXPECT_NEAR( cX, 0.75, tol );
+   EXPECT_NEAR( cY, 0.625, tol );
+}
+
 TEST_F( CompGeomTest, should_produce_no_overlap )
 {
    // this is a configuration from testing that is/was producing an overlap for
@@ -787,6 +836,110 @@ TEST_F( CompGeomTest, 2d_projections_2 )
    EXPECT_LE(diffy2, 1.e-6); 
 }
 
+TEST_F( CompGeomTest, 2d_sweep_and_prune_matches_grid )
+{
+   // two flat, non-matching edge meshes with a small interpenetration. The
+   // sweep and prune binning should find the same active pairs and forces as 
+   // the grid binning.
+   constexpr int numEdges1 = 8;
+   constexpr int numEdges2 = 7;
+
+   RealT x1[numEdges1+1];
+   RealT y1[numEdges1+1];
+   RealT x2[numEdges2+1];
+   RealT y2[numEdges2+1];
+   tribol::IndexT conn1[2*numEdges1];
+   tribol::IndexT conn2[2*numEdges2];
+
+   // edges on mesh 1 are ordered in the -x direction (upward normal), edges
+   // on mesh 2 in the +x direction (downward normal)
+   for (int i=0; i<=numEdges1; ++i)
+   {
+      x1[i] = static_cast<RealT>(i) / numEdges1;
+      y1[i] = 0.;
+   }
+   for (int e=0; e<numEdges1; ++e)
+   {
+      conn1[2*e] = e+1;
+      conn1[2*e+1] = e;
+   }
+   for (int i=0; i<=numEdges2; ++i)
+   {
+      x2[i] = static_cast<RealT>(i) / numEdges2;
+      y2[i] = -0.01;
+   }
+   for (int e=0; e<numEdges2; ++e)
+   {
+      conn2[2*e] = e;
+      conn2[2*e+1] = e+1;
+   }
+
+   RealT fy1[2][numEdges1+1];
+   RealT fy2[2][numEdges2+1];
+   int numActivePairs[2];
+
+   tribol::BinningMethod binning[2] = { tribol::BINNING_GRID, tribol::BINNING_SWEEP_AND_PRUNE };
+   for (int b=0; b<2; ++b)
+   {
+      RealT fx1[numEdges1+1];
+      RealT fx2[numEdges2+1];
+      for (int i=0; i<=numEdges1; ++i)
+      {
+         fx1[i] = 0.;
+         fy1[b][i] = 0.;
+      }
+      for (int i=0; i<=numEdges2; ++i)
+      {
+         fx2[i] = 0.;
+         fy2[b][i] = 0.;
+      }
+
+      tribol::registerMesh( 0, numEdges1, numEdges1+1, &conn1[0], (int)(tribol::LINEAR_EDGE), 
+                            &x1[0], &y1[0], nullptr, tribol::MemorySpace::Host );
+      tribol::registerMesh( 1, numEdges2, numEdges2+1, &conn2[0], (int)(tribol::LINEAR_EDGE), 
+                            &x2[0], &y2[0], nullptr, tribol::MemorySpace::Host );
+
+      tribol::registerNodalResponse( 0, &fx1[0], &fy1[b][0], nullptr );
+      tribol::registerNodalResponse( 1, &fx2[0], &fy2[b][0], nullptr );
+
+      tribol::setKinematicConstantPenalty( 0, 1. );
+      tribol::setKinematicConstantPenalty( 1, 1. );
+
+      tribol::registerCouplingScheme( 0, 0, 1,
+                                      tribol::SURFACE_TO_SURFACE,
+                                      tribol::NO_CASE,
+                                      tribol::COMMON_PLANE,
+                                      tribol::FRICTIONLESS,
+                                      tribol::PENALTY,
+                                      binning[b],
+                                      tribol::ExecutionMode::Sequential );
+
+      tribol::setPenaltyOptions( 0, tribol::KINEMATIC, tribol::KINEMATIC_CONSTANT );
+      tribol::setContactAreaFrac( 0, 1.e-4 );
+
+      RealT dt = 1.;
+      int update_err = tribol::update( 1, 1., dt );
+      EXPECT_EQ( update_err, 0 );
+
+      auto& couplingScheme = tribol::CouplingSchemeManager::getInstance().at( 0 );
+      EXPECT_EQ( couplingScheme.getBinningMethod(), binning[b] );
+      numActivePairs[b] = couplingScheme.getNumActivePairs();
+
+      tribol::finalize();
+   }
+
+   EXPECT_GT( numActivePairs[0], 0 );
+   EXPECT_EQ( numActivePairs[0], numActivePairs[1] );
+   for (int i=0; i<=numEdges1; ++i)
+   {
+      EXPECT_NEAR( fy1[0][i], fy1[1][i], 1.e-12 );
+   }
+   for (int i=0; i<=numEdges2; ++i)
+   {
+      EXPECT_NEAR( fy2[0][i], fy2[1][i], 1.e-12 );
+   }
+}
+
 TEST_F( CompGeomTest, codirectional_normals_3d )
 {
    // this test ensures that faces in a given face-pair with nearly co-directional 
@@ -0,0 +1,219 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/interface/Context.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/MeshData.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <thread>
+
+using RealT = tribol::RealT;
+
+/*!
+ * Small 2D COMMON_PLANE + PENALTY problem registered in the current context
+ */
+struct EdgeProblem
+{
+   static constexpr int numEdges = 4;
+   static constexpr int numNodes = numEdges + 1;
+
+   RealT x1[numNodes], y1[numNodes], fx1[numNodes], fy1[numNodes];
+   RealT x2[numNodes], y2[numNodes], fx2[numNodes], fy2[numNodes];
+   tribol::IndexT conn1[2*numEdges], conn2[2*numEdges];
+
+   int numActivePairs {0};
+
+   void run( RealT gap )
+   {
+      for (int i = 0; i < numNodes; ++i)
+      {
+         // mesh 1 edges point in the -x direction (upward normal), mesh 2 edges
+         // point in the +x direction (downward normal)
+         x1[i] = static_cast<RealT>(i) / numEdges;
+         y1[i] = 0.;
+         x2[i] = x1[i];
+         y2[i] = gap;
+         fx1[i] = 0.; fy1[i] = 0.;
+         fx2[i] = 0.; fy2[i] = 0.;
+      }
+      for (int e = 0; e < numEdges; ++e)
+      {
+         conn1[2*e] = e+1;
+         conn1[2*e+1] = e;
+         conn2[2*e] = e;
+         conn2[2*e+1] = e+1;
+      }
+
+      tribol::registerMesh( 0, numEdges, numNodes, &conn1[0], (int)(tribol::LINEAR_EDGE),
+                            &x1[0], &y1[0], nullptr, tribol::MemorySpace::Host );
+      tribol::registerMesh( 1, numEdges, numNodes, &conn2[0], (int)(tribol::LINEAR_EDGE),
+                            &x2[0], &y2[0], nullptr, tribol::MemorySpace::Host );
+      tribol::registerNodalResponse( 0, &fx1[0], &fy1[0], nullptr );
+      tribol::registerNodalResponse( 1, &fx2[0], &fy2[0], nullptr );
+      tribol::setKinematicConstantPenalty( 0, 1. );
+      tribol::setKinematicConstantPenalty( 1, 1. );
+
+      tribol::registerCouplingScheme( 0, 0, 1,
+                                      tribol::SURFACE_TO_SURFACE,
+                                      tribol::NO_CASE,
+                                      tribol::COMMON_PLANE,
+                                      tribol::FRICTIONLESS,
+                                      tribol::PENALTY,
+                                      tribol::BINNING_GRID,
+                                      tribol::ExecutionMode::Sequential );
+      tribol::setPenaltyOptions( 0, tribol::KINEMATIC, tribol::KINEMATIC_CONSTANT );
+      tribol::setContactAreaFrac( 0, 1.e-4 );
+
+      RealT dt = 1.;
+      tribol::update( 1, 1., dt );
+
+      numActivePairs = tribol::CouplingSchemeManager::getInstance().at( 0 ).getNumActivePairs();
+   }
+
+   RealT totalForce() const
+   {
+      RealT sum = 0.;
+      for (int i = 0; i < numNodes; ++i)
+      {
+         sum += fy1[i];
+      }
+      return sum;
+   }
+};
+
+TEST( ContextTest, registries_are_independent )
+{
+   tribol::Context context;
+   {
+      tribol::ContextScope scope( context );
+      EdgeProblem problem;
+      problem.run( -0.01 );
+      EXPECT_EQ( tribol::MeshManager::getInstance().size(), 2 );
+      EXPECT_EQ( tribol::CouplingSchemeManager::getInstance().size(), 1 );
+      EXPECT_EQ( &tribol::MeshManager::getInstance(), &context.getMeshManager() );
+   }
+
+   // the default context is untouched
+   EXPECT_EQ( tribol::MeshManager::getInstance().size(), 0 );
+   EXPECT_EQ( tribol::CouplingSchemeManager::getInstance().size(), 0 );
+   EXPECT_EQ( context.getCouplingSchemeManager().size(), 1 );
+
+   context.clear();
+   EXPECT_EQ( context.getMeshManager().size(), 0 );
+   EXPECT_EQ( context.getCouplingSchemeManager().size(), 0 );
+}
+
+TEST( ContextTest, nested_contexts )
+{
+   constexpr int numProblems = 2;
+
+   // reference solutions computed one at a time in the default context
+   RealT refForce[numProblems];
+   int refPairs[numProblems];
+   for (int p = 0; p < numProblems; ++p)
+   {
+      EdgeProblem problem;
+      problem.run( -0.01 * (p + 1) );
+      refForce[p] = problem.totalForce();
+      refPairs[p] = problem.numActivePairs;
+      tribol::finalize();
+      tribol::MeshManager::getInstance().clear();
+   }
+
+   // the same problems registered with the same ids in nested contexts
+   tribol::Context contexts[numProblems];
+   EdgeProblem problems[numProblems];
+   {
+      tribol::ContextScope outer( contexts[0] );
+      problems[0].run( -0.01 );
+      {
+         tribol::ContextScope inner( contexts[1] );
+         problems[1].run( -0.02 );
+         EXPECT_EQ( &tribol::MeshManager::getInstance(), &contexts[1].getMeshManager() );
+      }
+      // the outer context is restored with its own coupling scheme
+      EXPECT_EQ( &tribol::MeshManager::getInstance(), &contexts[0].getMeshManager() );
+      EXPECT_EQ( tribol::CouplingSchemeManager::getInstance().at( 0 ).getNumActivePairs(), 
+                 problems[0].numActivePairs );
+   }
+   EXPECT_EQ( tribol::MeshManager::getInstance().size(), 0 );
+
+   for (int p = 0; p < numProblems; ++p)
+   {
+      EXPECT_GT( refPairs[p], 0 );
+      EXPECT_EQ( problems[p].numActivePairs, refPairs[p] );
+      EXPECT_NEAR( problems[p].totalForce(), refForce[p], 1.e-12 );
+   }
+}
+
+TEST( ContextTest, threaded_contexts )
+{
+   constexpr int numThreads = 2;
+
+   // reference solutions computed one at a time in the default context
+   RealT refForce[numThreads];
+   int refPairs[numThreads];
+   for (int t = 0; t < numThreads; ++t)
+   {
+      EdgeProblem problem;
+      problem.run( -0.01 * (t + 1) );
+      refForce[t] = problem.totalForce();
+      refPairs[t] = problem.numActivePairs;
+      tribol::finalize();
+      tribol::MeshManager::getInstance().clear();
+   }
+
+   // the same problems registered with the same ids and solved concurrently,
+   // each in its own context
+   tribol::Context contexts[numThreads];
+   EdgeProblem problems[numThreads];
+   std::thread threads[numThreads];
+   for (int t = 0; t < numThreads; ++t)
+   {
+      threads[t] = std::thread( [&contexts, &problems, t]()
+      {
+         tribol::ContextScope scope( contexts[t] );
+         problems[t].run( -0.01 * (t + 1) );
+      } );
+   }
+   for (int t = 0; t < numThreads; ++t)
+   {
+      threads[t].join();
+   }
+
+   // the scopes only changed the current context of their own threads
+   EXPECT_EQ( tribol::MeshManager::getInstance().size(), 0 );
+   EXPECT_EQ( tribol::CouplingSchemeManager::getInstance().size(), 0 );
+
+   for (int t = 0; t < numThreads; ++t)
+   {
+      EXPECT_GT( refPairs[t], 0 );
+      EXPECT_EQ( contexts[t].getCouplingSchemeManager().size(), 1 );
+      EXPECT_EQ( problems[t].numActivePairs, refPairs[t] );
+      EXPECT_NEAR( problems[t].totalForce(), refForce[t], 1.e-12 );
+   }
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
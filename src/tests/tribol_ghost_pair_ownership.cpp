@@ -0,0 +1,178 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test exactly-once evaluation
+ * of face-pairs using registered face ownership. Two "ranks" are emulated by 
+ * evaluating the same pair of edge meshes with complementary ghost flags.
+ */
+class GhostPairOwnershipTest : public ::testing::Test
+{
+
+public:
+
+   static constexpr int numEdges = 4;
+   static constexpr int numNodes = numEdges + 1;
+
+   RealT m_x[2][numNodes];
+   RealT m_y[2][numNodes];
+   RealT m_fx[2][numNodes];
+   RealT m_fy[2][numNodes];
+   tribol::IndexT m_conn[2][2*numEdges];
+   tribol::IndexT m_global_ids[2][numEdges];
+   bool m_ghost[2][numEdges];
+
+   /// Registers a pair of interpenetrating edge meshes; ghost is null for no ownership data
+   void setupAndUpdate( const bool (*ghost)[numEdges] )
+   {
+      for (int m = 0; m < 2; ++m)
+      {
+         for (int i = 0; i < numNodes; ++i)
+         {
+            // mesh 0 has an upward normal, mesh 1 has a downward normal
+            m_x[m][i] = (m == 0) ? static_cast<RealT>(i) / numEdges 
+                                 : 0.05 + static_cast<RealT>(i) / numEdges;
+            m_y[m][i] = (m == 0) ? 0. : -0.01 * (i + 1);
+            m_fx[m][i] = 0.;
+            m_fy[m][i] = 0.;
+         }
+         for (int e = 0; e < numEdges; ++e)
+         {
+            m_conn[m][2*e] = (m == 0) ? e+1 : e;
+            m_conn[m][2*e+1] = (m == 0) ? e : e+1;
+            m_global_ids[m][e] = m * numEdges + e;
+            m_ghost[m][e] = (ghost != nullptr) ? ghost[m][e] : false;
+         }
+
+         tribol::registerMesh( m, numEdges, numNodes, &m_conn[m][0], (int)(tribol::LINEAR_EDGE),
+                               &m_x[m][0], &m_y[m][0], nullptr, tribol::MemorySpace::Host );
+         tribol::registerNodalResponse( m, &m_fx[m][0], &m_fy[m][0], nullptr );
+         tribol::setKinematicConstantPenalty( m, 1. );
+         if (ghost != nullptr)
+         {
+            tribol::registerFaceOwnership( m, &m_global_ids[m][0], &m_ghost[m][0] );
+         }
+      }
+
+      tribol::registerCouplingScheme( 0, 0, 1,
+                                      tribol::SURFACE_TO_SURFACE,
+                                      tribol::NO_CASE,
+                                      tribol::COMMON_PLANE,
+                                      tribol::FRICTIONLESS,
+                                      tribol::PENALTY,
+                                      tribol::BINNING_GRID,
+                                      tribol::ExecutionMode::Sequential );
+
+      tribol::setPenaltyOptions( 0, tribol::KINEMATIC, tribol::KINEMATIC_CONSTANT );
+      tribol::setContactAreaFrac( 0, 1.e-4 );
+
+      RealT dt = 1.;
+      int err = tribol::update( 1, 1., dt );
+      EXPECT_EQ( err, 0 );
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( GhostPairOwnershipTest, complementary_ranks_match_serial )
+{
+   // reference solution without ownership data
+   setupAndUpdate( nullptr );
+   auto& cs_ref = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   const int num_active_ref = cs_ref.getNumActivePairs();
+   EXPECT_GT( num_active_ref, 0 );
+   EXPECT_EQ( cs_ref.getNumGhostPairsSkipped(), 0 );
+   RealT f_ref[2][2][numNodes];
+   for (int m = 0; m < 2; ++m)
+   {
+      for (int i = 0; i < numNodes; ++i)
+      {
+         f_ref[m][0][i] = m_fx[m][i];
+         f_ref[m][1][i] = m_fy[m][i];
+      }
+   }
+   tribol::finalize();
+
+   // "rank 0" owns the first half of each mesh, "rank 1" owns the rest. the 
+   // sum of the responses of both ranks must match the reference.
+   bool ghost[2][2][numEdges];
+   for (int r = 0; r < 2; ++r)
+   {
+      for (int m = 0; m < 2; ++m)
+      {
+         for (int e = 0; e < numEdges; ++e)
+         {
+            ghost[r][m][e] = (r == 0) ? (e >= numEdges/2) : (e < numEdges/2);
+         }
+      }
+   }
+
+   RealT f_sum[2][2][numNodes] = {};
+   int num_active_sum = 0;
+   for (int r = 0; r < 2; ++r)
+   {
+      setupAndUpdate( ghost[r] );
+      auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+      num_active_sum += cs.getNumActivePairs();
+      EXPECT_GT( cs.getNumGhostPairsSkipped(), 0 );
+      for (int m = 0; m < 2; ++m)
+      {
+         for (int i = 0; i < numNodes; ++i)
+         {
+            f_sum[m][0][i] += m_fx[m][i];
+            f_sum[m][1][i] += m_fy[m][i];
+         }
+      }
+      tribol::finalize();
+   }
+
+   EXPECT_EQ( num_active_sum, num_active_ref );
+   for (int m = 0; m < 2; ++m)
+   {
+      for (int d = 0; d < 2; ++d)
+      {
+         for (int i = 0; i < numNodes; ++i)
+         {
+            EXPECT_NEAR( f_sum[m][d][i], f_ref[m][d][i], 1.e-14 );
+         }
+      }
+   }
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
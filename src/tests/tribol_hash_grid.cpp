@@ -0,0 +1,233 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/utils/TestUtils.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/InterfacePairs.hpp"
+#include "tribol/mesh/MeshData.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test BINNING_HASH_GRID
+ */
+class HashGridTest : public ::testing::Test
+{
+
+public:
+
+   tribol::TestMesh m_mesh;
+
+   void setupAndUpdate()
+   {
+      int err = this->m_mesh.setupPenaltyBlocksAndUpdate();
+      EXPECT_EQ( err, 0 );
+   }
+
+   std::set<std::pair<tribol::IndexT, tribol::IndexT>> 
+   getPairs( const tribol::CouplingScheme& cs )
+   {
+      std::set<std::pair<tribol::IndexT, tribol::IndexT>> pairs;
+      tribol::ArrayT<tribol::InterfacePair, 1, tribol::MemorySpace::Host> 
+         pairs_host( cs.getInterfacePairs() );
+      for (auto& pair : pairs_host)
+      {
+         // each pair is found once
+         EXPECT_TRUE( pairs.emplace( pair.m_element_id1, pair.m_element_id2 ).second );
+      }
+      return pairs;
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      // call clear() on mesh object to be safe
+      this->m_mesh.clear();
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( HashGridTest, matches_grid )
+{
+   // active pairs and forces from a BINNING_GRID update
+   setupAndUpdate();
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   const tribol::IndexT num_active_pairs = cs.getNumActivePairs();
+   EXPECT_GT( num_active_pairs, 0 );
+
+   const int num_nodes = this->m_mesh.numTotalNodes;
+   std::vector<RealT> fz1( this->m_mesh.fz1, this->m_mesh.fz1 + num_nodes );
+   std::vector<RealT> fz2( this->m_mesh.fz2, this->m_mesh.fz2 + num_nodes );
+   for (int n{0}; n < num_nodes; ++n)
+   {
+      this->m_mesh.fx1[n] = 0.; this->m_mesh.fy1[n] = 0.; this->m_mesh.fz1[n] = 0.;
+      this->m_mesh.fx2[n] = 0.; this->m_mesh.fy2[n] = 0.; this->m_mesh.fz2[n] = 0.;
+   }
+
+   cs.setBinningMethod( tribol::BINNING_HASH_GRID );
+   RealT dt = 1.;
+   tribol::update( 1, 1., dt );
+
+   EXPECT_EQ( cs.getBinningMethod(), tribol::BINNING_HASH_GRID );
+   EXPECT_GE( getPairs( cs ).size(), num_active_pairs );
+   EXPECT_EQ( cs.getNumActivePairs(), num_active_pairs );
+
+   RealT tol = 1.e-12;
+   for (int n{0}; n < num_nodes; ++n)
+   {
+      EXPECT_NEAR( this->m_mesh.fz1[n], fz1[n], tol );
+      EXPECT_NEAR( this->m_mesh.fz2[n], fz2[n], tol );
+   }
+}
+
+/*!
+ * Square patches of quads in the z = 0 plane with one large quad next to the
+ * patch, so the large quads cover many cells of a grid sized from the small 
+ * quads
+ */
+struct MixedSizeMesh
+{
+   std::vector<RealT> x, y, z, fx, fy, fz;
+   std::vector<tribol::IndexT> conn;
+   int numElems {0};
+
+   MixedSizeMesh( int n, RealT z0, bool upward )
+   {
+      const RealT h = 1. / n;
+      for (int j{0}; j <= n; ++j)
+      {
+         for (int i{0}; i <= n; ++i)
+         {
+            addNode( i * h, j * h, z0 );
+         }
+      }
+      for (int j{0}; j < n; ++j)
+      {
+         for (int i{0}; i < n; ++i)
+         {
+            const int n0 = j * (n + 1) + i;
+            addQuad( n0, n0 + 1, n0 + n + 2, n0 + n + 1, upward );
+         }
+      }
+      const int n0 = static_cast<int>(x.size());
+      addNode( 1., 0., z0 );
+      addNode( 3., 0., z0 );
+      addNode( 3., 2., z0 );
+      addNode( 1., 2., z0 );
+      addQuad( n0, n0 + 1, n0 + 2, n0 + 3, upward );
+   }
+
+   void addNode( RealT xn, RealT yn, RealT zn )
+   {
+      x.push_back( xn ); y.push_back( yn ); z.push_back( zn );
+      fx.push_back( 0. ); fy.push_back( 0. ); fz.push_back( 0. );
+   }
+
+   void addQuad( int n0, int n1, int n2, int n3, bool upward )
+   {
+      // counter-clockwise about +z for an upward normal
+      const int nodes[4] = { n0, upward ? n1 : n3, n2, upward ? n3 : n1 };
+      conn.insert( conn.end(), nodes, nodes + 4 );
+      ++numElems;
+   }
+
+   void zeroForces()
+   {
+      std::fill( fx.begin(), fx.end(), 0. );
+      std::fill( fy.begin(), fy.end(), 0. );
+      std::fill( fz.begin(), fz.end(), 0. );
+   }
+
+   void registerMesh( tribol::IndexT mesh_id )
+   {
+      tribol::registerMesh( mesh_id, numElems, static_cast<int>(x.size()), conn.data(), 
+                            (int)(tribol::LINEAR_QUAD), x.data(), y.data(), z.data(), 
+                            tribol::MemorySpace::Host );
+      tribol::registerNodalResponse( mesh_id, fx.data(), fy.data(), fz.data() );
+      tribol::setKinematicConstantPenalty( mesh_id, 1. );
+   }
+};
+
+TEST_F( HashGridTest, mixed_size_faces )
+{
+   // mesh 1 faces point up, mesh 2 faces point down and interpenetrate mesh 1
+   MixedSizeMesh mesh1( 8, 0., true );
+   MixedSizeMesh mesh2( 4, -0.01, false );
+   mesh1.registerMesh( 0 );
+   mesh2.registerMesh( 1 );
+   tribol::registerCouplingScheme( 0, 0, 1,
+                                   tribol::SURFACE_TO_SURFACE,
+                                   tribol::NO_CASE,
+                                   tribol::COMMON_PLANE,
+                                   tribol::FRICTIONLESS,
+                                   tribol::PENALTY,
+                                   tribol::BINNING_GRID,
+                                   tribol::ExecutionMode::Sequential );
+   tribol::setPenaltyOptions( 0, tribol::KINEMATIC, tribol::KINEMATIC_CONSTANT );
+
+   // active pairs and forces from a BINNING_GRID update
+   RealT dt = 1.;
+   tribol::update( 1, 1., dt );
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   const tribol::IndexT num_active_pairs = cs.getNumActivePairs();
+   EXPECT_GT( num_active_pairs, 0 );
+   std::vector<RealT> fz1( mesh1.fz );
+   std::vector<RealT> fz2( mesh2.fz );
+
+   mesh1.zeroForces();
+   mesh2.zeroForces();
+   cs.setBinningMethod( tribol::BINNING_HASH_GRID );
+   tribol::update( 2, 2., dt );
+
+   // the pair of large faces is found though neither large box is binned
+   auto pairs = getPairs( cs );
+   EXPECT_EQ( pairs.count( std::make_pair( mesh1.numElems - 1, mesh2.numElems - 1 ) ), 1 );
+   EXPECT_EQ( cs.getNumActivePairs(), num_active_pairs );
+
+   RealT tol = 1.e-12;
+   for (size_t n{0}; n < fz1.size(); ++n)
+   {
+      EXPECT_NEAR( mesh1.fz[n], fz1[n], tol );
+   }
+   for (size_t n{0}; n < fz2.size(); ++n)
+   {
+      EXPECT_NEAR( mesh2.fz[n], fz2[n], tol );
+   }
+
+   tribol::MeshManager::getInstance().clear();
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/utils/TestUtils.hpp"
+#include "tribol/utils/LoadBalance.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <string>
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test
+ * the cross-rank load balance diagnostics
+ */
+class LoadBalanceTest : public ::testing::Test
+{
+
+public:
+
+   tribol::TestMesh m_mesh;
+
+   void setupAndUpdate()
+   {
+      int err = this->m_mesh.setupPenaltyBlocksAndUpdate();
+      EXPECT_EQ( err, 0 );
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      // call clear() on mesh object to be safe
+      this->m_mesh.clear();
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( LoadBalanceTest, disabled_by_default )
+{
+   setupAndUpdate();
+
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   auto& data = cs.getLoadBalanceData();
+   EXPECT_EQ( data.m_num_reports, 0 );
+
+   // local work is recorded regardless
+   EXPECT_GT( data.m_local[tribol::LB_ACTIVE_PAIRS], 0. );
+   EXPECT_GE( data.m_local[tribol::LB_CANDIDATE_PAIRS], data.m_local[tribol::LB_ACTIVE_PAIRS] );
+}
+
+TEST_F( LoadBalanceTest, periodic_report )
+{
+   setupAndUpdate();
+
+   tribol::setLoadBalanceInterval( 0, 2 );
+   RealT dt = 1.;
+   for (int cycle{1}; cycle <= 4; ++cycle)
+   {
+      tribol::update( cycle, 1., dt );
+   }
+
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   auto& data = cs.getLoadBalanceData();
+   EXPECT_EQ( data.m_num_reports, 2 );
+
+   // single rank: the maximum and average are the local work
+   for (int i{0}; i < tribol::NUM_LB_QUANTITIES; ++i)
+   {
+      EXPECT_EQ( data.m_max[i], data.m_local[i] );
+      EXPECT_DOUBLE_EQ( data.m_avg[i], data.m_local[i] );
+      EXPECT_DOUBLE_EQ( data.m_imbalance[i], 1. );
+      EXPECT_EQ( data.m_max_rank[i], 0 );
+      EXPECT_NE( std::string( tribol::getLoadBalanceQuantityName( 
+         static_cast<tribol::LoadBalanceQuantity>(i) ) ), "unknown" );
+   }
+   EXPECT_GT( data.m_max[tribol::LB_ACTIVE_PAIRS], 0. );
+   EXPECT_GE( data.m_max[tribol::LB_CANDIDATE_PAIRS], data.m_max[tribol::LB_ACTIVE_PAIRS] );
+}
+
+TEST_F( LoadBalanceTest, skipped_scheme_reports_no_work )
+{
+   this->m_mesh.mortarMeshId = 0;
+   this->m_mesh.nonmortarMeshId = 1;
+
+   this->m_mesh.setupContactMeshHex( 4, 4, 4, 0., 0., 0., 1., 1., 1.005,
+                                     5, 5, 5, 0., 0., 0.95, 1., 1., 2.,
+                                     0., 0. );
+
+   // a negative element thickness fails init(), so update() skips the 
+   // coupling scheme on this rank
+   this->m_mesh.allocateAndSetElementThickness( m_mesh.mortarMeshId, -0.25 );
+   this->m_mesh.allocateAndSetBulkModulus( m_mesh.mortarMeshId, 1. );
+   this->m_mesh.allocateAndSetElementThickness( m_mesh.nonmortarMeshId, 0.2 );
+   this->m_mesh.allocateAndSetBulkModulus( m_mesh.nonmortarMeshId, 1. );
+
+   tribol::TestControlParameters parameters;
+   parameters.penalty_ratio = true;
+   parameters.const_penalty = 0.75;
+   parameters.dt = 1.;
+   this->m_mesh.tribolSetupAndUpdate( tribol::COMMON_PLANE, tribol::PENALTY,
+                                      tribol::FRICTIONLESS, tribol::NO_CASE,
+                                      false, parameters );
+
+   // the diagnostics still run, with no work on this rank
+   tribol::setLoadBalanceInterval( 0, 1 );
+   RealT dt = 1.;
+   tribol::update( 2, 2., dt );
+
+   auto& data = tribol::CouplingSchemeManager::getInstance().at( 0 ).getLoadBalanceData();
+   EXPECT_EQ( data.m_num_reports, 1 );
+   for (int i{0}; i < tribol::NUM_LB_QUANTITIES; ++i)
+   {
+      EXPECT_EQ( data.m_local[i], 0. );
+      EXPECT_EQ( data.m_max[i], 0. );
+      EXPECT_DOUBLE_EQ( data.m_imbalance[i], 1. );
+   }
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+#ifdef TRIBOL_USE_MPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+#ifdef TRIBOL_USE_MPI
+  MPI_Finalize();
+#endif
+
+  return result;
+}
@@ -4,6 +4,7 @@
 // SPDX-License-Identifier: (MIT)
 
 #include <set>
+#include <tuple>
 
 #include <gtest/gtest.h>
 
@@ -37,7 +38,8 @@
  * penalty for this case.  As a result, the test comparisons are the same for both penalty types.
  *
  */
-class MfemCommonPlaneTest : public testing::TestWithParam<std::pair<int, tribol::KinematicPenaltyCalculation>> {
+class MfemCommonPlaneTest : public testing::TestWithParam<
+  std::tuple<int, tribol::KinematicPenaltyCalculation, bool>> {
 protected:
   tribol::RealT max_disp_;
   void SetUp() override
@@ -46,7 +48,7 @@ protected:
     // parallel mesh
     int ref_levels = 2;
     // polynomial order of the finite element discretization
-    int order = GetParam().first;
+    int order = std::get<0>(GetParam());
     // initial velocity
     tribol::RealT initial_v = 0.02;
     // timestep size
@@ -200,7 +202,11 @@ protected:
       tribol::BINNING_GRID
     );
     tribol::registerMfemVelocity(0, v);
-    if (GetParam().second == tribol::KINEMATIC_CONSTANT)
+    if (std::get<2>(GetParam()))
+    {
+      tribol::setMfemReducedGhostPrecision(coupling_scheme_id, true);
+    }
+    if (std::get<1>(GetParam()) == tribol::KINEMATIC_CONSTANT)
     {
       tribol::setMfemKinematicConstantPenalty(coupling_scheme_id, p_kine, p_kine);
     }
@@ -247,10 +253,12 @@ TEST_P(MfemCommonPlaneTest, common_plane)
   MPI_Barrier(MPI_COMM_WORLD);
 }
 
-INSTANTIATE_TEST_SUITE_P(tribol, MfemCommonPlaneTest, testing::Values(std::make_pair(1, tribol::KINEMATIC_CONSTANT),
-                                                                      std::make_pair(1, tribol::KINEMATIC_ELEMENT),
-                                                                      std::make_pair(2, tribol::KINEMATIC_CONSTANT),
-                                                                      std::make_pair(2, tribol::KINEMATIC_ELEMENT)));
+INSTANTIATE_TEST_SUITE_P(tribol, MfemCommonPlaneTest, testing::Values(std::make_tuple(1, tribol::KINEMATIC_CONSTANT, false),
+                                                                      std::make_tuple(1, tribol::KINEMATIC_ELEMENT, false),
+                                                                      std::make_tuple(2, tribol::KINEMATIC_CONSTANT, false),
+                                                                      std::make_tuple(2, tribol::KINEMATIC_ELEMENT, false),
+                                                                      std::make_tuple(1, tribol::KINEMATIC_CONSTANT, true),
+                                                                      std::make_tuple(2, tribol::KINEMATIC_CONSTANT, true)));
 
 //------------------------------------------------------------------------------
 int main(int argc, char* argv[])
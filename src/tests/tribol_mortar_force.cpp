@@ -236,6 +236,39 @@ public:
       EXPECT_LE( diffY2, tol);
       EXPECT_LE( diffZ2, tol);
 
+      // the residual-only evaluation matches the residual of a full evaluation
+      if (method == tribol::SINGLE_MORTAR)
+      {
+         RealT residualX1[ this->numNodes ];
+         RealT residualZ1[ this->numNodes ];
+         RealT residualX2[ this->numNodes ];
+         RealT residualZ2[ this->numNodes ];
+         for (int i=0; i<this->numNodes; ++i)
+         {
+            residualX1[i] = fx1[i];
+            residualZ1[i] = fz1[i];
+            residualX2[i] = fx2[i];
+            residualZ2[i] = fz2[i];
+            fx1[i] = 0.;
+            fy1[i] = 0.;
+            fz1[i] = 0.;
+            fx2[i] = 0.;
+            fy2[i] = 0.;
+            fz2[i] = 0.;
+         }
+         tribol::setLagrangeMultiplierOptions( csIndex, tribol::ImplicitEvalMode::MORTAR_RESIDUAL_JACOBIAN,
+                                               tribol::SparseMode::MFEM_LINKED_LIST );
+         tribol_update_err = tribol::update( 1, 1., dt );
+         EXPECT_EQ( tribol_update_err, 0 );
+         for (int i=0; i<this->numNodes; ++i)
+         {
+            EXPECT_NEAR( fx1[i], residualX1[i], 1.e-12 );
+            EXPECT_NEAR( fz1[i], residualZ1[i], 1.e-12 );
+            EXPECT_NEAR( fx2[i], residualX2[i], 1.e-12 );
+            EXPECT_NEAR( fz2[i], residualZ2[i], 1.e-12 );
+         }
+      }
+
       // finalize
       tribol::finalize();
 
@@ -0,0 +1,117 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/utils/TestUtils.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <cmath> // std::abs
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to compare NODE_TO_SURFACE 
+ * and COMMON_PLANE penalty contact
+ */
+class NodeToSurfaceTest : public ::testing::Test
+{
+
+public:
+
+   tribol::TestMesh m_mesh;
+
+   void setupAndUpdate( tribol::ContactMethod method )
+   {
+      int err = this->m_mesh.setupPenaltyBlocksAndUpdate( method );
+      EXPECT_EQ( err, 0 );
+   }
+
+   void sumForces( RealT& fz1, RealT& fz2 )
+   {
+      fz1 = 0.;
+      fz2 = 0.;
+      for (int n{0}; n < this->m_mesh.numTotalNodes; ++n)
+      {
+         fz1 += this->m_mesh.fz1[n];
+         fz2 += this->m_mesh.fz2[n];
+      }
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      // call clear() on mesh object to be safe
+      this->m_mesh.clear();
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( NodeToSurfaceTest, force_balance )
+{
+   setupAndUpdate( tribol::NODE_TO_SURFACE );
+
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   EXPECT_GT( cs.getNumActivePairs(), 0 );
+
+   RealT fz1, fz2;
+   sumForces( fz1, fz2 );
+
+   // mesh 2 is pushed up and off of mesh 1
+   EXPECT_GT( fz2, 0. );
+   EXPECT_LT( fz1, 0. );
+   EXPECT_NEAR( fz1 + fz2, 0., 1.e-12 );
+
+   // every mesh 2 surface node is penalized exactly once, so the total force 
+   // is the equivalent stiffness times the gap times the surface area
+   RealT k = 0.75 * 0.75 / (0.75 + 0.75);
+   RealT gap = 0.055;
+   RealT area = 1.;
+   EXPECT_NEAR( fz2, k * gap * area, 1.e-10 );
+}
+
+TEST_F( NodeToSurfaceTest, matches_common_plane_total_force )
+{
+   setupAndUpdate( tribol::COMMON_PLANE );
+   RealT fz1_cp, fz2_cp;
+   sumForces( fz1_cp, fz2_cp );
+   this->m_mesh.clear();
+   tribol::finalize();
+
+   setupAndUpdate( tribol::NODE_TO_SURFACE );
+   RealT fz1_nts, fz2_nts;
+   sumForces( fz1_nts, fz2_nts );
+
+   // a uniform gap gives the same total contact force with either method
+   EXPECT_GT( fz2_cp, 0. );
+   EXPECT_NEAR( fz2_nts, fz2_cp, 1.e-2 * std::abs( fz2_cp ) );
+   EXPECT_NEAR( fz1_nts, fz1_cp, 1.e-2 * std::abs( fz1_cp ) );
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
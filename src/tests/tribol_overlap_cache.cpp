@@ -0,0 +1,141 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/utils/TestUtils.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <vector>
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test the common plane
+ * overlap polygon cache
+ */
+class OverlapCacheTest : public ::testing::Test
+{
+
+public:
+
+   tribol::TestMesh m_mesh;
+
+   void setupAndUpdate()
+   {
+      int err = this->m_mesh.setupPenaltyBlocksAndUpdate();
+      EXPECT_EQ( err, 0 );
+   }
+
+   void translateMortarBlock( RealT dx )
+   {
+      for (int n{0}; n < this->m_mesh.numMortarNodes; ++n)
+      {
+         this->m_mesh.x[n] += dx;
+      }
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      // call clear() on mesh object to be safe
+      this->m_mesh.clear();
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( OverlapCacheTest, hits_match_recompute )
+{
+   setupAndUpdate();
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+
+   // forces from an update without the cache
+   this->m_mesh.zeroForces();
+   RealT dt = 1.;
+   tribol::update( 1, 1., dt );
+   const int num_active = cs.getNumActivePairs();
+   EXPECT_GT( num_active, 0 );
+
+   const int num_nodes = this->m_mesh.numTotalNodes;
+   std::vector<RealT> fz1( this->m_mesh.fz1, this->m_mesh.fz1 + num_nodes );
+   std::vector<RealT> fz2( this->m_mesh.fz2, this->m_mesh.fz2 + num_nodes );
+
+   tribol::setOverlapCacheRatio( 0, 0.01 );
+
+   RealT tol = 1.e-10;
+   for (int cycle{2}; cycle <= 4; ++cycle)
+   {
+      this->m_mesh.zeroForces();
+      tribol::update( cycle, cycle, dt );
+
+      // the first update fills the cache; later updates reuse the polygon of
+      // every active pair and give the same forces
+      auto& data = cs.getOverlapCacheData();
+      const auto num_pairs = cs.getInterfacePairs().size();
+      EXPECT_EQ( data.m_num_lookups, num_pairs );
+      EXPECT_EQ( data.m_num_hits, (cycle == 2) ? 0 : num_active );
+      EXPECT_EQ( cs.getNumActivePairs(), num_active );
+      for (int n{0}; n < num_nodes; ++n)
+      {
+         EXPECT_NEAR( this->m_mesh.fz1[n], fz1[n], tol );
+         EXPECT_NEAR( this->m_mesh.fz2[n], fz2[n], tol );
+      }
+   }
+   EXPECT_NEAR( cs.getOverlapCacheData().totalHitRate(),
+                2. * num_active / (3. * cs.getInterfacePairs().size()), tol );
+}
+
+TEST_F( OverlapCacheTest, misses_on_tangential_motion )
+{
+   setupAndUpdate();
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   tribol::setOverlapCacheRatio( 0, 0.01 );
+
+   RealT dt = 1.;
+   this->m_mesh.zeroForces();
+   tribol::update( 1, 1., dt );
+   const int num_active = cs.getNumActivePairs();
+   auto& data = cs.getOverlapCacheData();
+   EXPECT_EQ( data.m_num_hits, 0 );
+
+   // relative tangential motion below the tolerance reuses the polygons
+   translateMortarBlock( 1.e-4 );
+   this->m_mesh.zeroForces();
+   tribol::update( 2, 2., dt );
+   EXPECT_EQ( data.m_num_hits, num_active );
+
+   // motion past the tolerance recomputes every polygon
+   translateMortarBlock( 0.05 );
+   this->m_mesh.zeroForces();
+   tribol::update( 3, 3., dt );
+   EXPECT_EQ( data.m_num_hits, 0 );
+   EXPECT_DOUBLE_EQ( data.hitRate(), 0. );
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -0,0 +1,188 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/utils/TestUtils.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <set>
+#include <utility>
+#include <vector>
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test the candidate pair and
+ * contact plane budgets
+ */
+class PairBudgetTest : public ::testing::Test
+{
+
+public:
+
+   tribol::TestMesh m_mesh;
+
+   void setupAndUpdate( int numElemsXY2 = 5, RealT lengthXY2 = 1. )
+   {
+      int err = this->m_mesh.setupPenaltyBlocksAndUpdate( tribol::COMMON_PLANE, numElemsXY2, 
+                                                          0., lengthXY2, lengthXY2 );
+      EXPECT_EQ( err, 0 );
+   }
+
+   static std::set<std::pair<tribol::IndexT, tribol::IndexT>> pairSet( 
+      const tribol::CouplingScheme& cs )
+   {
+      std::set<std::pair<tribol::IndexT, tribol::IndexT>> pairs;
+      tribol::ArrayT<tribol::InterfacePair, 1, tribol::MemorySpace::Host> 
+         pairs_host( cs.getInterfacePairs() );
+      for (auto& pair : pairs_host)
+      {
+         pairs.emplace( pair.m_element_id1, pair.m_element_id2 );
+      }
+      return pairs;
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      // call clear() on mesh object to be safe
+      this->m_mesh.clear();
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( PairBudgetTest, chunks_match_unbounded )
+{
+   setupAndUpdate();
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   cs.setBinningMethod( tribol::BINNING_BVH );
+
+   // forces and pairs from a BVH update without budgets
+   this->m_mesh.zeroForces();
+   RealT dt = 1.;
+   tribol::update( 1, 1., dt );
+   const tribol::IndexT num_pairs = cs.getInterfacePairs().size();
+   const tribol::IndexT num_active = cs.getNumActivePairs();
+   EXPECT_GT( num_active, 8 );
+
+   const int num_nodes = this->m_mesh.numTotalNodes;
+   std::vector<RealT> fz1( this->m_mesh.fz1, this->m_mesh.fz1 + num_nodes );
+   std::vector<RealT> fz2( this->m_mesh.fz2, this->m_mesh.fz2 + num_nodes );
+
+   // budgets far below the pair counts
+   tribol::setPairBudget( 0, 8, 4 );
+
+   RealT tol = 1.e-12;
+   for (int cycle{2}; cycle <= 4; ++cycle)
+   {
+      this->m_mesh.zeroForces();
+      tribol::update( cycle, cycle, dt );
+
+      // the first chunk is capped, including in the first search
+      auto& data = cs.getPairBudgetData();
+      EXPECT_GT( data.m_num_query_chunks, 1 );
+      EXPECT_GT( data.m_num_plane_chunks, 1 );
+      EXPECT_EQ( data.m_num_candidate_overruns, cycle - 1 );
+      EXPECT_EQ( data.m_num_plane_overruns, cycle - 1 );
+
+      // the pairs, active planes and forces are unchanged
+      EXPECT_EQ( cs.getInterfacePairs().size(), num_pairs );
+      EXPECT_EQ( cs.getNumActivePairs(), num_active );
+      for (int n{0}; n < num_nodes; ++n)
+      {
+         EXPECT_NEAR( this->m_mesh.fz1[n], fz1[n], tol );
+         EXPECT_NEAR( this->m_mesh.fz2[n], fz2[n], tol );
+      }
+   }
+}
+
+TEST_F( PairBudgetTest, no_overrun_within_budget )
+{
+   setupAndUpdate();
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   cs.setBinningMethod( tribol::BINNING_BVH );
+   tribol::setPairBudget( 0, 100000, 100000 );
+
+   RealT dt = 1.;
+   for (int cycle{1}; cycle <= 2; ++cycle)
+   {
+      this->m_mesh.zeroForces();
+      tribol::update( cycle, cycle, dt );
+   }
+
+   // the capped first chunk is followed by a single chunk of the other faces
+   auto& data = cs.getPairBudgetData();
+   EXPECT_EQ( data.m_num_query_chunks, 2 );
+   EXPECT_EQ( data.m_num_plane_chunks, 1 );
+   EXPECT_EQ( data.m_num_candidate_overruns, 0 );
+   EXPECT_EQ( data.m_num_plane_overruns, 0 );
+   EXPECT_GT( data.m_candidates_per_face, 0. );
+}
+
+TEST_F( PairBudgetTest, uneven_density_matches_unbounded )
+{
+   // the nonmortar block overhangs the mortar block, so only the mesh 2 faces
+   // over the mortar block have candidates
+   setupAndUpdate( 8, 2. );
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   cs.setBinningMethod( tribol::BINNING_BVH );
+
+   this->m_mesh.zeroForces();
+   RealT dt = 1.;
+   tribol::update( 1, 1., dt );
+   const auto pairs = pairSet( cs );
+   const tribol::IndexT num_active = cs.getNumActivePairs();
+   EXPECT_GT( num_active, 0 );
+
+   const int num_nodes = this->m_mesh.numTotalNodes;
+   std::vector<RealT> fz2( this->m_mesh.fz2, this->m_mesh.fz2 + num_nodes );
+
+   // the chunk sizes change from chunk to chunk with the candidate density
+   tribol::setPairBudget( 0, 16, 100000 );
+
+   RealT tol = 1.e-12;
+   for (int cycle{2}; cycle <= 3; ++cycle)
+   {
+      this->m_mesh.zeroForces();
+      tribol::update( cycle, cycle, dt );
+
+      // every face is queried exactly once
+      EXPECT_GT( cs.getPairBudgetData().m_num_query_chunks, 2 );
+      EXPECT_EQ( cs.getInterfacePairs().size(), static_cast<tribol::IndexT>(pairs.size()) );
+      EXPECT_EQ( pairSet( cs ), pairs );
+      EXPECT_EQ( cs.getNumActivePairs(), num_active );
+      for (int n{0}; n < num_nodes; ++n)
+      {
+         EXPECT_NEAR( this->m_mesh.fz2[n], fz2[n], tol );
+      }
+   }
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -0,0 +1,147 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/utils/TestUtils.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/MeshData.hpp"
+#include "tribol/mesh/PairColoring.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <cmath> // std::abs
+#include <set>
+#include <vector>
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test
+ * the coloring of COMMON_PLANE + PENALTY face-pairs
+ */
+class PairColoringTest : public ::testing::Test
+{
+
+public:
+
+   tribol::TestMesh m_mesh;
+
+   void setupAndUpdate()
+   {
+      int err = this->m_mesh.setupPenaltyBlocksAndUpdate();
+      EXPECT_EQ( err, 0 );
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      // call clear() on mesh object to be safe
+      this->m_mesh.clear();
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( PairColoringTest, colors_share_no_nodes )
+{
+   setupAndUpdate();
+
+   tribol::enablePairColoring( 0, true );
+   RealT dt = 1.;
+   tribol::update( 1, 1., dt );
+
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   auto& coloring = cs.getPairColoring();
+   const tribol::IndexT num_pairs = cs.getNumActivePairs();
+   EXPECT_GT( num_pairs, 0 );
+   EXPECT_GT( coloring.m_num_colors, 0 );
+   EXPECT_EQ( coloring.m_color_offsets.size(), coloring.m_num_colors + 1 );
+   EXPECT_EQ( coloring.m_color_offsets[coloring.m_num_colors], num_pairs );
+
+   // every pair appears exactly once and no two pairs of a color share a node
+   auto cs_view = cs.getView();
+   auto& mesh1 = cs_view.getMesh1View();
+   auto& mesh2 = cs_view.getMesh2View();
+   std::vector<int> visited( num_pairs, 0 );
+   for (tribol::IndexT c{0}; c < coloring.m_num_colors; ++c)
+   {
+      EXPECT_GT( coloring.m_color_offsets[c+1], coloring.m_color_offsets[c] );
+      std::set<tribol::IndexT> nodes1;
+      std::set<tribol::IndexT> nodes2;
+      for (auto k = coloring.m_color_offsets[c]; k < coloring.m_color_offsets[c+1]; ++k)
+      {
+         tribol::IndexT i = coloring.m_color_pairs[k];
+         ++visited[i];
+         EXPECT_EQ( coloring.m_pair_color[i], c );
+         auto& plane = cs_view.getContactPlane(i);
+         for (tribol::IndexT a{0}; a < mesh1.numberOfNodesPerElement(); ++a)
+         {
+            EXPECT_TRUE( nodes1.insert( mesh1.getGlobalNodeId( plane.getCpElementId1(), a ) ).second );
+         }
+         for (tribol::IndexT a{0}; a < mesh2.numberOfNodesPerElement(); ++a)
+         {
+            EXPECT_TRUE( nodes2.insert( mesh2.getGlobalNodeId( plane.getCpElementId2(), a ) ).second );
+         }
+      }
+   }
+   for (auto v : visited)
+   {
+      EXPECT_EQ( v, 1 );
+   }
+}
+
+TEST_F( PairColoringTest, colored_forces_match )
+{
+   setupAndUpdate();
+
+   // forces from the (uncolored) update in setupAndUpdate()
+   const int num_nodes = this->m_mesh.numTotalNodes;
+   std::vector<RealT> fz1( this->m_mesh.fz1, this->m_mesh.fz1 + num_nodes );
+   std::vector<RealT> fz2( this->m_mesh.fz2, this->m_mesh.fz2 + num_nodes );
+
+   RealT force_sum = 0.;
+   for (int n{0}; n < num_nodes; ++n)
+   {
+      force_sum += std::abs( fz1[n] );
+      this->m_mesh.fx1[n] = 0.; this->m_mesh.fy1[n] = 0.; this->m_mesh.fz1[n] = 0.;
+      this->m_mesh.fx2[n] = 0.; this->m_mesh.fy2[n] = 0.; this->m_mesh.fz2[n] = 0.;
+   }
+   EXPECT_GT( force_sum, 0. );
+
+   tribol::enablePairColoring( 0, true );
+   RealT dt = 1.;
+   tribol::update( 1, 1., dt );
+
+   RealT tol = 1.e-12;
+   for (int n{0}; n < num_nodes; ++n)
+   {
+      EXPECT_NEAR( this->m_mesh.fz1[n], fz1[n], tol );
+      EXPECT_NEAR( this->m_mesh.fz2[n], fz2[n], tol );
+   }
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/MeshData.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <set>
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with a registered 2 x 2 quad mesh of the unit square 
+ * in the z = 0 plane
+ */
+class ProximityQueryTest : public ::testing::Test
+{
+
+public:
+
+   RealT m_x[9];
+   RealT m_y[9];
+   RealT m_z[9];
+   tribol::IndexT m_conn[16] = { 0, 1, 4, 3,
+                                 1, 2, 5, 4,
+                                 3, 4, 7, 6,
+                                 4, 5, 8, 7 };
+
+protected:
+
+   void SetUp() override
+   {
+      for (int j = 0; j < 3; ++j)
+      {
+         for (int i = 0; i < 3; ++i)
+         {
+            m_x[3*j+i] = 0.5 * i;
+            m_y[3*j+i] = 0.5 * j;
+            m_z[3*j+i] = 0.;
+         }
+      }
+      tribol::registerMesh( 0, 4, 9, &m_conn[0], (int)(tribol::LINEAR_QUAD),
+                            &m_x[0], &m_y[0], &m_z[0], tribol::MemorySpace::Host );
+   }
+
+   void TearDown() override
+   {
+      tribol::finalize();
+      tribol::MeshManager::getInstance().clear();
+   }
+
+};
+
+TEST_F( ProximityQueryTest, box_query )
+{
+   tribol::ProximityQuery query( 0 );
+   EXPECT_EQ( query.getExecutionMode(), tribol::ExecutionMode::Sequential );
+
+   // box 0 overlaps the lower left face only, box 1 overlaps all faces, 
+   // box 2 is above the mesh
+   RealT bounds[18] = { 0.1, 0.1, -0.1,   0.2, 0.2, 0.1,
+                        0.4, 0.4, -0.1,   0.6, 0.6, 0.1,
+                        0.1, 0.1,  0.5,   0.2, 0.2, 0.6 };
+
+   tribol::ArrayT<tribol::IndexT> offsets;
+   tribol::ArrayT<tribol::IndexT> counts;
+   tribol::ArrayT<tribol::IndexT> faces;
+   query.findFacesInBoxes( 3, &bounds[0], offsets, counts, faces );
+
+   EXPECT_EQ( counts[0], 1 );
+   EXPECT_EQ( faces[offsets[0]], 0 );
+
+   EXPECT_EQ( counts[1], 4 );
+   std::set<tribol::IndexT> found( faces.data() + offsets[1], faces.data() + offsets[1] + counts[1] );
+   EXPECT_EQ( found.size(), 4 );
+
+   EXPECT_EQ( counts[2], 0 );
+}
+
+TEST_F( ProximityQueryTest, closest_point_query )
+{
+   tribol::ProximityQuery query( 0 );
+
+   // point 0 above the upper right face, point 1 outside the square next to 
+   // face 1, point 2 beyond the distance bound
+   RealT points[9] = { 0.8, 0.7, 0.25,
+                       1.2, 0.2, 0.,
+                       0.3, 0.3, 2. };
+   tribol::IndexT faces[3];
+   RealT closest[9];
+   RealT dist[3];
+   query.findClosestPoints( 3, &points[0], 1., &faces[0], &closest[0], &dist[0] );
+
+   EXPECT_EQ( faces[0], 3 );
+   EXPECT_NEAR( dist[0], 0.25, 1.e-12 );
+   EXPECT_NEAR( closest[0], 0.8, 1.e-12 );
+   EXPECT_NEAR( closest[1], 0.7, 1.e-12 );
+   EXPECT_NEAR( closest[2], 0., 1.e-12 );
+
+   EXPECT_EQ( faces[1], 1 );
+   EXPECT_NEAR( dist[1], 0.2, 1.e-12 );
+   EXPECT_NEAR( closest[3], 1., 1.e-12 );
+
+   EXPECT_EQ( faces[2], -1 );
+
+   // move the mesh and rebuild the hierarchy
+   for (int n = 0; n < 9; ++n)
+   {
+      m_z[n] = 0.2;
+   }
+   query.update();
+   query.findClosestPoints( 1, &points[0], 1., &faces[0], &closest[0], &dist[0] );
+   EXPECT_EQ( faces[0], 3 );
+   EXPECT_NEAR( dist[0], 0.05, 1.e-12 );
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -0,0 +1,208 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/geom/RigidSurface.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/CouplingSchemeBatch.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <cmath> // std::abs, std::sqrt
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test contact between a 2D
+ * edge mesh and an analytic rigid surface in a COMMON_PLANE + PENALTY coupling
+ * scheme
+ */
+class RigidSurfaceTest : public ::testing::Test
+{
+
+public:
+
+   static constexpr int numEdges = 4;
+   static constexpr int numNodes = numEdges + 1;
+   static constexpr int dim = 2;
+
+   RealT m_x[numNodes];
+   RealT m_y[numNodes];
+   RealT m_fx[numNodes];
+   RealT m_fy[numNodes];
+   tribol::IndexT m_conn[2*numEdges];
+
+   /// Registers a flat edge mesh at height y0 spanning [0,1] in x
+   void setupMesh( RealT y0 )
+   {
+      for (int i = 0; i < numNodes; ++i)
+      {
+         m_x[i] = static_cast<RealT>(i) / numEdges;
+         m_y[i] = y0;
+         m_fx[i] = 0.;
+         m_fy[i] = 0.;
+      }
+      for (int e = 0; e < numEdges; ++e)
+      {
+         m_conn[2*e] = e;
+         m_conn[2*e+1] = e+1;
+      }
+
+      tribol::registerMesh( 0, numEdges, numNodes, &m_conn[0], (int)(tribol::LINEAR_EDGE),
+                            &m_x[0], &m_y[0], nullptr, tribol::MemorySpace::Host );
+      tribol::registerNodalResponse( 0, &m_fx[0], &m_fy[0], nullptr );
+      tribol::setKinematicConstantPenalty( 0, 1. );
+   }
+
+   /// Couples the edge mesh with the rigid surface and updates
+   void update( bool batch = false )
+   {
+      tribol::registerCouplingScheme( 0, 0, 1,
+                                      tribol::SURFACE_TO_SURFACE,
+                                      tribol::NO_CASE,
+                                      tribol::COMMON_PLANE,
+                                      tribol::FRICTIONLESS,
+                                      tribol::PENALTY,
+                                      tribol::BINNING_GRID,
+                                      tribol::ExecutionMode::Sequential );
+
+      tribol::setPenaltyOptions( 0, tribol::KINEMATIC, tribol::KINEMATIC_CONSTANT );
+      tribol::enableSchemeBatching( 0, batch );
+
+      RealT dt = 1.;
+      int err = tribol::update( 1, 1., dt );
+      EXPECT_EQ( err, 0 );
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( RigidSurfaceTest, signed_distance )
+{
+   tribol::RigidSurface surf;
+   surf.m_type = tribol::RIGID_SPHERE;
+   surf.m_radius = 1.;
+
+   RealT x[3] = { 0., 0., 0.5 };
+   RealT nrml[3];
+   EXPECT_NEAR( surf.signedDistance( x, nrml ), -0.5, 1.e-14 );
+   EXPECT_NEAR( nrml[2], 1., 1.e-14 );
+
+   // inside contact flips the sign and the normal
+   surf.m_contact_inside = true;
+   EXPECT_NEAR( surf.signedDistance( x, nrml ), 0.5, 1.e-14 );
+   EXPECT_NEAR( nrml[2], -1., 1.e-14 );
+
+   // the axial component is ignored for a cylinder
+   surf.m_type = tribol::RIGID_CYLINDER;
+   surf.m_contact_inside = false;
+   x[0] = 2.;
+   EXPECT_NEAR( surf.signedDistance( x, nrml ), 1., 1.e-14 );
+   EXPECT_NEAR( nrml[0], 1., 1.e-14 );
+}
+
+TEST_F( RigidSurfaceTest, plane_forces )
+{
+   // rigid body occupies y < 0
+   const RealT gap = -0.01;
+   setupMesh( gap );
+   RealT point[2] = { 0., 0. };
+   RealT normal[2] = { 0., 2. };
+   tribol::registerRigidSurface( 1, dim, tribol::RIGID_PLANE, point, normal );
+   update();
+
+   // each node carries half of the length of each of its edges
+   const RealT edge_len = 1. / numEdges;
+   RealT force_sum = 0.;
+   for (int i = 0; i < numNodes; ++i)
+   {
+      const RealT trib_len = (i == 0 || i == numNodes-1) ? 0.5 * edge_len : edge_len;
+      EXPECT_NEAR( m_fx[i], 0., 1.e-14 );
+      EXPECT_NEAR( m_fy[i], -gap * trib_len, 1.e-14 );
+      force_sum += m_fy[i];
+   }
+   EXPECT_NEAR( force_sum, -gap, 1.e-14 );
+
+   // moving the plane out of contact removes the forces
+   tribol::finalize();
+   setupMesh( gap );
+   tribol::registerRigidSurface( 1, dim, tribol::RIGID_PLANE, point, normal );
+   RealT new_point[2] = { 0., -0.1 };
+   tribol::setRigidSurfaceMotion( 1, new_point, nullptr );
+   update();
+   for (int i = 0; i < numNodes; ++i)
+   {
+      EXPECT_EQ( m_fx[i], 0. );
+      EXPECT_EQ( m_fy[i], 0. );
+   }
+}
+
+TEST_F( RigidSurfaceTest, batching_not_applied )
+{
+   // rigid surface schemes are never batched, even with batching enabled
+   const RealT gap = -0.01;
+   setupMesh( gap );
+   RealT point[2] = { 0., 0. };
+   RealT normal[2] = { 0., 1. };
+   tribol::registerRigidSurface( 1, dim, tribol::RIGID_PLANE, point, normal );
+   update( true );
+
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   EXPECT_FALSE( tribol::canBatchCouplingSchemes( cs, cs ) );
+   const RealT edge_len = 1. / numEdges;
+   for (int i = 0; i < numNodes; ++i)
+   {
+      const RealT trib_len = (i == 0 || i == numNodes-1) ? 0.5 * edge_len : edge_len;
+      EXPECT_NEAR( m_fy[i], -gap * trib_len, 1.e-14 );
+   }
+}
+
+TEST_F( RigidSurfaceTest, circle_forces )
+{
+   // circle penetrates the center node only
+   setupMesh( 0. );
+   const RealT radius = 0.25;
+   RealT center[2] = { 0.5, 0.21 };
+   tribol::registerRigidSurface( 1, dim, tribol::RIGID_SPHERE, center, nullptr, radius );
+   update();
+
+   const RealT gap = 0.21 - radius;
+   const RealT edge_len = 1. / numEdges;
+   for (int i = 0; i < numNodes; ++i)
+   {
+      EXPECT_NEAR( m_fx[i], 0., 1.e-14 );
+      EXPECT_NEAR( m_fy[i], (i == numNodes/2) ? gap * edge_len : 0., 1.e-14 );
+   }
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -0,0 +1,229 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/CouplingSchemeBatch.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <cmath> // std::abs
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test batching of 
+ * many small 2D COMMON_PLANE + PENALTY coupling schemes
+ */
+class SchemeBatchingTest : public ::testing::Test
+{
+
+public:
+
+   static constexpr int numSchemes = 4;
+   static constexpr int numEdges = 2;
+   static constexpr int numNodes = numEdges + 1;
+
+   RealT m_x[2*numSchemes][numNodes];
+   RealT m_y[2*numSchemes][numNodes];
+   RealT m_fx[2*numSchemes][numNodes];
+   RealT m_fy[2*numSchemes][numNodes];
+   RealT m_vx[2*numSchemes][numNodes];
+   RealT m_vy[2*numSchemes][numNodes];
+   RealT m_thickness[2*numSchemes][numEdges];
+   tribol::IndexT m_conn[2*numSchemes][2*numEdges];
+
+   /// Registers numSchemes pairs of edge meshes with increasing interpenetration.
+   /// If vote_scheme >= 0, the meshes approach each other and coupling scheme
+   /// vote_scheme computes a timestep vote.
+   void setupAndUpdate( bool batch, RealT& dt, int vote_scheme = -1 )
+   {
+      for (int s = 0; s < numSchemes; ++s)
+      {
+         const int m1 = 2 * s;
+         const int m2 = 2 * s + 1;
+         const RealT x0 = 2. * s;
+         for (int i = 0; i < numNodes; ++i)
+         {
+            // mesh 1 edges point in the -x direction (upward normal), mesh 2 
+            // edges point in the +x direction (downward normal)
+            m_x[m1][i] = x0 + static_cast<RealT>(i) / numEdges;
+            m_y[m1][i] = 0.;
+            m_x[m2][i] = x0 + 0.1 + static_cast<RealT>(i) / numEdges;
+            m_y[m2][i] = -0.01 * (s + 1);
+            m_fx[m1][i] = 0.; m_fy[m1][i] = 0.;
+            m_fx[m2][i] = 0.; m_fy[m2][i] = 0.;
+            // each mesh moves along its face normals
+            m_vx[m1][i] = 0.; m_vy[m1][i] = 1.;
+            m_vx[m2][i] = 0.; m_vy[m2][i] = -1.;
+         }
+         for (int e = 0; e < numEdges; ++e)
+         {
+            m_conn[m1][2*e] = e+1;
+            m_conn[m1][2*e+1] = e;
+            m_conn[m2][2*e] = e;
+            m_conn[m2][2*e+1] = e+1;
+         }
+
+         for (int m : {m1, m2})
+         {
+            tribol::registerMesh( m, numEdges, numNodes, &m_conn[m][0], (int)(tribol::LINEAR_EDGE),
+                                  &m_x[m][0], &m_y[m][0], nullptr, tribol::MemorySpace::Host );
+            tribol::registerNodalResponse( m, &m_fx[m][0], &m_fy[m][0], nullptr );
+            tribol::setKinematicConstantPenalty( m, 1. );
+            if (vote_scheme >= 0)
+            {
+               for (int e = 0; e < numEdges; ++e)
+               {
+                  m_thickness[m][e] = 0.1;
+               }
+               tribol::registerNodalVelocities( m, &m_vx[m][0], &m_vy[m][0], nullptr );
+               tribol::registerRealElementField( m, tribol::ELEMENT_THICKNESS, &m_thickness[m][0] );
+            }
+         }
+
+         tribol::registerCouplingScheme( s, m1, m2,
+                                         tribol::SURFACE_TO_SURFACE,
+                                         tribol::NO_CASE,
+                                         tribol::COMMON_PLANE,
+                                         tribol::FRICTIONLESS,
+                                         tribol::PENALTY,
+                                         tribol::BINNING_GRID,
+                                         tribol::ExecutionMode::Sequential );
+
+         tribol::setPenaltyOptions( s, tribol::KINEMATIC, tribol::KINEMATIC_CONSTANT );
+         tribol::setContactAreaFrac( s, 1.e-4 );
+         tribol::enableSchemeBatching( s, batch );
+         tribol::enableTimestepVote( s, s == vote_scheme );
+      }
+
+      int err = tribol::update( 1, 1., dt );
+      EXPECT_EQ( err, 0 );
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( SchemeBatchingTest, batched_forces_match )
+{
+   // unbatched reference solution
+   RealT dt_ref = 1.;
+   setupAndUpdate( false, dt_ref );
+
+   RealT fy_ref[2*numSchemes][numNodes];
+   int num_active_ref[numSchemes];
+   RealT force_sum = 0.;
+   for (int m = 0; m < 2*numSchemes; ++m)
+   {
+      for (int i = 0; i < numNodes; ++i)
+      {
+         fy_ref[m][i] = m_fy[m][i];
+         force_sum += std::abs( m_fy[m][i] );
+      }
+   }
+   for (int s = 0; s < numSchemes; ++s)
+   {
+      num_active_ref[s] = tribol::CouplingSchemeManager::getInstance().at( s ).getNumActivePairs();
+      EXPECT_GT( num_active_ref[s], 0 );
+   }
+   EXPECT_GT( force_sum, 0. );
+   tribol::finalize();
+
+   RealT dt = 1.;
+   setupAndUpdate( true, dt );
+
+   for (int s = 0; s < numSchemes; ++s)
+   {
+      EXPECT_EQ( tribol::CouplingSchemeManager::getInstance().at( s ).getNumActivePairs(), 
+                 num_active_ref[s] );
+   }
+   for (int m = 0; m < 2*numSchemes; ++m)
+   {
+      for (int i = 0; i < numNodes; ++i)
+      {
+         EXPECT_NEAR( m_fy[m][i], fy_ref[m][i], 1.e-12 );
+      }
+   }
+}
+
+TEST_F( SchemeBatchingTest, batched_timestep_vote_matches )
+{
+   // only one coupling scheme votes, so the unbatched vote does not depend on
+   // the timestep reduced by the coupling schemes before it
+   const int vote_scheme = numSchemes - 1;
+   RealT dt_ref = 1.;
+   setupAndUpdate( false, dt_ref, vote_scheme );
+   EXPECT_LT( dt_ref, 1. );
+   EXPECT_GT( dt_ref, 0. );
+
+   RealT fy_ref[2*numSchemes][numNodes];
+   for (int m = 0; m < 2*numSchemes; ++m)
+   {
+      for (int i = 0; i < numNodes; ++i)
+      {
+         fy_ref[m][i] = m_fy[m][i];
+      }
+   }
+   tribol::finalize();
+
+   RealT dt = 1.;
+   setupAndUpdate( true, dt, vote_scheme );
+   EXPECT_TRUE( tribol::canBatchPhysics( { &tribol::CouplingSchemeManager::getInstance().at( 0 ),
+                                           &tribol::CouplingSchemeManager::getInstance().at( 1 ) } ) );
+   EXPECT_NEAR( dt, dt_ref, 1.e-12 );
+   for (int m = 0; m < 2*numSchemes; ++m)
+   {
+      for (int i = 0; i < numNodes; ++i)
+      {
+         EXPECT_NEAR( m_fy[m][i], fy_ref[m][i], 1.e-12 );
+      }
+   }
+}
+
+TEST_F( SchemeBatchingTest, incompatible_schemes )
+{
+   RealT dt = 1.;
+   setupAndUpdate( true, dt );
+
+   auto& cs_manager = tribol::CouplingSchemeManager::getInstance();
+   EXPECT_TRUE( tribol::canBatchCouplingSchemes( cs_manager.at( 0 ), cs_manager.at( 1 ) ) );
+
+   tribol::enableSchemeBatching( 1, false );
+   EXPECT_FALSE( tribol::canBatchCouplingSchemes( cs_manager.at( 0 ), cs_manager.at( 1 ) ) );
+
+   // pair coloring scatters without atomics, so it is not batched
+   EXPECT_TRUE( tribol::canBatchPhysics( { &cs_manager.at( 0 ), &cs_manager.at( 1 ) } ) );
+   tribol::enablePairColoring( 1, true );
+   EXPECT_FALSE( tribol::canBatchPhysics( { &cs_manager.at( 0 ), &cs_manager.at( 1 ) } ) );
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
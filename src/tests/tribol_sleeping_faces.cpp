@@ -0,0 +1,232 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/utils/TestUtils.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/search/SleepingFaces.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <cmath>
+#include <vector>
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test sleeping faces in the
+ * BVH search
+ */
+class SleepingFacesTest : public ::testing::Test
+{
+
+public:
+
+   tribol::TestMesh m_mesh;
+
+   void setupAndUpdate()
+   {
+      // the second block overhangs the first block in x; its faces with
+      // x > 1.4 are far from the first block
+      int err = this->m_mesh.setupPenaltyBlocksAndUpdate( tribol::COMMON_PLANE, 5, 
+                                                          0.6, 2.6 );
+      EXPECT_EQ( err, 0 );
+   }
+
+   void translateMortarBlock( RealT dx )
+   {
+      for (int n{0}; n < this->m_mesh.numMortarNodes; ++n)
+      {
+         this->m_mesh.x[n] += dx;
+      }
+   }
+
+   void rotateMortarBlock( RealT angle )
+   {
+      // rotation about the z axis through the center of the block
+      const RealT c = std::cos( angle );
+      const RealT s = std::sin( angle );
+      for (int n{0}; n < this->m_mesh.numMortarNodes; ++n)
+      {
+         const RealT x = this->m_mesh.x[n] - 0.5;
+         const RealT y = this->m_mesh.y[n] - 0.5;
+         this->m_mesh.x[n] = 0.5 + c * x - s * y;
+         this->m_mesh.y[n] = 0.5 + s * x + c * y;
+      }
+   }
+
+   void shearNonmortarBlock( RealT gamma )
+   {
+      for (int n{this->m_mesh.numMortarNodes}; n < this->m_mesh.numTotalNodes; ++n)
+      {
+         this->m_mesh.x[n] += gamma * this->m_mesh.y[n];
+      }
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      // call clear() on mesh object to be safe
+      this->m_mesh.clear();
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( SleepingFacesTest, pairs_match_full_query )
+{
+   setupAndUpdate();
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   cs.setBinningMethod( tribol::BINNING_BVH );
+
+   // forces and pairs from a BVH update querying every face
+   this->m_mesh.zeroForces();
+   RealT dt = 1.;
+   tribol::update( 1, 1., dt );
+   const tribol::IndexT num_pairs = cs.getNumActivePairs();
+   EXPECT_GT( num_pairs, 0 );
+
+   const int num_nodes = this->m_mesh.numTotalNodes;
+   std::vector<RealT> fz1( this->m_mesh.fz1, this->m_mesh.fz1 + num_nodes );
+   std::vector<RealT> fz2( this->m_mesh.fz2, this->m_mesh.fz2 + num_nodes );
+
+   tribol::setSleepingFaceMargin( 0, 0.1 );
+
+   RealT tol = 1.e-12;
+   for (int cycle{2}; cycle <= 4; ++cycle)
+   {
+      this->m_mesh.zeroForces();
+      tribol::update( cycle, cycle, dt );
+
+      // the 15 faces with x > 1.4 sleep after the first search and are no
+      // longer queried; the active pairs and forces are unchanged
+      auto& data = cs.getSleepingFaceData();
+      EXPECT_EQ( data.m_num_sleeping, 15 );
+      EXPECT_EQ( data.m_num_queried, (cycle == 2) ? 25 : 10 );
+      EXPECT_EQ( cs.getNumActivePairs(), num_pairs );
+      for (int n{0}; n < num_nodes; ++n)
+      {
+         EXPECT_NEAR( this->m_mesh.fz1[n], fz1[n], tol );
+         EXPECT_NEAR( this->m_mesh.fz2[n], fz2[n], tol );
+      }
+   }
+}
+
+TEST_F( SleepingFacesTest, faces_wake_on_motion )
+{
+   setupAndUpdate();
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   cs.setBinningMethod( tribol::BINNING_BVH );
+   tribol::setSleepingFaceMargin( 0, 0.1 );
+
+   RealT dt = 1.;
+   this->m_mesh.zeroForces();
+   tribol::update( 1, 1., dt );
+   auto& data = cs.getSleepingFaceData();
+   EXPECT_EQ( data.m_num_sleeping, 15 );
+   EXPECT_EQ( data.m_num_epochs, 1 );
+
+   // motion within the margin keeps the faces asleep
+   translateMortarBlock( 0.06 );
+   this->m_mesh.zeroForces();
+   tribol::update( 2, 2., dt );
+   EXPECT_EQ( data.m_num_queried, 10 );
+   EXPECT_EQ( data.m_num_sleeping, 15 );
+
+   // motion past the margin wakes every sleeping face; the faces stay awake
+   // until a new epoch starts
+   translateMortarBlock( 0.06 );
+   this->m_mesh.zeroForces();
+   tribol::update( 3, 3., dt );
+   EXPECT_EQ( data.m_num_queried, 25 );
+   EXPECT_EQ( data.m_num_sleeping, 0 );
+
+   this->m_mesh.zeroForces();
+   tribol::update( 4, 4., dt );
+   EXPECT_EQ( data.m_num_epochs, 2 );
+   EXPECT_EQ( data.m_num_queried, 25 );
+   EXPECT_EQ( data.m_num_sleeping, 15 );
+}
+
+TEST_F( SleepingFacesTest, faces_wake_on_rotation_and_shear )
+{
+   setupAndUpdate();
+   auto& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   cs.setBinningMethod( tribol::BINNING_BVH );
+   tribol::setSleepingFaceMargin( 0, 0.1 );
+
+   RealT dt = 1.;
+   this->m_mesh.zeroForces();
+   tribol::update( 1, 1., dt );
+   auto& data = cs.getSleepingFaceData();
+   EXPECT_EQ( data.m_num_sleeping, 15 );
+
+   // small rotation and shear keep the faces asleep
+   rotateMortarBlock( 0.02 );
+   shearNonmortarBlock( 0.02 );
+   this->m_mesh.zeroForces();
+   tribol::update( 2, 2., dt );
+   EXPECT_EQ( data.m_num_queried, 10 );
+   EXPECT_EQ( data.m_num_sleeping, 15 );
+
+   // a larger rotation moves the mesh 1 boxes past the margin and wakes the 
+   // sleeping faces
+   rotateMortarBlock( 0.15 );
+   this->m_mesh.zeroForces();
+   tribol::update( 3, 3., dt );
+   EXPECT_EQ( data.m_num_queried, 25 );
+   EXPECT_EQ( data.m_num_sleeping, 0 );
+
+   // a new epoch puts the far faces back to sleep. the sleeping faces miss
+   // no pairs after a shear: a search querying every face gives the same 
+   // pairs and forces
+   this->m_mesh.zeroForces();
+   tribol::update( 4, 4., dt );
+   EXPECT_EQ( data.m_num_epochs, 2 );
+   EXPECT_GT( data.m_num_sleeping, 0 );
+   shearNonmortarBlock( -0.04 );
+   this->m_mesh.zeroForces();
+   tribol::update( 5, 5., dt );
+   EXPECT_LT( data.m_num_queried, 25 );
+   const tribol::IndexT num_pairs = cs.getNumActivePairs();
+   const int num_nodes = this->m_mesh.numTotalNodes;
+   std::vector<RealT> fz1( this->m_mesh.fz1, this->m_mesh.fz1 + num_nodes );
+   std::vector<RealT> fz2( this->m_mesh.fz2, this->m_mesh.fz2 + num_nodes );
+
+   tribol::setSleepingFaceMargin( 0, 0. );
+   this->m_mesh.zeroForces();
+   tribol::update( 6, 6., dt );
+   EXPECT_EQ( cs.getNumActivePairs(), num_pairs );
+   RealT tol = 1.e-12;
+   for (int n{0}; n < num_nodes; ++n)
+   {
+      EXPECT_NEAR( this->m_mesh.fz1[n], fz1[n], tol );
+      EXPECT_NEAR( this->m_mesh.fz2[n], fz2[n], tol );
+   }
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
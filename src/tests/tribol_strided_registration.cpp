@@ -0,0 +1,212 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/MeshData.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <cmath> // std::abs
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test registration of 
+ * component-wise, interleaved, and blocked nodal data for a 2D COMMON_PLANE +
+ * PENALTY coupling scheme
+ */
+class StridedRegistrationTest : public ::testing::Test
+{
+
+public:
+
+   enum Layout
+   {
+      COMPONENTS,  // separate x and y pointers
+      INTERLEAVED, // xyxy...
+      BLOCKED      // xx...yy...
+   };
+
+   static constexpr int numEdges = 4;
+   static constexpr int numNodes = numEdges + 1;
+   static constexpr int dim = 2;
+
+   RealT m_coords[2][dim*numNodes];
+   RealT m_vel[2][dim*numNodes];
+   RealT m_force[2][dim*numNodes];
+   tribol::IndexT m_conn[2][2*numEdges];
+
+   /// Offset of component d of node i in the given layout
+   static int offset( Layout layout, int i, int d )
+   {
+      return (layout == INTERLEAVED) ? dim*i + d : d*numNodes + i;
+   }
+
+   /// Registers a pair of interpenetrating edge meshes with the given layout
+   void setupAndUpdate( Layout layout )
+   {
+      for (int m = 0; m < 2; ++m)
+      {
+         for (int i = 0; i < numNodes; ++i)
+         {
+            // mesh 0 edges point in the -x direction (upward normal), mesh 1 
+            // edges point in the +x direction (downward normal)
+            m_coords[m][offset(layout, i, 0)] = (m == 0) ? static_cast<RealT>(i) / numEdges 
+                                                         : 0.05 + static_cast<RealT>(i) / numEdges;
+            m_coords[m][offset(layout, i, 1)] = (m == 0) ? 0. : -0.01 * (i + 1);
+            m_vel[m][offset(layout, i, 0)] = 0.;
+            m_vel[m][offset(layout, i, 1)] = (m == 0) ? -0.1 : 0.1;
+            m_force[m][offset(layout, i, 0)] = 0.;
+            m_force[m][offset(layout, i, 1)] = 0.;
+         }
+         for (int e = 0; e < numEdges; ++e)
+         {
+            m_conn[m][2*e] = (m == 0) ? e+1 : e;
+            m_conn[m][2*e+1] = (m == 0) ? e : e+1;
+         }
+
+         if (layout == COMPONENTS)
+         {
+            tribol::registerMesh( m, numEdges, numNodes, &m_conn[m][0], (int)(tribol::LINEAR_EDGE),
+                                  &m_coords[m][0], &m_coords[m][numNodes], nullptr, 
+                                  tribol::MemorySpace::Host );
+            tribol::registerNodalVelocities( m, &m_vel[m][0], &m_vel[m][numNodes], nullptr );
+            tribol::registerNodalResponse( m, &m_force[m][0], &m_force[m][numNodes], nullptr );
+         }
+         else
+         {
+            const tribol::IndexT node_stride = (layout == INTERLEAVED) ? dim : 1;
+            const tribol::IndexT component_stride = (layout == INTERLEAVED) ? 1 : numNodes;
+            tribol::registerStridedMesh( m, numEdges, numNodes, &m_conn[m][0], (int)(tribol::LINEAR_EDGE),
+                                         &m_coords[m][0], node_stride, component_stride,
+                                         tribol::MemorySpace::Host );
+            tribol::registerStridedNodalVelocities( m, &m_vel[m][0], node_stride, component_stride );
+            tribol::registerStridedNodalResponse( m, &m_force[m][0], node_stride, component_stride );
+         }
+         tribol::setKinematicConstantPenalty( m, 1. );
+         tribol::setRateConstantPenalty( m, 0.5 );
+      }
+
+      tribol::registerCouplingScheme( 0, 0, 1,
+                                      tribol::SURFACE_TO_SURFACE,
+                                      tribol::NO_CASE,
+                                      tribol::COMMON_PLANE,
+                                      tribol::FRICTIONLESS,
+                                      tribol::PENALTY,
+                                      tribol::BINNING_GRID,
+                                      tribol::ExecutionMode::Sequential );
+
+      tribol::setPenaltyOptions( 0, tribol::KINEMATIC_AND_RATE, tribol::KINEMATIC_CONSTANT,
+                                 tribol::RATE_CONSTANT );
+      tribol::setContactAreaFrac( 0, 1.e-4 );
+
+      RealT dt = 1.;
+      int err = tribol::update( 1, 1., dt );
+      EXPECT_EQ( err, 0 );
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( StridedRegistrationTest, strided_forces_match )
+{
+   // component-wise reference solution
+   setupAndUpdate( COMPONENTS );
+
+   RealT force_ref[2][dim][numNodes];
+   RealT force_sum = 0.;
+   for (int m = 0; m < 2; ++m)
+   {
+      for (int i = 0; i < numNodes; ++i)
+      {
+         for (int d = 0; d < dim; ++d)
+         {
+            force_ref[m][d][i] = m_force[m][offset(COMPONENTS, i, d)];
+            force_sum += std::abs( force_ref[m][d][i] );
+         }
+      }
+   }
+   EXPECT_GT( force_sum, 0. );
+   const int num_active_ref = tribol::CouplingSchemeManager::getInstance().at( 0 ).getNumActivePairs();
+   EXPECT_GT( num_active_ref, 0 );
+   tribol::finalize();
+
+   RealT tol = 1.e-12;
+   for (Layout layout : {INTERLEAVED, BLOCKED})
+   {
+      setupAndUpdate( layout );
+
+      EXPECT_EQ( tribol::CouplingSchemeManager::getInstance().at( 0 ).getNumActivePairs(), 
+                 num_active_ref );
+      for (int m = 0; m < 2; ++m)
+      {
+         for (int i = 0; i < numNodes; ++i)
+         {
+            for (int d = 0; d < dim; ++d)
+            {
+               EXPECT_NEAR( m_force[m][offset(layout, i, d)], force_ref[m][d][i], tol );
+            }
+         }
+      }
+      tribol::finalize();
+   }
+}
+
+TEST_F( StridedRegistrationTest, face_coords_match_nodal_data )
+{
+   setupAndUpdate( INTERLEAVED );
+
+   // the face-major cache built during the update matches the registered data
+   for (int m = 0; m < 2; ++m)
+   {
+      auto mesh = tribol::MeshManager::getInstance().at( m ).getView();
+      for (int e = 0; e < numEdges; ++e)
+      {
+         RealT xf[dim*2];
+         RealT vf[dim*2];
+         mesh.getFaceCoords( e, xf );
+         mesh.getFaceVelocities( e, vf );
+         for (int a = 0; a < 2; ++a)
+         {
+            const int node_id = m_conn[m][2*e+a];
+            for (int d = 0; d < dim; ++d)
+            {
+               EXPECT_EQ( xf[dim*a+d], m_coords[m][offset(INTERLEAVED, node_id, d)] );
+               EXPECT_EQ( vf[dim*a+d], m_vel[m][offset(INTERLEAVED, node_id, d)] );
+            }
+         }
+      }
+   }
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
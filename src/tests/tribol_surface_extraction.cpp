@@ -0,0 +1,166 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+// Tribol includes
+#include "tribol/interface/tribol.hpp"
+#include "tribol/utils/TestUtils.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/MeshData.hpp"
+#include "tribol/mesh/SurfaceExtraction.hpp"
+
+// Axom includes
+#include "axom/slic.hpp"
+
+// gtest includes
+#include "gtest/gtest.h"
+
+// c++ includes
+#include <vector>
+
+using RealT = tribol::RealT;
+
+/*!
+ * Test fixture class with some setup necessary to test
+ * contact surface extraction from TestMesh volume meshes
+ */
+class SurfaceExtractionTest : public ::testing::Test
+{
+
+public:
+
+   tribol::TestMesh m_mesh;
+
+   int m_n {2}; ///< number of elements in each direction of each block
+
+   void setupMesh( bool tet )
+   {
+      this->m_mesh.mortarMeshId = 0;
+      this->m_mesh.nonmortarMeshId = 1;
+      if (tet)
+      {
+         this->m_mesh.setupContactMeshTet( m_n, m_n, m_n, 0., 0., 0., 1., 1., 1.,
+                                           m_n, m_n, m_n, 0., 0., 0.95, 1., 1., 2.,
+                                           0., 0. );
+      }
+      else
+      {
+         this->m_mesh.setupContactMeshHex( m_n, m_n, m_n, 0., 0., 0., 1., 1., 1.,
+                                           m_n, m_n, m_n, 0., 0., 0.95, 1., 1., 2.,
+                                           0., 0. );
+      }
+   }
+
+protected:
+
+   void SetUp() override
+   {
+   }
+
+   void TearDown() override
+   {
+      this->m_mesh.clear();
+      tribol::finalize();
+   }
+
+};
+
+TEST_F( SurfaceExtractionTest, hex_block_surface )
+{
+   setupMesh( false );
+
+   auto conn = tribol::extractSurfaceFaces( this->m_mesh.numMortarElements,
+                                            this->m_mesh.elConn1, tribol::LINEAR_HEX,
+                                            this->m_mesh.x, this->m_mesh.y, this->m_mesh.z );
+
+   // six sides with n x n quads each
+   EXPECT_EQ( conn.shape()[0], 6 * m_n * m_n );
+   EXPECT_EQ( conn.shape()[1], 4 );
+
+   // all outward normals point away from the block center
+   const RealT* x = this->m_mesh.x;
+   const RealT* y = this->m_mesh.y;
+   const RealT* z = this->m_mesh.z;
+   for (tribol::IndexT f = 0; f < conn.shape()[0]; ++f)
+   {
+      RealT c[3] = {0., 0., 0.};
+      for (int a = 0; a < 4; ++a)
+      {
+         c[0] += 0.25 * x[conn(f, a)];
+         c[1] += 0.25 * y[conn(f, a)];
+         c[2] += 0.25 * z[conn(f, a)];
+      }
+      RealT e1[3] = { x[conn(f, 1)] - x[conn(f, 0)], y[conn(f, 1)] - y[conn(f, 0)], z[conn(f, 1)] - z[conn(f, 0)] };
+      RealT e2[3] = { x[conn(f, 3)] - x[conn(f, 0)], y[conn(f, 3)] - y[conn(f, 0)], z[conn(f, 3)] - z[conn(f, 0)] };
+      RealT n[3] = { e1[1]*e2[2] - e1[2]*e2[1], e1[2]*e2[0] - e1[0]*e2[2], e1[0]*e2[1] - e1[1]*e2[0] };
+      RealT outward = n[0] * (c[0] - 0.5) + n[1] * (c[1] - 0.5) + n[2] * (c[2] - 0.5);
+      EXPECT_GT( outward, 0. );
+   }
+}
+
+TEST_F( SurfaceExtractionTest, hex_face_attribute_filter )
+{
+   setupMesh( false );
+
+   // tag each local face with its local face id; local face 1 is the +z face
+   int num_elems = this->m_mesh.numMortarElements;
+   std::vector<int> attribs( 6 * num_elems );
+   for (int e = 0; e < num_elems; ++e)
+   {
+      for (int lf = 0; lf < 6; ++lf)
+      {
+         attribs[ 6 * e + lf ] = lf;
+      }
+   }
+
+   tribol::IndexT num_faces =
+      tribol::registerVolumeMeshSurface( 0, num_elems, this->m_mesh.numTotalNodes,
+                                         this->m_mesh.elConn1, tribol::LINEAR_HEX,
+                                         this->m_mesh.x, this->m_mesh.y, this->m_mesh.z,
+                                         attribs.data(), 1 );
+
+   EXPECT_EQ( num_faces, m_n * m_n );
+
+   auto& mesh = tribol::MeshManager::getInstance().at( 0 );
+   EXPECT_EQ( mesh.numberOfElements(), m_n * m_n );
+   EXPECT_EQ( mesh.getElementType(), tribol::LINEAR_QUAD );
+
+   mesh.computeFaceData( tribol::ExecutionMode::Sequential );
+   auto mesh_view = mesh.getView();
+   for (tribol::IndexT f = 0; f < mesh_view.numberOfElements(); ++f)
+   {
+      EXPECT_NEAR( mesh_view.getElementNormals()[2][f], 1., 1.e-12 );
+      EXPECT_NEAR( mesh_view.getElementCentroids()[2][f], 1., 1.e-12 );
+   }
+}
+
+TEST_F( SurfaceExtractionTest, tet_block_surface )
+{
+   setupMesh( true );
+
+   tribol::IndexT num_faces =
+      tribol::registerVolumeMeshSurface( 1, this->m_mesh.numNonmortarElements,
+                                         this->m_mesh.numTotalNodes,
+                                         this->m_mesh.elConn2, tribol::LINEAR_TET,
+                                         this->m_mesh.x, this->m_mesh.y, this->m_mesh.z );
+
+   // six sides with n x n quads, each split into two triangles
+   EXPECT_EQ( num_faces, 12 * m_n * m_n );
+
+   auto& mesh = tribol::MeshManager::getInstance().at( 1 );
+   EXPECT_EQ( mesh.getElementType(), tribol::LINEAR_TRIANGLE );
+   EXPECT_TRUE( mesh.computeFaceData( tribol::ExecutionMode::Sequential ) );
+}
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+  result = RUN_ALL_TESTS();
+
+  return result;
+}
@@ -516,6 +516,58 @@ TEST_F( CommonPlaneTest, large_velocity_small_gap )
    RealT dt_tol = 1.e-8;
    EXPECT_LT( dt_diff, dt_tol );
 
+   // recompute the vote storing per-pair and per-node critical timesteps
+   tribol::enableTimestepVoteDetails( 0, true );
+   RealT dt_detail = dt;
+   tribol::update( 1, 1., dt_detail );
+   EXPECT_LT( std::abs(dt_detail - dt_vote), dt_tol );
+
+   const tribol::ArrayT<RealT>* pair_dt = nullptr;
+   const tribol::ArrayT<RealT>* node_dt1 = nullptr;
+   const tribol::ArrayT<tribol::IndexT>* histogram = nullptr;
+   int details_err = tribol::getTimestepVoteDetails( 0, &pair_dt, nullptr, 
+                                                     &node_dt1, nullptr, &histogram );
+   EXPECT_EQ( details_err, 0 );
+
+   tribol::CouplingScheme& cs = tribol::CouplingSchemeManager::getInstance().at( 0 );
+   EXPECT_EQ( pair_dt->size(), cs.getNumActivePairs() );
+
+   // the smallest pair and node critical timesteps match the vote and every
+   // restricting pair is counted in the histogram
+   RealT min_pair_dt = dt;
+   tribol::IndexT num_restricting = 0;
+   for (auto pdt : *pair_dt)
+   {
+      min_pair_dt = std::min( min_pair_dt, pdt );
+      num_restricting += (pdt < dt) ? 1 : 0;
+   }
+   RealT min_node_dt = dt;
+   for (auto ndt : *node_dt1)
+   {
+      min_node_dt = std::min( min_node_dt, ndt );
+   }
+   tribol::IndexT num_binned = 0;
+   for (auto count : *histogram)
+   {
+      num_binned += count;
+   }
+   EXPECT_LT( std::abs(min_pair_dt - dt_vote), dt_tol );
+   EXPECT_LT( std::abs(min_node_dt - dt_vote), dt_tol );
+   EXPECT_GT( num_restricting, 0 );
+   EXPECT_EQ( num_binned, num_restricting );
+
+   // a cycle that skips the vote clears the details of the previous cycle
+   RealT dt_small = 1.e-9;
+   tribol::update( 2, 2., dt_small );
+   EXPECT_EQ( pair_dt->size(), 0 );
+   EXPECT_EQ( node_dt1->size(), 0 );
+   tribol::IndexT num_binned_skipped = 0;
+   for (auto count : *histogram)
+   {
+      num_binned_skipped += count;
+   }
+   EXPECT_EQ( num_binned_skipped, 0 );
+
    tribol::finalize();
 }
 
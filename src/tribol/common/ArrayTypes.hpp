@@ -58,16 +58,115 @@ template <typename T, MemorySpace SPACE = MemorySpace::Dynamic>
 using Array2DView = ArrayViewT<T, 2, SPACE>;
 
 /**
- * @brief Convenience definition for an array of array views
+ * @brief One-dimensional view of (i.e. non-owned) data with a constant stride
+ * between consecutive entries
+ *
+ * A stride of one corresponds to contiguous data. Larger strides allow views
+ * of a single component of interleaved data, e.g. the x-components of nodal 
+ * coordinates stored as xyzxyz...
  */
-template <typename T, MemorySpace SPACE = MemorySpace::Dynamic>
-using MultiArrayView = ArrayT<ArrayViewT<T, 1, SPACE>, 1, SPACE>;
+template <typename T>
+class StridedArrayView
+{
+public:
+  StridedArrayView() = default;
+
+  /**
+   * @brief Construct a new StridedArrayView object
+   * 
+   * @param data pointer to the first entry
+   * @param size number of entries
+   * @param stride distance (in number of T) between consecutive entries
+   */
+  TRIBOL_HOST_DEVICE StridedArrayView( T* data, IndexT size, IndexT stride = 1 )
+  : m_data( data )
+  , m_size( size )
+  , m_stride( stride )
+  {}
+
+  /**
+   * @brief Access the i-th entry
+   */
+  TRIBOL_HOST_DEVICE T& operator[]( IndexT i ) const { return m_data[i * m_stride]; }
+
+  /**
+   * @brief Pointer to the first entry
+   */
+  TRIBOL_HOST_DEVICE T* data() const { return m_data; }
+
+  /**
+   * @brief Number of entries
+   */
+  TRIBOL_HOST_DEVICE IndexT size() const { return m_size; }
+
+  /**
+   * @brief Distance (in number of T) between consecutive entries
+   */
+  TRIBOL_HOST_DEVICE IndexT stride() const { return m_stride; }
+
+  /**
+   * @brief Returns true if the view has no entries
+   */
+  TRIBOL_HOST_DEVICE bool empty() const { return m_size == 0; }
+
+private:
+  T* m_data {nullptr};
+  IndexT m_size {0};
+  IndexT m_stride {1};
+};
 
 /**
- * @brief Convenience definition for an array view of array views
+ * @brief View of (i.e. non-owned) components of a 2D or 3D vector field
+ *
+ * The component views are stored by value, so accessing an entry, e.g. 
+ * x[d][i], does not require a load of the component view from memory. Both
+ * component-wise (SoA) and interleaved (AoS) data are supported through the
+ * stride of the component views.
  */
-template <typename T, MemorySpace SPACE = MemorySpace::Dynamic>
-using MultiViewArrayView = ArrayViewT<const ArrayViewT<T, 1, SPACE>, 1, SPACE>;
+template <typename T>
+class VectorFieldView
+{
+public:
+  VectorFieldView() = default;
+
+  /**
+   * @brief Construct a new VectorFieldView object
+   * 
+   * @param dim number of components (2 or 3)
+   * @param x view of the x-components
+   * @param y view of the y-components
+   * @param z view of the z-components (ignored if dim == 2)
+   */
+  TRIBOL_HOST_DEVICE VectorFieldView( int dim,
+                                      const StridedArrayView<T>& x,
+                                      const StridedArrayView<T>& y,
+                                      const StridedArrayView<T>& z )
+  : m_components{ x, y, z }
+  , m_dim( dim )
+  {}
+
+  /**
+   * @brief Access the view of the d-th component
+   */
+  TRIBOL_HOST_DEVICE const StridedArrayView<T>& operator[]( int d ) const
+  {
+    return m_components[d];
+  }
+
+  /**
+   * @brief Number of components
+   */
+  TRIBOL_HOST_DEVICE int size() const { return m_dim; }
+
+  /**
+   * @brief Returns true if no components are set
+   */
+  TRIBOL_HOST_DEVICE bool empty() const { return m_dim == 0; }
+
+private:
+  StridedArrayView<T> m_components[3];
+  int m_dim {0};
+};
 
 } // namespace tribol
 
@@ -7,7 +7,10 @@
 #define SRC_COMMON_LOOPEXEC_HPP_
 
 // C++ includes
+#include <algorithm>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
 // Tribol includes
 #include "tribol/common/ExecModel.hpp"
@@ -187,6 +190,123 @@ void forAllExec(ExecutionMode exec_mode, IndexT N, BODY&& body)
   }
 }
 
+/**
+ * @brief Computes an exclusive prefix sum with the execution mode determined at run time
+ * 
+ * @tparam T Value type
+ * @param exec_mode Execution mode for the scan
+ * @param N Number of values
+ * @param in Input values, accessible in exec_mode
+ * @param out Output values, accessible in exec_mode; out[i] is the sum of in[0] to in[i-1]
+ *
+ * @note in and out must not overlap
+ */
+template <typename T>
+void exclusiveScanExec(ExecutionMode exec_mode, IndexT N, const T* in, T* out)
+{
+  if (N <= 0)
+  {
+    return;
+  }
+  switch (exec_mode)
+  {
+    case ExecutionMode::Sequential:
+    {
+#ifdef TRIBOL_USE_RAJA
+      RAJA::exclusive_scan<RAJA::seq_exec>(RAJA::make_span(in, N), RAJA::make_span(out, N));
+#else
+      T sum {0};
+      for (IndexT i{0}; i < N; ++i)
+      {
+        const T val = in[i];
+        out[i] = sum;
+        sum += val;
+      }
+#endif
+      return;
+    }
+#ifdef TRIBOL_USE_OPENMP
+    case ExecutionMode::OpenMP:
+      RAJA::exclusive_scan<RAJA::omp_parallel_for_exec>(RAJA::make_span(in, N), RAJA::make_span(out, N));
+      return;
+#endif
+#ifdef TRIBOL_USE_CUDA
+    case ExecutionMode::Cuda:
+      RAJA::exclusive_scan<RAJA::cuda_exec<TRIBOL_BLOCK_SIZE>>(RAJA::make_span(in, N), RAJA::make_span(out, N));
+      return;
+#endif
+#ifdef TRIBOL_USE_HIP
+    case ExecutionMode::Hip:
+      RAJA::exclusive_scan<RAJA::hip_exec<TRIBOL_BLOCK_SIZE>>(RAJA::make_span(in, N), RAJA::make_span(out, N));
+      return;
+#endif
+    default:
+      SLIC_ERROR_ROOT("Unsupported execution mode in exclusiveScanExec.");
+      return;
+  }
+}
+
+/**
+ * @brief Stably sorts key-value pairs by key with the execution mode determined at run time
+ * 
+ * @tparam KEY Key type
+ * @tparam VALUE Value type
+ * @param exec_mode Execution mode for the sort
+ * @param N Number of pairs
+ * @param keys Keys, accessible in exec_mode; sorted in ascending order on return
+ * @param values Values, accessible in exec_mode; permuted with the keys
+ */
+template <typename KEY, typename VALUE>
+void stableSortPairsExec(ExecutionMode exec_mode, IndexT N, KEY* keys, VALUE* values)
+{
+  if (N <= 1)
+  {
+    return;
+  }
+  switch (exec_mode)
+  {
+    case ExecutionMode::Sequential:
+    {
+#ifdef TRIBOL_USE_RAJA
+      RAJA::stable_sort_pairs<RAJA::seq_exec>(RAJA::make_span(keys, N), RAJA::make_span(values, N));
+#else
+      std::vector<IndexT> perm(N);
+      std::iota(perm.begin(), perm.end(), 0);
+      std::stable_sort(perm.begin(), perm.end(), 
+        [keys](IndexT i, IndexT j) { return keys[i] < keys[j]; });
+      std::vector<KEY> sorted_keys(N);
+      std::vector<VALUE> sorted_values(N);
+      for (IndexT i{0}; i < N; ++i)
+      {
+        sorted_keys[i] = keys[perm[i]];
+        sorted_values[i] = values[perm[i]];
+      }
+      std::copy(sorted_keys.begin(), sorted_keys.end(), keys);
+      std::copy(sorted_values.begin(), sorted_values.end(), values);
+#endif
+      return;
+    }
+#ifdef TRIBOL_USE_OPENMP
+    case ExecutionMode::OpenMP:
+      RAJA::stable_sort_pairs<RAJA::omp_parallel_for_exec>(RAJA::make_span(keys, N), RAJA::make_span(values, N));
+      return;
+#endif
+#ifdef TRIBOL_USE_CUDA
+    case ExecutionMode::Cuda:
+      RAJA::stable_sort_pairs<RAJA::cuda_exec<TRIBOL_BLOCK_SIZE>>(RAJA::make_span(keys, N), RAJA::make_span(values, N));
+      return;
+#endif
+#ifdef TRIBOL_USE_HIP
+    case ExecutionMode::Hip:
+      RAJA::stable_sort_pairs<RAJA::hip_exec<TRIBOL_BLOCK_SIZE>>(RAJA::make_span(keys, N), RAJA::make_span(values, N));
+      return;
+#endif
+    default:
+      SLIC_ERROR_ROOT("Unsupported execution mode in stableSortPairsExec.");
+      return;
+  }
+}
+
 } // namespace tribol
 
 
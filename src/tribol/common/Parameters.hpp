@@ -121,6 +121,7 @@ enum ContactMethod // all mortar methods go first
   ALIGNED_MORTAR,     ///! Aligned mortar to be used with ContactCase = NO_SLIDING
   MORTAR_WEIGHTS,     ///! Method that only returns mortar weights per single mortar method
   COMMON_PLANE,       ///! Common plane method, currently with single integration point
+  NODE_TO_SURFACE,    ///! Node-to-surface method; mesh 2 nodes are projected onto mesh 1 faces
   NUM_CONTACT_METHODS
 };
 
@@ -163,10 +164,24 @@ enum BinningMethod
   BINNING_GRID,               ///! Uses a spatial index to compute the pairs
   BINNING_CARTESIAN_PRODUCT,  ///! Generates all element pairs between the meshes
   BINNING_BVH,                ///! Uses a bounding volume hierarchy tree to compute the pairs
+  BINNING_SWEEP_AND_PRUNE,    ///! Sorts edges along the dominant surface direction (2D LINEAR_EDGE meshes only)
+  BINNING_HASH_GRID,          ///! Uses a sparse, hashed uniform grid sized from the median element
+  BINNING_AUTO,               ///! Selects one of the above from mesh statistics and measured search times
   NUM_BINNING_METHODS,
   DEFAULT_BINNING_METHOD = BINNING_GRID
 };
 
+/*!
+ * \brief Enumerates the available analytic rigid surface types
+ */
+enum RigidSurfaceType
+{
+  RIGID_PLANE,     ///! Plane through a point with a given outward normal
+  RIGID_CYLINDER,  ///! Cylinder of given radius about an axis (circle in 2D)
+  RIGID_SPHERE,    ///! Sphere of given radius about a point (circle in 2D)
+  NUM_RIGID_SURFACE_TYPES
+};
+
 /*!
  * \brief Enumerates the available penalty enforcement options 
  */
@@ -356,6 +371,7 @@ enum MethodError
    SAME_MESH_IDS_INVALID_DIM,
    INVALID_DIM,
    NULL_NODAL_RESPONSE,
+   INVALID_RIGID_SURFACE_METHOD,
    NO_METHOD_ERROR,
    NUM_METHOD_ERRORS
 };
@@ -476,10 +492,18 @@ public:
     RealT auto_contact_pen_frac = 0.95;    ///! Max allowable interpenetration as percent of element thickness for contact candidacy
     RealT timestep_pen_frac     = 3.0e-1;  ///! Max allowable interpenetration as percent of element thickness prior to triggering timestep vote
     RealT timestep_scale        = 1.0;     ///! Scale factor (>0) applied to the timestep vote giving users some control over the vote
+    RealT sleeping_face_margin  = 0.0;     ///! Distance margin for skipping isolated mesh 2 faces in the BVH query (0 disables sleeping faces)
+    RealT overlap_cache_ratio   = 0.0;     ///! Ratio of the largest face radius bounding relative face motion for reusing cached common plane overlaps (0 disables the cache)
 
     int vis_cycle_incr          = 100;     ///! Frequency for visualizations dumps
+    int auto_binning_interval   = 50;      ///! Number of searches between timed trials of alternative methods with BINNING_AUTO (0 disables trials)
+    int load_balance_interval   = 0;       ///! Number of cycles between cross-rank load balance diagnostics (0 disables diagnostics)
+    IndexT candidate_budget     = 0;       ///! Target number of unfiltered candidate pairs per BVH query chunk (0 disables the budget)
+    IndexT contact_plane_budget = 0;       ///! Number of contact planes allocated at once; planes are computed in chunks of pairs (0 disables the budget)
     VisType vis_type            = VIS_OVERLAPS; ///! Type of interface physics visualization output
     bool enable_timestep_vote   = false;   ///! True if host-code desires the timestep vote to be calculated and returned
+    bool enable_pair_coloring   = false;   ///! True if nodal scatter kernels process face-pairs by color instead of with atomics
+    bool enable_scheme_batching = false;   ///! True if the coupling scheme may share the contact plane kernel launch with compatible coupling schemes
 
     bool auto_interpen_check    = false;   ///! True if the auto-contact interpenetration check is used for full-overlap pairs
 
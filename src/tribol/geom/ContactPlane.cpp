@@ -34,7 +34,8 @@ TRIBOL_HOST_DEVICE FaceGeomError CheckInterfacePair( InterfacePair& pair,
                                                      bool& isInteracting,
                                                      ArrayViewT<ContactPlane2D>& planes_2d,
                                                      ArrayViewT<ContactPlane3D>& planes_3d,
-                                                     IndexT* plane_ct )
+                                                     IndexT* plane_ct,
+                                                     OverlapCacheEntry* cache_entry )
 {
   isInteracting = false;
 
@@ -58,7 +59,32 @@ TRIBOL_HOST_DEVICE FaceGeomError CheckInterfacePair( InterfacePair& pair,
       {
 
         ContactPlane3D cpTemp( &pair, params.overlap_area_frac, interpenOverlap, intermediatePlane);
-        FaceGeomError face_err = CheckFacePair( cpTemp, mesh1, mesh2, params, full );
+        FaceGeomError face_err = NO_FACE_GEOM_ERROR;
+
+        // reuse the cached overlap polygon of a common plane pair if the faces 
+        // have not moved relative to each other
+        const bool use_cache = (cache_entry != nullptr && intermediatePlane);
+        bool cache_hit = false;
+        if (use_cache)
+        {
+          cache_hit = CheckCachedFacePair( cpTemp, mesh1, mesh2, params, *cache_entry, face_err );
+          cache_entry->m_hit = cache_hit;
+        }
+        if (!cache_hit)
+        {
+          face_err = CheckFacePair( cpTemp, mesh1, mesh2, params, full );
+          if (use_cache)
+          {
+            if (face_err == NO_FACE_GEOM_ERROR && cpTemp.m_inContact)
+            {
+              CacheFacePairOverlap( cpTemp, mesh1, mesh2, *cache_entry );
+            }
+            else
+            {
+              cache_entry->m_numPolyVert = 0;
+            }
+          }
+        }
 
 
         if (face_err != NO_FACE_GEOM_ERROR)
@@ -147,6 +173,46 @@ TRIBOL_HOST_DEVICE FaceGeomError CheckInterfacePair( InterfacePair& pair,
       break;
     }
 
+    case NODE_TO_SURFACE:
+    {
+      // no overlap computations; the nodes of face 2 are checked against face 1
+      if (mesh1.spatialDimension() == 3)
+      {
+        ContactPlane3D cpTemp( &pair, params.overlap_area_frac, false, false );
+        CheckNodeToSurfacePair( cpTemp, mesh1, mesh2, params );
+
+        if (cpTemp.m_inContact)
+        {
+#ifdef TRIBOL_USE_RAJA
+          auto idx = RAJA::atomicInc<RAJA::auto_atomic>(plane_ct);
+#else
+          auto idx = (*plane_ct);
+          ++(*plane_ct);
+#endif
+          planes_3d[idx] = std::move(cpTemp);
+          isInteracting = true;
+        }
+      }
+      else
+      {
+        ContactPlane2D cpTemp( &pair, params.overlap_area_frac, false, false );
+        CheckNodeToSurfacePair( cpTemp, mesh1, mesh2, params );
+
+        if (cpTemp.m_inContact)
+        {
+#ifdef TRIBOL_USE_RAJA
+          auto idx = RAJA::atomicInc<RAJA::auto_atomic>(plane_ct);
+#else
+          auto idx = (*plane_ct);
+          ++(*plane_ct);
+#endif
+          planes_2d[idx] = std::move(cpTemp);
+          isInteracting = true;
+        }
+      }
+      return NO_FACE_GEOM_ERROR;
+    }
+
     default:
     {
       // don't do anything
@@ -337,6 +403,78 @@ TRIBOL_HOST_DEVICE bool ExceedsMaxAutoInterpen( const MeshData::Viewer& mesh1,
    return false;
 }
 
+//------------------------------------------------------------------------------
+TRIBOL_HOST_DEVICE bool ProjectNodeToFace( const MeshData::Viewer& mesh,
+                                           IndexT faceId,
+                                           const RealT* x,
+                                           RealT* xp,
+                                           RealT& gap )
+{
+   constexpr int max_dim = 3;
+   constexpr int max_nodes_per_face = 4;
+
+   // relative tolerance on the in-face check so that nodes projecting onto 
+   // shared edges and vertices are not missed
+   constexpr RealT in_face_tol = 1.e-8;
+
+   const int dim = mesh.spatialDimension();
+   const int num_nodes = mesh.numberOfNodesPerElement();
+
+   RealT nrml[max_dim];
+   mesh.getFaceNormal( faceId, nrml );
+
+   // signed distance along the face normal from the face centroid
+   gap = 0.;
+   for (int d{0}; d < dim; ++d)
+   {
+      gap += (x[d] - mesh.getElementCentroids()[d][faceId]) * nrml[d];
+   }
+
+   for (int d{0}; d < dim; ++d)
+   {
+      xp[d] = x[d] - gap * nrml[d];
+   }
+
+   RealT xf[max_dim * max_nodes_per_face];
+   mesh.getFaceCoords( faceId, xf );
+
+   if (dim == 2)
+   {
+      // segment parameter of the projected point
+      RealT eX = xf[2] - xf[0];
+      RealT eY = xf[3] - xf[1];
+      RealT e_sq = eX * eX + eY * eY;
+      RealT s = ((xp[0] - xf[0]) * eX + (xp[1] - xf[1]) * eY) / e_sq;
+      return (s >= -in_face_tol && s <= 1. + in_face_tol);
+   }
+
+   // the projected point is inside if it is on the interior side of every edge
+   for (int a{0}; a < num_nodes; ++a)
+   {
+      int b = (a == num_nodes - 1) ? 0 : a + 1;
+      RealT e[max_dim];
+      RealT w[max_dim];
+      for (int d{0}; d < max_dim; ++d)
+      {
+         e[d] = xf[max_dim*b + d] - xf[max_dim*a + d];
+         w[d] = xp[d] - xf[max_dim*a + d];
+      }
+
+      // (e x w) . n
+      RealT side = (e[1] * w[2] - e[2] * w[1]) * nrml[0]
+                 + (e[2] * w[0] - e[0] * w[2]) * nrml[1]
+                 + (e[0] * w[1] - e[1] * w[0]) * nrml[2];
+
+      if (side < -in_face_tol * (e[0] * e[0] + e[1] * e[1] + e[2] * e[2]))
+      {
+         return false;
+      }
+   }
+
+   return true;
+
+} // end ProjectNodeToFace()
+
 //------------------------------------------------------------------------------
 TRIBOL_HOST_DEVICE void ProjectFaceNodesToPlane( const MeshData::Viewer& mesh, int faceId, 
                                                  RealT nrmlX, RealT nrmlY, RealT nrmlZ,
@@ -429,13 +567,204 @@ TRIBOL_HOST_DEVICE ContactPlane3D::ContactPlane3D( InterfacePair* pair,
   , m_numPolyVert( 0 )
   , m_overlapCX( 0.0 )
   , m_overlapCY( 0.0 )
-{}
+{
+   m_polyLoc.clear();
+}
 
 //------------------------------------------------------------------------------
 TRIBOL_HOST_DEVICE ContactPlane3D::ContactPlane3D()
   : ContactPlane3D( nullptr, 0.0, true, false )
 {}
 
+//------------------------------------------------------------------------------
+namespace
+{
+
+/*!
+ * \brief Finishes a 3D face-pair check from the overlap polygon in local
+ *        coordinates: transforms the polygon to global coordinates, relocates
+ *        the contact plane, computes the gap and applies the gap checks
+ */
+TRIBOL_HOST_DEVICE FaceGeomError FinishFacePair( ContactPlane3D& cp,
+                                                 const MeshData::Viewer& mesh1,
+                                                 const MeshData::Viewer& mesh2,
+                                                 const Parameters& params,
+                                                 bool fullOverlap )
+{
+   IndexT element_id1 = cp.getCpElementId1();
+   IndexT element_id2 = cp.getCpElementId2();
+
+   // handle the case where the actual polygon with connectivity 
+   // and computed vertex coordinates becomes degenerate due to 
+   // either position tolerances (segment-segment intersections) 
+   // or length tolerances (intersecting polygon segment lengths)
+   if (cp.m_numPolyVert < 3) 
+   {
+#ifdef TRIBOL_USE_HOST
+      SLIC_DEBUG( "degenerate polygon intersection detected.\n" );
+#endif
+      cp.m_inContact = false;
+      return DEGENERATE_OVERLAP;
+   }
+
+   cp.m_polyLoc.numVerts = cp.m_numPolyVert;
+   cp.m_polyLoc.pad();
+
+   // Tranform local vertex coordinates to global coordinates for the 
+   // current projection of the polygonal overlap
+   for (int i=0; i<cp.m_numPolyVert; ++i)
+   {
+      cp.m_polyX[i] = 0.0;
+      cp.m_polyY[i] = 0.0;
+      cp.m_polyZ[i] = 0.0;
+
+      cp.local2DToGlobalCoords( cp.m_polyLoc.x[i], cp.m_polyLoc.y[i], 
+                                cp.m_polyX[i], cp.m_polyY[i], 
+                                cp.m_polyZ[i] );
+   }
+
+   // check polygonal vertex ordering with common plane normal
+   PolyReorderWithNormal( cp.m_polyX, cp.m_polyY, cp.m_polyZ, cp.m_numPolyVert,
+                          cp.m_nX, cp.m_nY, cp.m_nZ );
+
+   // Now that all local-to-global projections have occurred,
+   // relocate the contact plane based on the most up-to-date 
+   // contact plane centroid and recompute the gap. For interpenOverlap, 
+   // the contact plane is updated and this just amounts to a gap 
+   // computation. For the fullOverlap case, this may relocate 
+   // the contact plane in space. For Mortar methods this routine 
+   // only computes the gap based on the current plane point and 
+   // normal.
+   // 
+   // Warning:
+   // Make sure that any local to global transformations have 
+   // occurred prior to this call. This does not need to be done 
+   // for mortar methods. We should just do a gap computation if 
+   // needed. 
+   cp.planePointAndCentroidGap( mesh1, mesh2, 2. * 
+      axom::utilities::max( mesh1.getFaceRadius()[ element_id1 ], 
+                            mesh2.getFaceRadius()[ element_id2 ] ));
+
+   // The gap tolerance allows separation up to the separation ratio of the 
+   // largest face-radius. This is conservative and allows for possible 
+   // over-inclusion. This is done for the mortar method per testing.
+   cp.m_gapTol = params.gap_separation_ratio * 
+                 axom::utilities::max( mesh1.getFaceRadius()[ element_id1 ], 
+                                       mesh2.getFaceRadius()[ element_id2 ] );
+
+   if (cp.m_gap > cp.m_gapTol)
+   {
+      cp.m_inContact = false;
+      return NO_FACE_GEOM_ERROR;
+   }
+
+   // for auto-contact, remove contact candidacy for full-overlap 
+   // face-pairs with interpenetration exceeding contact penetration fraction. 
+   // Note, this check is solely meant to exclude face-pairs composed of faces 
+   // on opposite sides of thin structures/plates
+   //
+   // Recall that interpen gaps are negative
+   if (fullOverlap)
+   {
+      if (ExceedsMaxAutoInterpen( mesh1, mesh2, element_id1, element_id2, 
+                                  params, cp.m_gap ))
+      {
+         cp.m_inContact = false;
+         return NO_FACE_GEOM_ERROR;
+      }
+   }
+   
+   // if fullOverlap is used, REPROJECT the overlapping polygon 
+   // onto the new contact plane 
+   if (fullOverlap)
+   {
+      for (int i=0; i<cp.m_numPolyVert; ++i)
+      {
+         ProjectPointToPlane( cp.m_polyX[i], cp.m_polyY[i], cp.m_polyZ[i], 
+                              cp.m_nX, cp.m_nY, cp.m_nZ,
+                              cp.m_cX, cp.m_cY, cp.m_cZ,
+                              cp.m_polyX[i], cp.m_polyY[i], cp.m_polyZ[i] );
+      }
+   }
+
+   cp.m_inContact = true;
+   return NO_FACE_GEOM_ERROR;
+
+} // end FinishFacePair()
+
+/*!
+ * \brief Computes the frame attached to a 3D face used by the overlap cache
+ *
+ * \param [in] mesh mesh data viewer
+ * \param [in] face_id face id
+ * \param [out] c face centroid
+ * \param [out] a1 unit in-plane axis toward the first face node
+ * \param [out] a2 unit in-plane axis, normal x a1
+ */
+TRIBOL_HOST_DEVICE void FaceFrame( const MeshData::Viewer& mesh, IndexT face_id,
+                                   RealT* c, RealT* a1, RealT* a2 )
+{
+   RealT n[3];
+   RealT xf[3*OverlapCacheEntry::max_nodes_per_elem];
+   mesh.getFaceCoords( face_id, xf );
+   for (int d=0; d<3; ++d)
+   {
+      c[d] = mesh.getElementCentroids()[d][face_id];
+      n[d] = mesh.getElementNormals()[d][face_id];
+      a1[d] = xf[d] - c[d];
+   }
+   const RealT proj = dotProd( a1[0], a1[1], a1[2], n[0], n[1], n[2] );
+   for (int d=0; d<3; ++d)
+   {
+      a1[d] -= proj * n[d];
+   }
+   const RealT mag = magnitude( a1[0], a1[1], a1[2] );
+   for (int d=0; d<3; ++d)
+   {
+      a1[d] /= mag;
+   }
+   crossProd( n[0], n[1], n[2], a1[0], a1[1], a1[2], a2[0], a2[1], a2[2] );
+} // end FaceFrame()
+
+/*!
+ * \brief Returns true if a nodal motion of a face since caching, relative to
+ *        the motion w, exceeds the tolerance
+ *
+ * \param [in] x_ref nodal coordinates of the face at caching time (node-major)
+ * \param [in] w reference motion subtracted from the nodal motion
+ * \param [in] n unit normal; the normal part of the motion is ignored if in_plane is true
+ */
+TRIBOL_HOST_DEVICE bool FaceMotionExceeds( const MeshData::Viewer& mesh, IndexT face_id,
+                                           const RealT* x_ref, const RealT* w,
+                                           const RealT* n, bool in_plane, RealT tol )
+{
+   RealT xf[3*OverlapCacheEntry::max_nodes_per_elem];
+   mesh.getFaceCoords( face_id, xf );
+   for (int a=0; a<mesh.numberOfNodesPerElement(); ++a)
+   {
+      RealT u[3];
+      for (int d=0; d<3; ++d)
+      {
+         u[d] = xf[3*a+d] - x_ref[3*a+d] - w[d];
+      }
+      if (in_plane)
+      {
+         const RealT proj = dotProd( u[0], u[1], u[2], n[0], n[1], n[2] );
+         for (int d=0; d<3; ++d)
+         {
+            u[d] -= proj * n[d];
+         }
+      }
+      if (magnitude( u[0], u[1], u[2] ) > tol)
+      {
+         return true;
+      }
+   }
+   return false;
+} // end FaceMotionExceeds()
+
+} // end anonymous namespace
+
 //------------------------------------------------------------------------------
 TRIBOL_HOST_DEVICE FaceGeomError CheckFacePair( ContactPlane3D& cp,
                                                 const MeshData::Viewer& mesh1,
@@ -567,8 +896,8 @@ TRIBOL_HOST_DEVICE FaceGeomError CheckFacePair( ContactPlane3D& cp,
       RealT len_tol = pos_tol;
       FaceGeomError inter_err = Intersection2DPolygon( X1, Y1, mesh1.numberOfNodesPerElement(),
                                                        X2, Y2, mesh2.numberOfNodesPerElement(),
-                                                       pos_tol, len_tol, cp.m_polyLocX, 
-                                                       cp.m_polyLocY, cp.m_numPolyVert, 
+                                                       pos_tol, len_tol, cp.m_polyLoc.x, 
+                                                       cp.m_polyLoc.y, cp.m_numPolyVert, 
                                                        cp.m_area, false ); 
 
       if (inter_err != NO_FACE_GEOM_ERROR)
@@ -623,135 +952,154 @@ TRIBOL_HOST_DEVICE FaceGeomError CheckFacePair( ContactPlane3D& cp,
 
       // compute the local vertex averaged centroid of overlapping polygon
       RealT z;
-      VertexAvgCentroid( cp.m_polyLocX, cp.m_polyLocY, nullptr, 
+      VertexAvgCentroid( cp.m_polyLoc.x, cp.m_polyLoc.y, nullptr, 
                          cp.m_numPolyVert, cp.m_overlapCX, 
                          cp.m_overlapCY, z );
 
    } // end if (interpenOverlap)
 
-   // handle the case where the actual polygon with connectivity 
-   // and computed vertex coordinates becomes degenerate due to 
-   // either position tolerances (segment-segment intersections) 
-   // or length tolerances (intersecting polygon segment lengths)
-   if (cp.m_numPolyVert < 3) 
-   {
-#ifdef TRIBOL_USE_HOST
-      SLIC_DEBUG( "degenerate polygon intersection detected.\n" );
-#endif
-      cp.m_inContact = false;
-      return DEGENERATE_OVERLAP;
-   }
+   return FinishFacePair( cp, mesh1, mesh2, params, fullOverlap );
 
-   // Tranform local vertex coordinates to global coordinates for the 
-   // current projection of the polygonal overlap
+} // end CheckFacePair()
+
+//------------------------------------------------------------------------------
+TRIBOL_HOST_DEVICE void CacheFacePairOverlap( const ContactPlane3D& cp,
+                                              const MeshData::Viewer& mesh1,
+                                              const MeshData::Viewer& mesh2,
+                                              OverlapCacheEntry& entry )
+{
+   const IndexT element_id1 = cp.getCpElementId1();
+   const IndexT element_id2 = cp.getCpElementId2();
+
+   entry.m_faceId1 = element_id1;
+   entry.m_faceId2 = element_id2;
+   entry.m_numPolyVert = cp.m_numPolyVert;
+   entry.m_fullOverlap = !cp.m_interpenOverlap;
+
+   // store the polygon in the frame attached to face 1
+   RealT c[3], a1[3], a2[3];
+   FaceFrame( mesh1, element_id1, c, a1, a2 );
    for (int i=0; i<cp.m_numPolyVert; ++i)
    {
-      cp.m_polyX[i] = 0.0;
-      cp.m_polyY[i] = 0.0;
-      cp.m_polyZ[i] = 0.0;
-
-      cp.local2DToGlobalCoords( cp.m_polyLocX[i], cp.m_polyLocY[i], 
-                                cp.m_polyX[i], cp.m_polyY[i], 
-                                cp.m_polyZ[i] );
+      const RealT vX = cp.m_polyX[i] - c[0];
+      const RealT vY = cp.m_polyY[i] - c[1];
+      const RealT vZ = cp.m_polyZ[i] - c[2];
+      entry.m_polyS[i] = dotProd( vX, vY, vZ, a1[0], a1[1], a1[2] );
+      entry.m_polyT[i] = dotProd( vX, vY, vZ, a2[0], a2[1], a2[2] );
    }
 
-   // check polygonal vertex ordering with common plane normal
-   PolyReorderWithNormal( cp.m_polyX, cp.m_polyY, cp.m_polyZ, cp.m_numPolyVert,
-                          cp.m_nX, cp.m_nY, cp.m_nZ );
+   mesh1.getFaceCoords( element_id1, entry.m_x1 );
+   mesh2.getFaceCoords( element_id2, entry.m_x2 );
 
-   // transform local interpenetration overlaps to global coords for the 
-   // current polygonal overlap
-   if (interpenOverlap)
-   {
-      for (int i=0; i<cp.m_numInterpenPoly1Vert; ++i)
-      {
-         Local2DToGlobalCoords( cp.m_interpenPoly1X[i], 
-                                cp.m_interpenPoly1Y[i], 
-                                cp.m_e1X, cp.m_e1Y, cp.m_e1Z,
-                                cp.m_e2X, cp.m_e2Y, cp.m_e2Z, 
-                                cp.m_cX, cp.m_cY, cp.m_cZ,
-                                cp.m_interpenG1X[i], cp.m_interpenG1Y[i],
-                                cp.m_interpenG1Z[i] );
+} // end CacheFacePairOverlap()
 
-      }
+//------------------------------------------------------------------------------
+TRIBOL_HOST_DEVICE bool CheckCachedFacePair( ContactPlane3D& cp,
+                                             const MeshData::Viewer& mesh1,
+                                             const MeshData::Viewer& mesh2,
+                                             const Parameters& params,
+                                             const OverlapCacheEntry& entry,
+                                             FaceGeomError& face_err )
+{
+   face_err = NO_FACE_GEOM_ERROR;
 
-      for (int i=0; i<cp.m_numInterpenPoly2Vert; ++i)
-      {
-         Local2DToGlobalCoords( cp.m_interpenPoly2X[i], 
-                                cp.m_interpenPoly2Y[i], 
-                                cp.m_e1X, cp.m_e1Y, cp.m_e1Z,
-                                cp.m_e2X, cp.m_e2Y, cp.m_e2Z, 
-                                cp.m_cX, cp.m_cY, cp.m_cZ,
-                                cp.m_interpenG2X[i], cp.m_interpenG2Y[i],
-                                cp.m_interpenG2Z[i] );
+   const IndexT element_id1 = cp.getCpElementId1();
+   const IndexT element_id2 = cp.getCpElementId2();
 
+   if (params.overlap_cache_ratio <= 0. || entry.m_numPolyVert == 0 ||
+       entry.m_faceId1 != element_id1 || entry.m_faceId2 != element_id2)
+   {
+      return false;
+   }
+
+   // relative motion of the faces since caching, measured against the mean 
+   // motion of face 2
+   const int num_nodes2 = mesh2.numberOfNodesPerElement();
+   RealT xf2[3*OverlapCacheEntry::max_nodes_per_elem];
+   mesh2.getFaceCoords( element_id2, xf2 );
+   RealT w[3] = { 0., 0., 0. };
+   for (int a=0; a<num_nodes2; ++a)
+   {
+      for (int d=0; d<3; ++d)
+      {
+         w[d] += xf2[3*a+d] - entry.m_x2[3*a+d];
       }
    }
+   for (int d=0; d<3; ++d)
+   {
+      w[d] /= num_nodes2;
+   }
 
-   // Now that all local-to-global projections have occurred,
-   // relocate the contact plane based on the most up-to-date 
-   // contact plane centroid and recompute the gap. For interpenOverlap, 
-   // the contact plane is updated and this just amounts to a gap 
-   // computation. For the fullOverlap case, this may relocate 
-   // the contact plane in space. For Mortar methods this routine 
-   // only computes the gap based on the current plane point and 
-   // normal.
-   // 
-   // Warning:
-   // Make sure that any local to global transformations have 
-   // occurred prior to this call. This does not need to be done 
-   // for mortar methods. We should just do a gap computation if 
-   // needed. 
-   cp.planePointAndCentroidGap( mesh1, mesh2, 2. * 
-      axom::utilities::max( mesh1.getFaceRadius()[ element_id1 ], 
-                            mesh2.getFaceRadius()[ element_id2 ] ));
+   RealT n1[3];
+   for (int d=0; d<3; ++d)
+   {
+      n1[d] = mesh1.getElementNormals()[d][element_id1];
+   }
 
-   // The gap tolerance allows separation up to the separation ratio of the 
-   // largest face-radius. This is conservative and allows for possible 
-   // over-inclusion. This is done for the mortar method per testing.
-   cp.m_gapTol = params.gap_separation_ratio * 
-                 axom::utilities::max( mesh1.getFaceRadius()[ element_id1 ], 
-                                       mesh2.getFaceRadius()[ element_id2 ] );
+   const RealT tol = params.overlap_cache_ratio * 
+                     axom::utilities::max( mesh1.getFaceRadius()[ element_id1 ], 
+                                           mesh2.getFaceRadius()[ element_id2 ] );
+   const bool in_plane = entry.m_fullOverlap;
+   if (FaceMotionExceeds( mesh1, element_id1, entry.m_x1, w, n1, in_plane, tol ) ||
+       FaceMotionExceeds( mesh2, element_id2, entry.m_x2, w, n1, in_plane, tol ))
+   {
+      return false;
+   }
 
-   if (cp.m_gap > cp.m_gapTol)
+   // recompute the plane and map the cached polygon onto it
+   const bool fullOverlap = entry.m_fullOverlap;
+   cp.m_interpenOverlap = !fullOverlap;
+   cp.computeNormal( mesh1, mesh2 );
+   cp.computePlanePoint( mesh1, mesh2 );
+   cp.computeLocalBasis( mesh1 );
+   cp.computeAreaTol( mesh1, mesh2, params );
+
+   RealT c[3], a1[3], a2[3];
+   FaceFrame( mesh1, element_id1, c, a1, a2 );
+   cp.m_numPolyVert = entry.m_numPolyVert;
+   for (int i=0; i<entry.m_numPolyVert; ++i)
+   {
+      const RealT s = entry.m_polyS[i];
+      const RealT t = entry.m_polyT[i];
+      RealT pX, pY, pZ;
+      ProjectPointToPlane( c[0] + s * a1[0] + t * a2[0], 
+                           c[1] + s * a1[1] + t * a2[1],
+                           c[2] + s * a1[2] + t * a2[2],
+                           cp.m_nX, cp.m_nY, cp.m_nZ,
+                           cp.m_cX, cp.m_cY, cp.m_cZ,
+                           pX, pY, pZ );
+      cp.globalTo2DLocalCoords( &pX, &pY, &pZ, &cp.m_polyLoc.x[i], 
+                                &cp.m_polyLoc.y[i], 1 );
+   }
+   cp.m_polyLoc.numVerts = cp.m_numPolyVert;
+   cp.m_polyLoc.pad();
+
+   cp.m_area = cp.m_polyLoc.area();
+   if (cp.m_area < cp.m_areaMin)
    {
       cp.m_inContact = false;
-      return NO_FACE_GEOM_ERROR;
+      return true;
    }
 
-   // for auto-contact, remove contact candidacy for full-overlap 
-   // face-pairs with interpenetration exceeding contact penetration fraction. 
-   // Note, this check is solely meant to exclude face-pairs composed of faces 
-   // on opposite sides of thin structures/plates
-   //
-   // Recall that interpen gaps are negative
+   // the full overlap uses the area centroid and the interpenetration 
+   // overlap the vertex averaged centroid, as in CheckFacePair()
    if (fullOverlap)
    {
-      if (ExceedsMaxAutoInterpen( mesh1, mesh2, element_id1, element_id2, 
-                                  params, cp.m_gap ))
-      {
-         cp.m_inContact = false;
-         return NO_FACE_GEOM_ERROR;
-      }
+      cp.m_polyLoc.centroid( cp.m_overlapCX, cp.m_overlapCY );
    }
-   
-   // if fullOverlap is used, REPROJECT the overlapping polygon 
-   // onto the new contact plane 
-   if (fullOverlap)
+   else
    {
-      for (int i=0; i<cp.m_numPolyVert; ++i)
-      {
-         ProjectPointToPlane( cp.m_polyX[i], cp.m_polyY[i], cp.m_polyZ[i], 
-                              cp.m_nX, cp.m_nY, cp.m_nZ,
-                              cp.m_cX, cp.m_cY, cp.m_cZ,
-                              cp.m_polyX[i], cp.m_polyY[i], cp.m_polyZ[i] );
-      }
+      cp.m_interpenArea = cp.m_area;
+      RealT z;
+      VertexAvgCentroid( cp.m_polyLoc.x, cp.m_polyLoc.y, nullptr, 
+                         cp.m_numPolyVert, cp.m_overlapCX, 
+                         cp.m_overlapCY, z );
    }
 
-   cp.m_inContact = true;
-   return NO_FACE_GEOM_ERROR;
+   face_err = FinishFacePair( cp, mesh1, mesh2, params, fullOverlap );
+   return true;
 
-} // end CheckFacePair()
+} // end CheckCachedFacePair()
 
 //------------------------------------------------------------------------------
 TRIBOL_HOST_DEVICE void ContactPlane::planePointAndCentroidGap( const MeshData::Viewer& m1,
@@ -1549,8 +1897,8 @@ TRIBOL_HOST_DEVICE FaceGeomError ContactPlane3D::computeLocalInterpenOverlap(
    RealT len_tol = pos_tol;
    FaceGeomError inter_err = Intersection2DPolygon( cfx1_loc, cfy1_loc, numV[0],
                                                     cfx2_loc, cfy2_loc, numV[1],
-                                                    pos_tol, len_tol, m_polyLocX,
-                                                    m_polyLocY, m_numPolyVert,
+                                                    pos_tol, len_tol, m_polyLoc.x,
+                                                    m_polyLoc.y, m_numPolyVert,
                                                     m_interpenArea, true );
 
    if (inter_err != NO_FACE_GEOM_ERROR)
@@ -1559,22 +1907,32 @@ TRIBOL_HOST_DEVICE FaceGeomError ContactPlane3D::computeLocalInterpenOverlap(
       return inter_err;
    }
 
-   // store the local intersection polygons on the contact plane object, 
-   // primarily for visualization
+   // store the global coordinates of the interpenetrating polygons on the 
+   // contact plane object, primarily for visualization. The contact plane is 
+   // not relocated until after the overlap is computed, so transforming here 
+   // avoids keeping local copies of the polygons on the plane.
 
    m_numInterpenPoly1Vert = numV[0];
    m_numInterpenPoly2Vert = numV[1];
 
    for (int i=0; i<numV[0]; ++i)
    {
-      m_interpenPoly1X[i] = cfx1_loc[i];
-      m_interpenPoly1Y[i] = cfy1_loc[i];
+      Local2DToGlobalCoords( cfx1_loc[i], cfy1_loc[i],
+                             m_e1X, m_e1Y, m_e1Z,
+                             m_e2X, m_e2Y, m_e2Z,
+                             m_cX, m_cY, m_cZ,
+                             m_interpenG1X[i], m_interpenG1Y[i],
+                             m_interpenG1Z[i] );
    }
 
    for (int i=0; i<numV[1]; ++i)
    {
-      m_interpenPoly2X[i] = cfx2_loc[i];
-      m_interpenPoly2Y[i] = cfy2_loc[i];
+      Local2DToGlobalCoords( cfx2_loc[i], cfy2_loc[i],
+                             m_e1X, m_e1Y, m_e1Z,
+                             m_e2X, m_e2Y, m_e2Z,
+                             m_cX, m_cY, m_cZ,
+                             m_interpenG2X[i], m_interpenG2Y[i],
+                             m_interpenG2Z[i] );
    }
 
    interpen = true;
@@ -1595,6 +1953,10 @@ TRIBOL_HOST_DEVICE ContactPlane2D::ContactPlane2D( InterfacePair* pair,
    {
       m_segX[i] = 0.0;
       m_segY[i] = 0.0;
+      m_interpenG1X[i] = 0.0;
+      m_interpenG1Y[i] = 0.0;
+      m_interpenG2X[i] = 0.0;
+      m_interpenG2Y[i] = 0.0;
    }
 } // end ContactPlane2D::ContactPlane2D()
 
@@ -1776,6 +2138,89 @@ TRIBOL_HOST_DEVICE FaceGeomError CheckEdgePair( ContactPlane2D& cp,
 
 } // end CheckEdgePair()
 
+//------------------------------------------------------------------------------
+TRIBOL_HOST_DEVICE void CheckNodeToSurfacePair( ContactPlane& cp,
+                                                const MeshData::Viewer& mesh1,
+                                                const MeshData::Viewer& mesh2,
+                                                const Parameters& params )
+{
+   constexpr int max_dim = 3;
+
+   IndexT element_id1 = cp.getCpElementId1();
+   IndexT element_id2 = cp.getCpElementId2();
+
+   const int dim = mesh1.spatialDimension();
+
+   cp.m_inContact = false;
+
+   // only opposing faces interact
+   RealT nrml1[max_dim];
+   RealT nrml2[max_dim];
+   mesh1.getFaceNormal( element_id1, nrml1 );
+   mesh2.getFaceNormal( element_id2, nrml2 );
+   if (dotProd( nrml1, nrml2, dim ) > 0.)
+   {
+      return;
+   }
+
+   // set the gap tolerance inclusive for separation up to m_gapTol
+   cp.m_gapTol = params.gap_separation_ratio * 
+                 axom::utilities::max( mesh1.getFaceRadius()[ element_id1 ],
+                                       mesh2.getFaceRadius()[ element_id2 ] );
+
+   // project each face 2 node onto face 1 and keep the smallest gap
+   RealT min_gap = cp.m_gapTol;
+   for (IndexT a{0}; a < mesh2.numberOfNodesPerElement(); ++a)
+   {
+      IndexT node_id = mesh2.getGlobalNodeId( element_id2, a );
+
+      RealT x[max_dim];
+      RealT xp[max_dim];
+      RealT gap {0.};
+      for (int d{0}; d < dim; ++d)
+      {
+         x[d] = mesh2.getPosition()[d][node_id];
+      }
+
+      if (!ProjectNodeToFace( mesh1, element_id1, x, xp, gap ) || gap > min_gap)
+      {
+         continue;
+      }
+
+      min_gap = gap;
+      cp.m_inContact = true;
+
+      cp.m_cXf1 = xp[0];
+      cp.m_cYf1 = xp[1];
+      cp.m_cZf1 = (dim == 3) ? xp[2] : 0.;
+
+      cp.m_cXf2 = x[0];
+      cp.m_cYf2 = x[1];
+      cp.m_cZf2 = (dim == 3) ? x[2] : 0.;
+   }
+
+   if (!cp.m_inContact)
+   {
+      return;
+   }
+
+   cp.m_gap = min_gap;
+
+   // the plane point is the projection of the closest node onto face 1
+   cp.m_cX = cp.m_cXf1;
+   cp.m_cY = cp.m_cYf1;
+   cp.m_cZ = cp.m_cZf1;
+
+   // keep the common-plane convention of a normal in the direction of face 2
+   cp.m_nX = -nrml1[0];
+   cp.m_nY = -nrml1[1];
+   cp.m_nZ = (dim == 3) ? -nrml1[2] : 0.;
+
+   // there is no overlap; report the face 2 area
+   cp.m_area = mesh2.getElementAreas()[ element_id2 ];
+
+} // end CheckNodeToSurfacePair()
+
 //------------------------------------------------------------------------------
 TRIBOL_HOST_DEVICE void ContactPlane2D::computeNormal( const MeshData::Viewer& m1, 
                                                        const MeshData::Viewer& m2 )
@@ -1936,165 +2381,46 @@ TRIBOL_HOST_DEVICE void ContactPlane2D::checkSegOverlap( const RealT* const pX1,
    SLIC_ASSERT( nV1 == 2 );
    SLIC_ASSERT( nV2 == 2 );
 #endif
-
-   // define the edge 1 non-unit directional vector between vertices 
-   // 2 and 1
-   RealT lvx1 = pX1[1] - pX1[0];
-   RealT lvy1 = pY1[1] - pY1[0];
-
-   RealT e1_len = magnitude( lvx1, lvy1 );
-   
-   // define the edge 2 non-unit directional vector between vertices 
-   // 2 and 1
-   RealT lvx2 = pX2[1] - pX2[0];
-   RealT lvy2 = pY2[1] - pY2[0];
-
-   RealT e2_len = magnitude( lvx2, lvy2 );
-
-   //
-   // perform the all-in-1 check
-   //
-
-   // compute vector between each edge 2 vertex and vertex 1 on edge 1.
-   // Then dot that vector with the directional vector of edge 1 to see 
-   // if they are codirectional (projection > 0 indicating edge 2 vertex 
-   // lies within or beyond edge 1. If so, check, that this vector length is 
-   // less than edge 1 length indicating that the vertex lies within edge 1
-   int inter2 = 0;
-   int twoInOneId = -1;
-   for (int i=0; i<nV2; ++i)
-   {
-      RealT vx = pX2[i] - pX1[0];
-      RealT vy = pY2[i] - pY1[0]; 
-
-      // compute projection onto edge 1 directional vector. (Positive if codirectional,
-      // negative otherwise. Only positive projections will be potential overlap vertex candidates
-      RealT proj = vx * lvx1 + vy * lvy1;
-
-      // compute length of <vx,vy>; if vLen < some tolerance we have a 
-      // coincident node
-      RealT vLen = magnitude( vx, vy );
-
-      // check for >= 0 projections and vector lengths <= edge 1 length. This
-      // indicates an edge 2 vertex interior to edge 1, or coincident vertices in 
-      // the case of projection = 0 or vector length is equal to edge 1 length
-      if (proj >= 0 && vLen <= e1_len) // interior vertex
-      {
-         twoInOneId = i;
-         ++inter2;
-      }
-   }
-
-   // if both vertices pass the above criteria than 2 is in 1
-   if (inter2 == 2) 
-   {
-      // set the contact plane (segment) length
-      m_area = e2_len;
-
-      // set the vertices of the overlap segment
-      m_segX[0] = pX2[0];
-      m_segY[0] = pY2[0];
-  
-      m_segX[1] = pX2[1];
-      m_segY[1] = pY2[1];
-
-      // relocate the centroid within the currently defined contact 
-      // segment
-      m_cX = 0.5 * (m_segX[0] + m_segX[1]);
-      m_cY = 0.5 * (m_segY[0] + m_segY[1]);
-      m_cZ = 0.0;
-      return;
-   }
-
-   //
-   // perform the all-in-2 check
-   //
-
-   // compute vector between each edge 1 vertex and vertex 1 on edge 2.
-   // Then dot that vector with the directional vector of edge 2 to see 
-   // if they are codirectional. If so, check, that this vector length is 
-   // less than edge 2 length indicating that the vertex is within edge 2
-   int inter1 = 0;
-   int oneInTwoId = -1;
-   for (int i=0; i<nV1; ++i)
-   {
-      RealT vx = pX1[i] - pX2[0];
-      RealT vy = pY1[i] - pY2[0]; 
-
-      // compute projection onto edge 2 directional vector
-      RealT proj = vx * lvx2 + vy * lvy2;
-
-      // compute length of <vx,vy>
-      RealT vLen = magnitude( vx, vy );
-
-      // check for >= 0 projections and vector lengths <= edge 2 length. This
-      // indicates an edge 1 vertex interior to edge 2 or is coincident if the 
-      // projection is zero or vector length is equal to edge 2 length
-      if (proj >= 0. && vLen <= e2_len) // interior vertex
-      {
-         oneInTwoId = i;
-         ++inter1;
-      }
-   }
-
-   // if both vertices pass the above criteria then 1 is in 2.
-   if (inter1 == 2)
-   {
-      // set the contact plane (segment) length
-      m_area = e1_len;
-
-      // set the overlap segment vertices on the contact plane object
-      m_segX[0] = pX1[0];
-      m_segY[0] = pY1[0];
-  
-      m_segX[1] = pX1[1];
-      m_segY[1] = pY1[1];
-  
-      // relocate the centroid within the currently defined contact 
-      // segment
-      m_cX = 0.5 * (m_segX[0] + m_segX[1]);
-      m_cY = 0.5 * (m_segY[0] + m_segY[1]);
-      m_cZ = 0.0;
-      return;
-   }
-
-   // if inter1 == 0 and inter2 == 0 then there is no overlap
-   if (inter1 == 0 && inter2 == 0)
-   {
-      m_area = 0.0;
-      m_cX = m_cY = m_cZ = 0.0;
-      return;
-   }
-
-   // there is a chance that oneInTowId or twoInOneId is not actually set, 
-   // in which case we don't have an overlap. 
-   if (oneInTwoId == -1 || twoInOneId == -1)
+   TRIBOL_UNUSED_VAR(nV1);
+   TRIBOL_UNUSED_VAR(nV2);
+
+   // the projected vertices lie on the contact segment, so locate each one 
+   // by its signed distance from the segment point along the unit tangent, 
+   // which is the contact segment normal rotated by 90 degrees
+   RealT tX = -m_nY;
+   RealT tY =  m_nX;
+   RealT x0 = m_cX;
+   RealT y0 = m_cY;
+
+   RealT s1a = (pX1[0] - x0) * tX + (pY1[0] - y0) * tY;
+   RealT s1b = (pX1[1] - x0) * tX + (pY1[1] - y0) * tY;
+   RealT s2a = (pX2[0] - x0) * tX + (pY2[0] - y0) * tY;
+   RealT s2b = (pX2[1] - x0) * tX + (pY2[1] - y0) * tY;
+
+   // intersect the two parameter intervals
+   RealT sMin = axom::utilities::max( axom::utilities::min( s1a, s1b ),
+                                      axom::utilities::min( s2a, s2b ) );
+   RealT sMax = axom::utilities::min( axom::utilities::max( s1a, s1b ),
+                                      axom::utilities::max( s2a, s2b ) );
+
+   // no overlap (or only a single coincident vertex)
+   if (sMax <= sMin)
    {
       m_area = 0.0;
       m_cX = m_cY = m_cZ = 0.0;
       return;
    }
 
-   // if we are here, we have ruled out all-in-1 and all-in-2 overlaps, 
-   // and non-overlapping edges, but have the case where edge 1 and 
-   // edge 2 overlap some finite distance that is less than either of their 
-   // lengths. We have vertex information from the all-in-one checks 
-   // indicating which vertices on one edge are within the other edge
-
-   // set the segment vertices
-   m_segX[0] = pX1[ oneInTwoId ];
-   m_segY[0] = pY1[ oneInTwoId ];
-   m_segX[1] = pX2[ twoInOneId ];
-   m_segY[1] = pY2[ twoInOneId ];
-
-   // compute vector between "inter"-vertices
-   RealT vecX = m_segX[1] - m_segX[0];
-   RealT vecY = m_segY[1] - m_segY[0];
+   // set the overlap segment vertices and length
+   m_segX[0] = x0 + sMin * tX;
+   m_segY[0] = y0 + sMin * tY;
+   m_segX[1] = x0 + sMax * tX;
+   m_segY[1] = y0 + sMax * tY;
 
-   // compute the length of the overlapping segment
-   m_area = magnitude( vecX, vecY );
+   m_area = sMax - sMin;
 
-   // compute the overlap centroid
+   // relocate the centroid within the currently defined contact 
+   // segment
    m_cX = 0.5 * (m_segX[0] + m_segX[1]);
    m_cY = 0.5 * (m_segY[0] + m_segY[1]);
    m_cZ = 0.0;
@@ -9,6 +9,7 @@
 #include "tribol/mesh/MeshData.hpp"
 #include "tribol/mesh/InterfacePairs.hpp"
 #include "tribol/common/Parameters.hpp"
+#include "tribol/geom/Polygon.hpp"
 #include "axom/slic.hpp" 
 
 #include <string>
@@ -125,6 +126,34 @@ TRIBOL_HOST_DEVICE bool ExceedsMaxAutoInterpen( const MeshData::Viewer& mesh1,
                                                 RealT auto_contact_pen_frac,
                                                 const RealT gap );
 
+/*!
+ *
+ * \brief projects a point onto the plane of a face and checks if the 
+ *        projection lies within the face
+ *
+ * \param [in] mesh mesh data viewer for the mesh to which the face belongs
+ * \param [in] faceId id for the face
+ * \param [in] x coordinates of the point (stacked by dimension)
+ * \param [in,out] xp coordinates of the point projected onto the face plane
+ * \param [in,out] gap signed distance of the point from the face plane along 
+ *                  the face's outward unit normal (negative behind the face)
+ *
+ * \return true if the projected point lies within the face
+ *
+ * \pre length(x), length(xp) >= spatial dimension
+ *
+ * \note the face is treated as planar (through the face centroid with the 
+ *       face's outward unit normal) and the in-face test uses the face edges, 
+ *       assuming the face nodes are ordered counter-clockwise about the 
+ *       outward unit normal
+ *
+ */
+TRIBOL_HOST_DEVICE bool ProjectNodeToFace( const MeshData::Viewer& mesh,
+                                           IndexT faceId,
+                                           const RealT* x,
+                                           RealT* xp,
+                                           RealT& gap );
+
 //-----------------------------------------------------------------------------
 // Contact Plane base class
 //-----------------------------------------------------------------------------
@@ -177,14 +206,7 @@ public:
    RealT m_cZf2; ///< global z-coordinate of contact plane centroid projected to face 2
 
    int m_numInterpenPoly1Vert; ///< Number of vertices on face 1 interpenetrating polygon
-   RealT m_interpenG1X[max_nodes_per_overlap];   ///< Global x-coordinate of face 1 interpenetrating polygon
-   RealT m_interpenG1Y[max_nodes_per_overlap];   ///< Global y-coordinate of face 1 interpenetrating polygon
-   RealT m_interpenG1Z[max_nodes_per_overlap];   ///< Global z-coordinate of face 1 interpenetrating polygon
-   
    int m_numInterpenPoly2Vert; ///< Number of vertices on face 2 interpenetrating polygon
-   RealT m_interpenG2X[max_nodes_per_overlap];   ///< Global x-coordinate of face 2 interpenetrating polygon
-   RealT m_interpenG2Y[max_nodes_per_overlap];   ///< Global y-coordinate of face 2 interpenetrating polygon
-   RealT m_interpenG2Z[max_nodes_per_overlap];   ///< Global z-coordinate of face 2 interpenetrating polygon
 
    RealT m_nX; ///< Global x-component of contact plane unit normal 
    RealT m_nY; ///< Global y-component of contact plane unit normal
@@ -378,8 +400,7 @@ public:
    RealT m_e2Y; ///< Global y-component of second in-plane basis vector
    RealT m_e2Z; ///< Global z-component of second in-plane basis vector
 
-   RealT m_polyLocX[max_nodes_per_overlap]; ///< Pointer to local x-components of overlap polygon's vertices
-   RealT m_polyLocY[max_nodes_per_overlap]; ///< Pointer to local y-components of overlap polygon's vertices 
+   Polygon2D<max_nodes_per_overlap> m_polyLoc; ///< Local coordinates of overlap polygon's vertices
 
    RealT m_polyX[max_nodes_per_overlap]; ///< Global x-components of overlap polygon's vertices
    RealT m_polyY[max_nodes_per_overlap]; ///< Global y-components of overlap polygon's vertices
@@ -390,11 +411,13 @@ public:
    RealT m_overlapCX; ///< Local x-coordinate of overlap centroid
    RealT m_overlapCY; ///< Local y-coordinate of overlap centroid
 
-   RealT m_interpenPoly1X[max_nodes_per_overlap]; ///< Local x-coordinates of face 1 interpenetrating overlap
-   RealT m_interpenPoly1Y[max_nodes_per_overlap]; ///< Local y-coordinates of face 1 interpenetrating overlap
+   RealT m_interpenG1X[max_nodes_per_overlap]; ///< Global x-coordinate of face 1 interpenetrating polygon
+   RealT m_interpenG1Y[max_nodes_per_overlap]; ///< Global y-coordinate of face 1 interpenetrating polygon
+   RealT m_interpenG1Z[max_nodes_per_overlap]; ///< Global z-coordinate of face 1 interpenetrating polygon
 
-   RealT m_interpenPoly2X[max_nodes_per_overlap]; ///< Local x-coordinates of face 2 interpenetrating overlap
-   RealT m_interpenPoly2Y[max_nodes_per_overlap]; ///< Local y-coordinates of face 2 interpenetrating overlap
+   RealT m_interpenG2X[max_nodes_per_overlap]; ///< Global x-coordinate of face 2 interpenetrating polygon
+   RealT m_interpenG2Y[max_nodes_per_overlap]; ///< Global y-coordinate of face 2 interpenetrating polygon
+   RealT m_interpenG2Z[max_nodes_per_overlap]; ///< Global z-coordinate of face 2 interpenetrating polygon
 
    /*!
     * \brief Compute the unit normal that defines the contact plane
@@ -545,6 +568,14 @@ public:
    RealT m_segX[2]; ///< Global x-components of overlap segment vertices
    RealT m_segY[2]; ///< Global y-components of overlap segment vertices
 
+   // the interpenetrating portion of each edge is itself a segment, so the 2D 
+   // plane only stores two vertices per edge
+   RealT m_interpenG1X[2]; ///< Global x-coordinates of edge 1 interpenetrating segment
+   RealT m_interpenG1Y[2]; ///< Global y-coordinates of edge 1 interpenetrating segment
+
+   RealT m_interpenG2X[2]; ///< Global x-coordinates of edge 2 interpenetrating segment
+   RealT m_interpenG2Y[2]; ///< Global y-coordinates of edge 2 interpenetrating segment
+
 public:
 
    /*!
@@ -623,6 +654,16 @@ public:
    /*!
     * \brief Check whether two segments have a positive length of overlap 
     *
+    * \param [in] pX1 x-coordinates of edge 1 vertices projected onto the contact segment
+    * \param [in] pY1 y-coordinates of edge 1 vertices projected onto the contact segment
+    * \param [in] pX2 x-coordinates of edge 2 vertices projected onto the contact segment
+    * \param [in] pY2 y-coordinates of edge 2 vertices projected onto the contact segment
+    * \param [in] nV1 number of edge 1 vertices
+    * \param [in] nV2 number of edge 2 vertices
+    *
+    * \note The projected vertices are collinear, so each edge is reduced to 
+    *  an interval of the arc-length parameter along the contact segment and 
+    *  the overlap is the intersection of the two intervals.
     */
    TRIBOL_HOST_DEVICE void checkSegOverlap( const RealT* const pX1, const RealT* const pY1, 
                                             const RealT* const pX2, const RealT* const pY2, 
@@ -644,6 +685,78 @@ public:
 
 };
 
+//-----------------------------------------------------------------------------
+// Overlap cache
+//-----------------------------------------------------------------------------
+
+/*!
+ * \brief Cached overlap polygon of a 3D common plane face-pair
+ *
+ * The polygon vertices are stored in a frame attached to face 1, with the 
+ * origin at the face centroid, the first axis toward the first face node and 
+ * the second axis completing a right-handed frame with the face normal. The 
+ * polygon therefore follows rigid motion of face 1. The nodal coordinates of 
+ * both faces at caching time are kept to measure the relative motion of the 
+ * faces since the polygon was computed.
+ */
+struct OverlapCacheEntry
+{
+   static constexpr int max_nodes_per_elem {4};
+   static constexpr int max_nodes_per_overlap {8};
+
+   IndexT m_faceId1 {-1};      ///< Face 1 id of the cached face-pair
+   IndexT m_faceId2 {-1};      ///< Face 2 id of the cached face-pair
+   int m_numPolyVert {0};      ///< Number of cached polygon vertices; 0 if the entry is empty
+   bool m_fullOverlap {false}; ///< True if the cached polygon is the full projected overlap
+   bool m_hit {false};         ///< True if the last lookup reused the cached polygon
+
+   RealT m_polyS[max_nodes_per_overlap]; ///< Polygon vertex coordinates along the first face 1 axis
+   RealT m_polyT[max_nodes_per_overlap]; ///< Polygon vertex coordinates along the second face 1 axis
+
+   RealT m_x1[3*max_nodes_per_elem]; ///< Face 1 nodal coordinates at caching time (node-major)
+   RealT m_x2[3*max_nodes_per_elem]; ///< Face 2 nodal coordinates at caching time (node-major)
+};
+
+/*!
+ * \brief Stores the overlap polygon of a 3D common plane in a cache entry
+ *
+ * \param [in] cp contact plane in contact, as computed by CheckFacePair()
+ * \param [in] mesh1 mesh data viewer for mesh 1
+ * \param [in] mesh2 mesh data viewer for mesh 2
+ * \param [out] entry cache entry of the face-pair
+ */
+TRIBOL_HOST_DEVICE void CacheFacePairOverlap( const ContactPlane3D& cp,
+                                              const MeshData::Viewer& mesh1,
+                                              const MeshData::Viewer& mesh2,
+                                              OverlapCacheEntry& entry );
+
+/*!
+ * \brief Checks a 3D common plane face-pair reusing a cached overlap polygon
+ *
+ * The cached polygon is valid if the entry holds the face-pair and every 
+ * nodal motion of the two faces since caching, relative to the mean motion of
+ * face 2, stays below overlap_cache_ratio times the largest face radius. Only
+ * the in-plane part of the relative motion is measured for full overlap 
+ * polygons; interpenetration polygons also depend on the normal motion. If 
+ * valid, only the plane normal, plane point, local basis and gap are 
+ * recomputed, with the cached polygon mapped to the current position of face 1.
+ *
+ * \param [in,out] cp contact plane object to be populated
+ * \param [in] mesh1 mesh data viewer for mesh 1
+ * \param [in] mesh2 mesh data viewer for mesh 2
+ * \param [in] params coupling-scheme specific parameters
+ * \param [in] entry cache entry of the face-pair
+ * \param [out] face_err geometry error of the check if the cache is valid
+ *
+ * \return true if the cached polygon was valid and cp is populated
+ */
+TRIBOL_HOST_DEVICE bool CheckCachedFacePair( ContactPlane3D& cp,
+                                             const MeshData::Viewer& mesh1,
+                                             const MeshData::Viewer& mesh2,
+                                             const Parameters& params,
+                                             const OverlapCacheEntry& entry,
+                                             FaceGeomError& face_err );
+
 //-----------------------------------------------------------------------------
 // Free functions
 //-----------------------------------------------------------------------------
@@ -660,6 +773,7 @@ public:
  * \param [in,out] planes_2d array view of 2D contact planes
  * \param [in,out] planes_3d array view of 3D contact planes
  * \param [in,out] plane_ct number of contact planes in the array views
+ * \param [in,out] cache_entry overlap cache entry of the pair; only used by 3D COMMON_PLANE (optional)
  *
  * \note isInteracting is true indicating a contact candidate for intersecting or 
  *       nearly intersecting face-pairs with a positive area of overlap
@@ -678,7 +792,8 @@ TRIBOL_HOST_DEVICE FaceGeomError CheckInterfacePair( InterfacePair& pair,
                                   bool& isInteracting,
                                   ArrayViewT<ContactPlane2D>& planes_2d,
                                   ArrayViewT<ContactPlane3D>& planes_3d,
-                                  IndexT* plane_ct );
+                                  IndexT* plane_ct,
+                                  OverlapCacheEntry* cache_entry = nullptr );
 
 
 //-----------------------------------------------------------------------------
@@ -736,6 +851,26 @@ TRIBOL_HOST_DEVICE FaceGeomError CheckEdgePair( ContactPlane2D& cp,
                                                 const MeshData::Viewer& mesh2,
                                                 const Parameters& params,
                                                 bool fullOverlap );
+
+/*!
+ * \brief Checks if a face-pair candidate is a node-to-surface interaction.
+ *
+ * \param [in,out] cp contact plane object to be populated
+ * \param [in] mesh1 mesh data viewer for mesh 1 (surface side)
+ * \param [in] mesh2 mesh data viewer for mesh 2 (node side)
+ * \param [in] params coupling-scheme specific parameters
+ *
+ * \note No overlap is computed. The nodes of face 2 are projected onto face 1 
+ *       and the pair is in contact if a projection lies within face 1 with a 
+ *       gap below the separation tolerance. The plane stores the smallest such 
+ *       gap, the corresponding face 2 node (cXf2) and its projection onto 
+ *       face 1 (cX and cXf1), and a normal opposite to the face 1 normal.
+ * 
+ */
+TRIBOL_HOST_DEVICE void CheckNodeToSurfacePair( ContactPlane& cp,
+                                                const MeshData::Viewer& mesh1,
+                                                const MeshData::Viewer& mesh2,
+                                                const Parameters& params );
 }
 
 #endif /* SRC_GEOM_CONTACTPLANE_HPP_ */
@@ -4,6 +4,7 @@
 // SPDX-License-Identifier: (MIT)
 
 #include "GeomUtilities.hpp"
+#include "Polygon.hpp"
 #include "ContactPlane.hpp"
 #include "tribol/utils/Math.hpp"
 
@@ -646,7 +647,7 @@ TRIBOL_HOST_DEVICE FaceGeomError Intersection2DPolygon( const RealT* const xA,
          polyX[i] = xA[i];
          polyY[i] = yA[i];
       }
-      area = Area2DPolygon( polyX, polyY, numVertexA );
+      area = ConvexPolygonArea( polyX, polyY, numVertexA );
       return NO_FACE_GEOM_ERROR;
    }
 
@@ -670,7 +671,7 @@ TRIBOL_HOST_DEVICE FaceGeomError Intersection2DPolygon( const RealT* const xA,
          polyX[i] = xB[i];
          polyY[i] = yB[i];
       }
-      area = Area2DPolygon( polyX, polyY, numVertexB );
+      area = ConvexPolygonArea( polyX, polyY, numVertexB );
       return NO_FACE_GEOM_ERROR;
    }
 
@@ -884,7 +885,7 @@ TRIBOL_HOST_DEVICE FaceGeomError Intersection2DPolygon( const RealT* const xA,
    }
 
    // compute the area of the polygon
-   area = Area2DPolygon( polyX, polyY, numPolyVert );
+   area = ConvexPolygonArea( polyX, polyY, numPolyVert );
 
    return NO_FACE_GEOM_ERROR;
 
@@ -896,6 +897,12 @@ TRIBOL_HOST_DEVICE bool CheckPolyOrientation( const RealT* const x,
                                               const int numVertex )
 {
    bool check = true;
+
+   // compute vertex-averaged centroid (loop invariant)
+   RealT* z = nullptr;
+   RealT xc, yc, zc;
+   VertexAvgCentroid( x, y, z, numVertex, xc, yc, zc );
+
    for (int i=0; i<numVertex; ++i)
    {
       // determine vertex indices of the segment
@@ -910,11 +917,6 @@ TRIBOL_HOST_DEVICE bool CheckPolyOrientation( const RealT* const x,
       RealT nrmlx = -lambdaY;
       RealT nrmly = lambdaX;
 
-      // compute vertex-averaged centroid
-      RealT* z = nullptr;
-      RealT xc, yc, zc;
-      VertexAvgCentroid( x, y, z, numVertex, xc, yc, zc );
-
       // compute vector between centroid and first vertex of current segment
       RealT vx = xc - x[ia];
       RealT vy = yc - y[ia];
@@ -1056,6 +1058,22 @@ TRIBOL_HOST_DEVICE RealT Area2DPolygon( const RealT* const x,
 
 } // end Area2DPolygon()
 
+//------------------------------------------------------------------------------
+TRIBOL_HOST_DEVICE RealT ConvexPolygonArea( const RealT* const x, 
+                                            const RealT* const y, 
+                                            const int numPolyVert )
+{
+   // overlap polygons of linear faces fit in the padded polygon type; fall back 
+   // on the triangle fan for anything larger
+   Polygon2D<overlap_polygon_capacity> poly;
+   if (!poly.assign( x, y, numPolyVert ))
+   {
+      return Area2DPolygon( x, y, numPolyVert );
+   }
+   return poly.area();
+
+} // end ConvexPolygonArea()
+
 //------------------------------------------------------------------------------
 TRIBOL_HOST_DEVICE RealT Area3DTri( const RealT* const x,
                                     const RealT* const y,
@@ -390,6 +390,23 @@ TRIBOL_HOST_DEVICE RealT Area2DPolygon( const RealT* const x,
                                         const RealT* const y, 
                                         const int numPolyVert );
 
+/*!
+ * \brief computes the area of a convex, ordered polygon
+ *
+ * \param [in] x array of local x coordinates of polygon vertices
+ * \param [in] y array of local y coordinates of polygon vertices
+ * \param [in] numPolyVert number of polygon vertices
+ *
+ * \return area of polygon
+ *
+ * \note uses the padded Polygon2D shoelace kernel, which has a fixed trip 
+ *  count and vectorizes across vertices. Falls back on Area2DPolygon() if the 
+ *  polygon exceeds the Polygon2D capacity.
+ */
+TRIBOL_HOST_DEVICE RealT ConvexPolygonArea( const RealT* const x, 
+                                            const RealT* const y, 
+                                            const int numPolyVert );
+
 /*!
  * \brief computes the area of a triangle given 3D vertex coordinates
  *
@@ -0,0 +1,187 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_GEOM_POLYGON_HPP_
+#define SRC_GEOM_POLYGON_HPP_
+
+#include "tribol/common/Parameters.hpp"
+
+namespace tribol
+{
+
+/// Capacity of an overlap polygon between two linear faces (2 * 4 vertices)
+constexpr int overlap_polygon_capacity {8};
+
+/*!
+ * \brief Fixed-capacity 2D polygon in local (contact plane) coordinates
+ *
+ * Vertex coordinates are stored as separate x and y rows of MAX_VERTS entries.
+ * The capacity is a multiple of four so each row fills whole SIMD registers.
+ * Unused entries are padded with the first vertex (see pad()), which makes the
+ * padded edges degenerate. The area, centroid and orientation kernels then run
+ * over the full, fixed capacity without a wrap-around branch, so compilers can
+ * vectorize them across vertices.
+ *
+ * \tparam MAX_VERTS maximum number of vertices (multiple of 4)
+ *
+ * \note Plane records holding polygons are stored in axom arrays which only
+ * guarantee malloc alignment, so the type is padded rather than over-aligned.
+ */
+template <int MAX_VERTS>
+struct Polygon2D
+{
+   static_assert(MAX_VERTS > 0 && MAX_VERTS % 4 == 0,
+                 "Polygon2D capacity must be a positive multiple of 4.");
+
+   static constexpr int max_vertices {MAX_VERTS};
+
+   RealT x[MAX_VERTS]; ///< Local x-coordinates of the vertices
+   RealT y[MAX_VERTS]; ///< Local y-coordinates of the vertices
+   int numVerts;       ///< Number of vertices in the polygon
+
+   /// Sets the polygon to an empty polygon
+   TRIBOL_HOST_DEVICE void clear()
+   {
+      numVerts = 0;
+      pad();
+   }
+
+   /*!
+    * \brief Copies vertices into the polygon and pads the unused entries
+    *
+    * \param [in] xs array of x-coordinates
+    * \param [in] ys array of y-coordinates
+    * \param [in] n number of vertices
+    *
+    * \return false if n exceeds the capacity of the polygon
+    */
+   TRIBOL_HOST_DEVICE bool assign( const RealT* const xs, const RealT* const ys, int n )
+   {
+      if (n > MAX_VERTS)
+      {
+         return false;
+      }
+      for (int i=0; i<n; ++i)
+      {
+         x[i] = xs[i];
+         y[i] = ys[i];
+      }
+      numVerts = n;
+      pad();
+      return true;
+   }
+
+   /*!
+    * \brief Appends a vertex
+    *
+    * \return false if the polygon is full
+    *
+    * \note pad() must be called once all vertices are appended
+    */
+   TRIBOL_HOST_DEVICE bool append( RealT xv, RealT yv )
+   {
+      if (numVerts >= MAX_VERTS)
+      {
+         return false;
+      }
+      x[numVerts] = xv;
+      y[numVerts] = yv;
+      ++numVerts;
+      return true;
+   }
+
+   /// Fills the unused entries with the first vertex (zeros if empty)
+   TRIBOL_HOST_DEVICE void pad()
+   {
+      const RealT x0 = (numVerts > 0) ? x[0] : 0.;
+      const RealT y0 = (numVerts > 0) ? y[0] : 0.;
+      for (int i=numVerts; i<MAX_VERTS; ++i)
+      {
+         x[i] = x0;
+         y[i] = y0;
+      }
+   }
+
+   /*!
+    * \brief Computes the signed area (positive for CCW ordering)
+    *
+    * \pre the polygon is padded
+    */
+   TRIBOL_HOST_DEVICE RealT signedArea() const
+   {
+      RealT a = 0.;
+      for (int i=0; i<MAX_VERTS-1; ++i)
+      {
+         a += x[i] * y[i+1] - x[i+1] * y[i];
+      }
+      a += x[MAX_VERTS-1] * y[0] - x[0] * y[MAX_VERTS-1];
+      return 0.5 * a;
+   }
+
+   /// Computes the (unsigned) area of the polygon
+   TRIBOL_HOST_DEVICE RealT area() const
+   {
+      const RealT a = signedArea();
+      return (a < 0.) ? -a : a;
+   }
+
+   /// Returns true if the vertices are ordered counter-clockwise
+   TRIBOL_HOST_DEVICE bool isCCW() const
+   {
+      return signedArea() > 0.;
+   }
+
+   /*!
+    * \brief Computes the area-weighted centroid
+    *
+    * \param [out] cX x-coordinate of the centroid
+    * \param [out] cY y-coordinate of the centroid
+    *
+    * \return false if the polygon has zero area
+    *
+    * \pre the polygon is padded
+    */
+   TRIBOL_HOST_DEVICE bool centroid( RealT& cX, RealT& cY ) const
+   {
+      RealT a = 0.;
+      RealT sx = 0.;
+      RealT sy = 0.;
+      for (int i=0; i<MAX_VERTS; ++i)
+      {
+         const int j = (i == MAX_VERTS-1) ? 0 : i+1;
+         const RealT cross = x[i] * y[j] - x[j] * y[i];
+         a += cross;
+         sx += (x[i] + x[j]) * cross;
+         sy += (y[i] + y[j]) * cross;
+      }
+      if (a == 0.)
+      {
+         cX = 0.;
+         cY = 0.;
+         return false;
+      }
+      cX = sx / (3. * a);
+      cY = sy / (3. * a);
+      return true;
+   }
+
+   /// Reverses the vertex ordering, keeping the first vertex in place
+   TRIBOL_HOST_DEVICE void reverse()
+   {
+      for (int i=1, j=numVerts-1; i<j; ++i, --j)
+      {
+         const RealT tx = x[i];
+         const RealT ty = y[i];
+         x[i] = x[j];
+         y[i] = y[j];
+         x[j] = tx;
+         y[j] = ty;
+      }
+   }
+};
+
+} // end namespace tribol
+
+#endif /* SRC_GEOM_POLYGON_HPP_ */
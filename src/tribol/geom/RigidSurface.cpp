@@ -0,0 +1,75 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#include "RigidSurface.hpp"
+
+#include "tribol/utils/Math.hpp"
+
+namespace tribol
+{
+
+//------------------------------------------------------------------------------
+TRIBOL_HOST_DEVICE RealT RigidSurface::signedDistance( const RealT* x, RealT* nrml ) const
+{
+   // vector from the surface point to x
+   RealT r[3] {0., 0., 0.};
+   for (int d{0}; d < m_dim; ++d)
+   {
+      r[d] = x[d] - m_point[d];
+   }
+
+   if (m_type == RIGID_PLANE)
+   {
+      RealT dist = 0.;
+      for (int d{0}; d < m_dim; ++d)
+      {
+         nrml[d] = m_dir[d];
+         dist += r[d] * m_dir[d];
+      }
+      return dist;
+   }
+
+   // remove the axial component for a 3D cylinder. In 2D, cylinders and 
+   // spheres are both circles.
+   if (m_type == RIGID_CYLINDER && m_dim == 3)
+   {
+      RealT axial = r[0] * m_dir[0] + r[1] * m_dir[1] + r[2] * m_dir[2];
+      for (int d{0}; d < 3; ++d)
+      {
+         r[d] -= axial * m_dir[d];
+      }
+   }
+
+   const RealT rho = magnitude( r[0], r[1], r[2] );
+
+   // the normal is undefined on the axis (center); use a zero normal so no 
+   // force is applied there
+   const RealT sign = m_contact_inside ? -1. : 1.;
+   const RealT inv_rho = (rho > 0.) ? 1. / rho : 0.;
+   for (int d{0}; d < m_dim; ++d)
+   {
+      nrml[d] = sign * r[d] * inv_rho;
+   }
+   return sign * (rho - m_radius);
+
+} // end RigidSurface::signedDistance()
+
+//------------------------------------------------------------------------------
+const char* getRigidSurfaceTypeName( RigidSurfaceType type )
+{
+   switch (type)
+   {
+      case RIGID_PLANE:
+         return "RIGID_PLANE";
+      case RIGID_CYLINDER:
+         return "RIGID_CYLINDER";
+      case RIGID_SPHERE:
+         return "RIGID_SPHERE";
+      default:
+         return "UNDEFINED";
+   }
+} // end getRigidSurfaceTypeName()
+
+} // end namespace tribol
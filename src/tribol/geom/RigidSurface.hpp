@@ -0,0 +1,59 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_GEOM_RIGIDSURFACE_HPP_
+#define SRC_GEOM_RIGIDSURFACE_HPP_
+
+#include "tribol/common/BasicTypes.hpp"
+#include "tribol/common/Parameters.hpp"
+
+namespace tribol
+{
+
+/*!
+ * \brief Analytic description of a rigid contact surface
+ *
+ * A rigid surface replaces a meshed contact surface (e.g. rigid tooling) in a
+ * coupling scheme. Contact is evaluated by signed distance queries at the
+ * nodes of the deformable surface, so no search or overlap computation is 
+ * needed. The surface moves rigidly with the registered point, direction, and
+ * velocity, which the host code updates each cycle.
+ */
+struct RigidSurface
+{
+   RigidSurfaceType m_type {RIGID_PLANE}; ///< Type of surface
+
+   int m_dim {3};                         ///< Spatial dimension
+
+   RealT m_point[3] {0., 0., 0.};         ///< Point on the plane, or center (axis point) of the sphere (cylinder)
+
+   RealT m_dir[3] {0., 0., 1.};           ///< Unit outward normal of the plane, or unit axis of the cylinder
+
+   RealT m_radius {0.};                   ///< Radius of the cylinder or sphere
+
+   bool m_contact_inside {false};         ///< True if contact is on the inside of the cylinder or sphere (e.g. a die)
+
+   RealT m_vel[3] {0., 0., 0.};           ///< Translational velocity of the surface
+
+   /*!
+    * \brief Computes the signed distance from a point to the surface
+    *
+    * \param [in] x stacked coordinates of the point
+    * \param [out] nrml unit normal of the surface at the closest point, pointing
+    *              away from the rigid body
+    *
+    * \return signed distance; negative if the point is inside the rigid body
+    */
+   TRIBOL_HOST_DEVICE RealT signedDistance( const RealT* x, RealT* nrml ) const;
+};
+
+/*!
+ * \brief Returns the name of a rigid surface type, e.g. "RIGID_PLANE"
+ */
+const char* getRigidSurfaceTypeName( RigidSurfaceType type );
+
+} // end namespace tribol
+
+#endif /* SRC_GEOM_RIGIDSURFACE_HPP_ */
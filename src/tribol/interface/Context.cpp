@@ -0,0 +1,48 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#include "tribol/interface/Context.hpp"
+
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/MeshData.hpp"
+
+namespace tribol
+{
+
+//------------------------------------------------------------------------------
+Context::Context()
+  : m_mesh_manager( new MeshManager() )
+  , m_coupling_scheme_manager( new CouplingSchemeManager() )
+{}
+
+//------------------------------------------------------------------------------
+Context::~Context()
+{
+  clear();
+}
+
+//------------------------------------------------------------------------------
+void Context::clear()
+{
+  // coupling schemes hold pointers to the meshes, so they are removed first
+  m_coupling_scheme_manager->clear();
+  m_mesh_manager->clear();
+}
+
+//------------------------------------------------------------------------------
+ContextScope::ContextScope( Context& context )
+  : m_prev_mesh_manager( MeshManager::setCurrentInstance( &context.getMeshManager() ) )
+  , m_prev_coupling_scheme_manager( 
+      CouplingSchemeManager::setCurrentInstance( &context.getCouplingSchemeManager() ) )
+{}
+
+//------------------------------------------------------------------------------
+ContextScope::~ContextScope()
+{
+  MeshManager::setCurrentInstance( m_prev_mesh_manager );
+  CouplingSchemeManager::setCurrentInstance( m_prev_coupling_scheme_manager );
+}
+
+} // end namespace tribol
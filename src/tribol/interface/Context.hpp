@@ -0,0 +1,109 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_INTERFACE_CONTEXT_HPP_
+#define SRC_INTERFACE_CONTEXT_HPP_
+
+// C/C++ includes
+#include <memory>
+
+namespace tribol
+{
+
+// forward declarations
+template <typename T>
+class DataManager;
+class MeshData;
+class CouplingScheme;
+
+/**
+ * @brief Owns the mesh and coupling scheme registries of an independent 
+ * contact problem
+ *
+ * The tribol API routines (registerMesh(), registerCouplingScheme(), update(), 
+ * etc.) operate on the current context of the calling thread. Without an 
+ * active ContextScope, this is the default context. Host codes that solve 
+ * independent problems on separate threads create a Context for each problem
+ * and activate it on the solving thread with a ContextScope. Contexts share no
+ * registry data, so no locking is needed between them.
+ *
+ * @note A Context must not be used by more than one thread at a time.
+ * @note Only logging is shared between contexts. SLIC messages of all threads
+ * go to the same process-wide logger, and coupling scheme logging levels (see
+ * setLoggingLevel()) modify its process-wide logging level.
+ */
+class Context
+{
+public:
+  /**
+   * @brief Constructs a Context with empty registries
+   */
+  Context();
+
+  /**
+   * @brief Destroys the Context, clearing its coupling schemes and meshes
+   */
+  ~Context();
+
+  Context(const Context& other) = delete;
+  Context& operator=(const Context& other) = delete;
+
+  /**
+   * @brief Get the mesh registry of the Context
+   * 
+   * @return reference to the mesh DataManager
+   */
+  DataManager<MeshData>& getMeshManager() { return *m_mesh_manager; }
+
+  /**
+   * @brief Get the coupling scheme registry of the Context
+   * 
+   * @return reference to the coupling scheme DataManager
+   */
+  DataManager<CouplingScheme>& getCouplingSchemeManager() { return *m_coupling_scheme_manager; }
+
+  /**
+   * @brief Removes all coupling schemes and meshes from the Context
+   */
+  void clear();
+
+private:
+  std::unique_ptr<DataManager<MeshData>> m_mesh_manager; ///< Registered meshes
+  std::unique_ptr<DataManager<CouplingScheme>> m_coupling_scheme_manager; ///< Registered coupling schemes
+};
+
+/**
+ * @brief Makes a Context the current context of the calling thread for the 
+ * lifetime of the ContextScope
+ *
+ * The previously current context is restored on destruction, so scopes may 
+ * be nested.
+ */
+class ContextScope
+{
+public:
+  /**
+   * @brief Activates a Context on the calling thread
+   *
+   * @param [in] context Context to activate
+   */
+  explicit ContextScope( Context& context );
+
+  /**
+   * @brief Restores the previous context of the calling thread
+   */
+  ~ContextScope();
+
+  ContextScope(const ContextScope& other) = delete;
+  ContextScope& operator=(const ContextScope& other) = delete;
+
+private:
+  DataManager<MeshData>* m_prev_mesh_manager; ///< Mesh registry active before the scope
+  DataManager<CouplingScheme>* m_prev_coupling_scheme_manager; ///< Coupling scheme registry active before the scope
+};
+
+} // end namespace tribol
+
+#endif /* SRC_INTERFACE_CONTEXT_HPP_ */
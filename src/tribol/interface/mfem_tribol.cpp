@@ -114,6 +114,13 @@ void registerMfemCouplingScheme( IndexT cs_id,
          ));
       }
    }
+   // with penalty enforcement, only the nodal response is transferred back to
+   // the parent mesh, so each face-pair straddling a ghost boundary can be
+   // evaluated on one rank and the partial responses summed
+   if (enforcement_method == PENALTY)
+   {
+      mfem_data->SetGhostPairOwnership(true);
+   }
    coupling_scheme.setMfemMeshData(std::move(mfem_data));
 
 }
@@ -132,6 +139,20 @@ void setMfemLORFactor( IndexT cs_id, int lor_factor )
    coupling_scheme->getMfemMeshData()->SetLORFactor(lor_factor);
 }
 
+void setMfemReducedGhostPrecision( IndexT cs_id, bool reduced_ghost_precision )
+{
+   auto coupling_scheme = CouplingSchemeManager::getInstance().findData(cs_id);
+   SLIC_ERROR_ROOT_IF( !coupling_scheme, 
+                       axom::fmt::format("Coupling scheme cs_id={0} does not exist. Call tribol::registerMfemCouplingScheme() "
+                       "to create a coupling scheme with this cs_id.", cs_id) );
+   SLIC_ERROR_ROOT_IF(
+      !coupling_scheme->hasMfemData(),
+      "Coupling scheme does not contain MFEM data. "
+      "Create the coupling scheme using registerMfemCouplingScheme() to set the ghost precision."
+   );
+   coupling_scheme->getMfemMeshData()->SetReducedGhostPrecision(reduced_ghost_precision);
+}
+
 void setMfemKinematicConstantPenalty( IndexT cs_id, 
                                       RealT mesh1_penalty,
                                       RealT mesh2_penalty )
@@ -407,6 +428,23 @@ void updateMfemParallelDecomposition()
             MemorySpace::Host
          );
 
+         // the search runs on rounded ghost coordinates, so the face radii
+         // are inflated by the rounding bound
+         if (mfem_data->HasReducedGhostPrecision())
+         {
+            const RealT inflation = mfem_data->GetGhostRadiusInflation();
+            MeshManager::getInstance().at(mesh_ids[0]).setFaceRadiusInflation(inflation);
+            MeshManager::getInstance().at(mesh_ids[1]).setFaceRadiusInflation(inflation);
+         }
+
+         if (mfem_data->HasGhostPairOwnership())
+         {
+            registerFaceOwnership(
+               mesh_ids[0], mfem_data->GetMesh1GlobalFaceIds(), mfem_data->GetMesh1GhostFaces());
+            registerFaceOwnership(
+               mesh_ids[1], mfem_data->GetMesh2GlobalFaceIds(), mfem_data->GetMesh2GhostFaces());
+         }
+
          auto f_ptrs = mfem_data->GetRedecompResponsePtrs();
          registerNodalResponse(
             mesh_ids[0], f_ptrs[0], f_ptrs[1], f_ptrs[2]);
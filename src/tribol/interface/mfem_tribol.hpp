@@ -91,6 +91,26 @@ void registerMfemCouplingScheme( IndexT cs_id,
  */
 void setMfemLORFactor( IndexT cs_id, int lor_factor );
 
+/**
+ * @brief Sets whether ghost coordinates are sent in reduced precision
+ *
+ * With reduced ghost precision, the coordinates (and velocities) of ghost
+ * elements on the redecomposed mesh are sent as floats. The search runs on the
+ * rounded coordinates with face radii inflated by the rounding bound, and the
+ * exact values of the ghost faces in the resulting interface pairs are fetched
+ * before the interface physics is evaluated. This reduces the communication
+ * volume of updateMfemParallelDecomposition() when most ghost elements are not
+ * in contact.
+ *
+ * @pre Coupling scheme cs_id must be registered using
+ * registerMfemCouplingScheme()
+ *
+ * @param [in] cs_id The ID of the coupling scheme
+ * @param [in] reduced_ghost_precision True to send reduced-precision ghost
+ * coordinates
+ */
+void setMfemReducedGhostPrecision( IndexT cs_id, bool reduced_ghost_precision );
+
 /**
  * @brief Clears existing penalty data and sets kinematic constant penalty
  *
@@ -9,8 +9,10 @@
 #include "tribol/common/Parameters.hpp"
 
 #include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/CouplingSchemeBatch.hpp"
 #include "tribol/mesh/MethodCouplingData.hpp"
 #include "tribol/mesh/InterfacePairs.hpp"
+#include "tribol/mesh/SurfaceExtraction.hpp"
 
 #include "tribol/geom/ContactPlane.hpp"
 #include "tribol/geom/GeomUtilities.hpp"
@@ -19,6 +21,7 @@
 
 #include "tribol/search/InterfacePairFinder.hpp"
 
+#include "tribol/utils/LoadBalance.hpp"
 #include "tribol/utils/Math.hpp"
 
 // Axom includes
@@ -29,6 +32,7 @@
 #include <string>
 #include <unordered_map>
 #include <fstream>
+#include <vector>
 
 //------------------------------------------------------------------------------
 // Interface Implementation
@@ -375,6 +379,134 @@ void enableTimestepVote( IndexT cs_id, const bool enable )
 
 } // end enableTimestepVote()
 
+//------------------------------------------------------------------------------
+void enableTimestepVoteDetails( IndexT cs_id, const bool enable )
+{
+   auto cs = CouplingSchemeManager::getInstance().findData(cs_id);
+  
+   // check to see if coupling scheme exists
+   SLIC_ERROR_ROOT_IF( !cs, 
+                       "tribol::enableTimestepVoteDetails(): call tribol::registerCouplingScheme() " <<
+                       "prior to calling this routine." );
+
+   cs->getTimestepVoteData().m_enabled = enable;
+
+} // end enableTimestepVoteDetails()
+
+//------------------------------------------------------------------------------
+void enablePairColoring( IndexT cs_id, const bool enable )
+{
+   auto cs = CouplingSchemeManager::getInstance().findData(cs_id);
+  
+   // check to see if coupling scheme exists
+   SLIC_ERROR_ROOT_IF( !cs, 
+                       "tribol::enablePairColoring(): call tribol::registerCouplingScheme() " <<
+                       "prior to calling this routine." );
+
+   cs->getParameters().enable_pair_coloring = enable;
+
+} // end enablePairColoring()
+
+//------------------------------------------------------------------------------
+void enableSchemeBatching( IndexT cs_id, const bool enable )
+{
+   auto cs = CouplingSchemeManager::getInstance().findData(cs_id);
+  
+   // check to see if coupling scheme exists
+   SLIC_ERROR_ROOT_IF( !cs, 
+                       "tribol::enableSchemeBatching(): call tribol::registerCouplingScheme() " <<
+                       "prior to calling this routine." );
+
+   cs->getParameters().enable_scheme_batching = enable;
+
+} // end enableSchemeBatching()
+
+//------------------------------------------------------------------------------
+void setAutoBinningInterval( IndexT cs_id, int interval )
+{
+   auto cs = CouplingSchemeManager::getInstance().findData(cs_id);
+  
+   // check to see if coupling scheme exists
+   SLIC_ERROR_ROOT_IF( !cs, 
+                       "tribol::setAutoBinningInterval(): call tribol::registerCouplingScheme() " <<
+                       "prior to calling this routine." );
+
+   SLIC_WARNING_ROOT_IF( interval < 0, "tribol::setAutoBinningInterval(): " <<
+                         "negative interval; trials of alternative binning methods are disabled." );
+
+   cs->getParameters().auto_binning_interval = axom::utilities::max( interval, 0 );
+
+} // end setAutoBinningInterval()
+
+//------------------------------------------------------------------------------
+void setLoadBalanceInterval( IndexT cs_id, int interval )
+{
+   auto cs = CouplingSchemeManager::getInstance().findData(cs_id);
+  
+   // check to see if coupling scheme exists
+   SLIC_ERROR_ROOT_IF( !cs, 
+                       "tribol::setLoadBalanceInterval(): call tribol::registerCouplingScheme() " <<
+                       "prior to calling this routine." );
+
+   SLIC_WARNING_ROOT_IF( interval < 0, "tribol::setLoadBalanceInterval(): " <<
+                         "negative interval; load balance diagnostics are disabled." );
+
+   cs->getParameters().load_balance_interval = axom::utilities::max( interval, 0 );
+
+} // end setLoadBalanceInterval()
+
+//------------------------------------------------------------------------------
+void setSleepingFaceMargin( IndexT cs_id, RealT margin )
+{
+   auto cs = CouplingSchemeManager::getInstance().findData(cs_id);
+  
+   // check to see if coupling scheme exists
+   SLIC_ERROR_ROOT_IF( !cs, 
+                       "tribol::setSleepingFaceMargin(): call tribol::registerCouplingScheme() " <<
+                       "prior to calling this routine." );
+
+   SLIC_WARNING_ROOT_IF( margin < 0., "tribol::setSleepingFaceMargin(): " <<
+                         "negative margin; sleeping faces are disabled." );
+
+   cs->getParameters().sleeping_face_margin = axom::utilities::max( margin, 0. );
+
+} // end setSleepingFaceMargin()
+
+//------------------------------------------------------------------------------
+void setPairBudget( IndexT cs_id, IndexT candidate_budget, IndexT contact_plane_budget )
+{
+   auto cs = CouplingSchemeManager::getInstance().findData(cs_id);
+  
+   // check to see if coupling scheme exists
+   SLIC_ERROR_ROOT_IF( !cs, 
+                       "tribol::setPairBudget(): call tribol::registerCouplingScheme() " <<
+                       "prior to calling this routine." );
+
+   SLIC_WARNING_ROOT_IF( candidate_budget < 0 || contact_plane_budget < 0, 
+                         "tribol::setPairBudget(): negative budgets are disabled." );
+
+   cs->getParameters().candidate_budget = axom::utilities::max( candidate_budget, IndexT{0} );
+   cs->getParameters().contact_plane_budget = axom::utilities::max( contact_plane_budget, IndexT{0} );
+
+} // end setPairBudget()
+
+//------------------------------------------------------------------------------
+void setOverlapCacheRatio( IndexT cs_id, RealT ratio )
+{
+   auto cs = CouplingSchemeManager::getInstance().findData(cs_id);
+  
+   // check to see if coupling scheme exists
+   SLIC_ERROR_ROOT_IF( !cs, 
+                       "tribol::setOverlapCacheRatio(): call tribol::registerCouplingScheme() " <<
+                       "prior to calling this routine." );
+
+   SLIC_WARNING_ROOT_IF( ratio < 0., "tribol::setOverlapCacheRatio(): " <<
+                         "negative ratio; the overlap cache is disabled." );
+
+   cs->getParameters().overlap_cache_ratio = axom::utilities::max( ratio, 0. );
+
+} // end setOverlapCacheRatio()
+
 //------------------------------------------------------------------------------
 void registerMesh( IndexT mesh_id,
                    IndexT num_elements,
@@ -391,6 +523,166 @@ void registerMesh( IndexT mesh_id,
       static_cast<InterfaceElementType>(element_type), x, y, z, mem_space));
 } // end registerMesh()
 
+//------------------------------------------------------------------------------
+void registerStridedMesh( IndexT mesh_id,
+                          IndexT num_elements,
+                          IndexT num_nodes,
+                          const IndexT* connectivity,
+                          int element_type,
+                          const RealT* coords,
+                          IndexT node_stride,
+                          IndexT component_stride,
+                          MemorySpace mem_space )
+{
+   // the component pointers are only used for mesh verification; the strided
+   // views are set below
+   const RealT* y = (coords != nullptr) ? coords + component_stride : nullptr;
+   const RealT* z = (coords != nullptr) ? coords + 2*component_stride : nullptr;
+   auto& mesh = MeshManager::getInstance().addData(mesh_id, MeshData(
+      mesh_id, num_elements, num_nodes, connectivity, 
+      static_cast<InterfaceElementType>(element_type), coords, y, z, mem_space));
+   mesh.setPosition(coords, node_stride, component_stride);
+} // end registerStridedMesh()
+
+//------------------------------------------------------------------------------
+IndexT registerVolumeMeshSurface( IndexT mesh_id,
+                                  IndexT num_elements,
+                                  IndexT num_nodes,
+                                  const IndexT* connectivity,
+                                  int element_type,
+                                  const RealT* x,
+                                  const RealT* y,
+                                  const RealT* z,
+                                  const int* face_attributes,
+                                  int attribute,
+                                  ExecutionMode exec_mode )
+{
+   auto vol_type = static_cast<InterfaceElementType>(element_type);
+   auto face_type = getVolumeElementFaceType( vol_type );
+   SLIC_ERROR_ROOT_IF( face_type == UNDEFINED_ELEMENT, "tribol::registerVolumeMeshSurface(): " <<
+                       "element_type must be LINEAR_HEX or LINEAR_TET." );
+
+   Array2D<IndexT> surface_conn = extractSurfaceFaces( num_elements, connectivity, vol_type,
+                                                       x, y, z, face_attributes, attribute,
+                                                       exec_mode );
+   IndexT num_faces = surface_conn.shape()[0];
+
+   SLIC_DEBUG_ROOT("tribol::registerVolumeMeshSurface(): extracted " << num_faces << 
+                   " surface faces for mesh id " << mesh_id << ".");
+
+   auto& mesh = MeshManager::getInstance().addData(mesh_id, MeshData(
+      mesh_id, num_faces, num_nodes, surface_conn.data(), face_type, x, y, z, 
+      MemorySpace::Host));
+   mesh.setOwnedConnectivity( std::move(surface_conn) );
+
+   return num_faces;
+} // end registerVolumeMeshSurface()
+
+//------------------------------------------------------------------------------
+void registerRigidSurface( IndexT mesh_id,
+                           int dim,
+                           int surface_type,
+                           const RealT* point,
+                           const RealT* direction,
+                           RealT radius,
+                           bool contact_inside,
+                           MemorySpace mem_space )
+{
+   SLIC_ERROR_ROOT_IF( dim != 2 && dim != 3, 
+                       "tribol::registerRigidSurface(): dim must be 2 or 3." );
+   SLIC_ERROR_ROOT_IF( !in_range(surface_type, NUM_RIGID_SURFACE_TYPES), 
+                       "tribol::registerRigidSurface(): invalid surface type for mesh id " <<
+                       mesh_id << "." );
+   SLIC_ERROR_ROOT_IF( surface_type != RIGID_PLANE && radius <= 0., 
+                       "tribol::registerRigidSurface(): " << 
+                       getRigidSurfaceTypeName(static_cast<RigidSurfaceType>(surface_type)) << 
+                       " requires a positive radius." );
+
+   // the element type only records the spatial dimension; a rigid surface has 
+   // no elements or nodes
+   InterfaceElementType element_type = (dim == 2) ? LINEAR_EDGE : LINEAR_QUAD;
+   auto& mesh = MeshManager::getInstance().addData(mesh_id, MeshData(
+      mesh_id, 0, 0, nullptr, element_type, nullptr, nullptr, nullptr, mem_space));
+
+   RigidSurface surf;
+   surf.m_type = static_cast<RigidSurfaceType>(surface_type);
+   surf.m_dim = dim;
+   surf.m_radius = radius;
+   surf.m_contact_inside = contact_inside;
+   mesh.setRigidSurface(surf);
+
+   setRigidSurfaceMotion(mesh_id, point, direction);
+
+} // end registerRigidSurface()
+
+//------------------------------------------------------------------------------
+void setRigidSurfaceMotion( IndexT mesh_id,
+                            const RealT* point,
+                            const RealT* direction,
+                            const RealT* velocity )
+{
+   auto mesh = MeshManager::getInstance().findData(mesh_id);
+
+   SLIC_ERROR_ROOT_IF( !mesh || !mesh->isRigidSurface(), 
+                       "tribol::setRigidSurfaceMotion(): call tribol::registerRigidSurface() " <<
+                       "for mesh id " << mesh_id << " prior to calling this routine." );
+
+   RigidSurface surf = mesh->getRigidSurface();
+   const int dim = surf.m_dim;
+   if (point != nullptr)
+   {
+      for (int d{0}; d < dim; ++d)
+      {
+         surf.m_point[d] = point[d];
+      }
+   }
+   if (direction != nullptr)
+   {
+      RealT mag = magnitude( direction[0], direction[1], (dim == 3) ? direction[2] : 0. );
+      SLIC_ERROR_ROOT_IF( mag < 1.e-15, "tribol::setRigidSurfaceMotion(): " << 
+                          "zero direction vector for mesh id " << mesh_id << "." );
+      initRealArray( surf.m_dir, 3, 0. );
+      for (int d{0}; d < dim; ++d)
+      {
+         surf.m_dir[d] = direction[d] / mag;
+      }
+   }
+   if (velocity != nullptr)
+   {
+      for (int d{0}; d < dim; ++d)
+      {
+         surf.m_vel[d] = velocity[d];
+      }
+   }
+   mesh->setRigidSurface(surf);
+
+} // end setRigidSurfaceMotion()
+
+//------------------------------------------------------------------------------
+void registerFaceOwnership( IndexT mesh_id,
+                            const IndexT* global_face_ids,
+                            const bool* ghost_faces )
+{
+   auto mesh = MeshManager::getInstance().findData(mesh_id);
+
+   SLIC_ERROR_ROOT_IF( !mesh, "tribol::registerFaceOwnership(): " << 
+                       "no mesh with id " << mesh_id << " exists." );
+
+   if (mesh->numberOfElements() == 0)
+   {
+      return;
+   }
+
+   SLIC_ERROR_ROOT_IF( global_face_ids == nullptr || ghost_faces == nullptr, 
+                       "tribol::registerFaceOwnership(): null pointer to face ownership " <<
+                       "data on mesh " << mesh_id << "." );
+
+   auto& elem_data = mesh->getElementData();
+   elem_data.m_global_face_ids = ArrayViewT<const IndexT>(global_face_ids, mesh->numberOfElements());
+   elem_data.m_ghost_faces = ArrayViewT<const bool>(ghost_faces, mesh->numberOfElements());
+
+} // end registerFaceOwnership()
+
 //------------------------------------------------------------------------------
 void registerNodalDisplacements( IndexT mesh_id,
                                  const RealT* dx,
@@ -421,6 +713,23 @@ void registerNodalDisplacements( IndexT mesh_id,
 
 } // end registerNodalDisplacements()
 
+//------------------------------------------------------------------------------
+void registerStridedNodalDisplacements( IndexT mesh_id,
+                                        const RealT* disp,
+                                        IndexT node_stride,
+                                        IndexT component_stride )
+{
+   auto mesh = MeshManager::getInstance().findData(mesh_id);
+
+   SLIC_ERROR_ROOT_IF(!mesh, "tribol::registerStridedNodalDisplacements(): " << 
+                      "no mesh with id, " << mesh_id << "exists.");
+
+   mesh->getNodalFields().m_is_nodal_displacement_set = (disp != nullptr);
+
+   mesh->setDisplacement(disp, node_stride, component_stride);
+
+} // end registerStridedNodalDisplacements()
+
 //------------------------------------------------------------------------------
 void registerNodalVelocities( IndexT mesh_id,
                               const RealT* vx,
@@ -451,6 +760,23 @@ void registerNodalVelocities( IndexT mesh_id,
 
 } // end registerNodalVelocities()
 
+//------------------------------------------------------------------------------
+void registerStridedNodalVelocities( IndexT mesh_id,
+                                     const RealT* vel,
+                                     IndexT node_stride,
+                                     IndexT component_stride )
+{
+   auto mesh = MeshManager::getInstance().findData(mesh_id);
+
+   SLIC_ERROR_ROOT_IF(!mesh, "tribol::registerStridedNodalVelocities(): " << 
+                      "no mesh with id, " << mesh_id << "exists.");
+
+   mesh->getNodalFields().m_is_velocity_set = (vel != nullptr);
+
+   mesh->setVelocity(vel, node_stride, component_stride);
+
+} // end registerStridedNodalVelocities()
+
 //------------------------------------------------------------------------------
 void registerNodalResponse( IndexT mesh_id,
                             RealT* rx,
@@ -480,6 +806,23 @@ void registerNodalResponse( IndexT mesh_id,
 
 } // end registerNodalResponse()
 
+//------------------------------------------------------------------------------
+void registerStridedNodalResponse( IndexT mesh_id,
+                                   RealT* response,
+                                   IndexT node_stride,
+                                   IndexT component_stride )
+{
+   auto mesh = MeshManager::getInstance().findData(mesh_id);
+
+   SLIC_ERROR_ROOT_IF(!mesh, "tribol::registerStridedNodalResponse(): " << 
+                      "no mesh with id, " << mesh_id << "exists.");
+
+   mesh->getNodalFields().m_is_nodal_response_set = (response != nullptr);
+
+   mesh->setResponse(response, node_stride, component_stride);
+
+} // end registerStridedNodalResponse()
+
 //------------------------------------------------------------------------------
 int getJacobianSparseMatrix( mfem::SparseMatrix ** sMat, IndexT cs_id )
 {
@@ -596,6 +939,52 @@ int getElementBlockJacobians( IndexT cs_id,
 
 } // end getElementBlockJacobians()
 
+//------------------------------------------------------------------------------
+int getTimestepVoteDetails( IndexT cs_id,
+                            const ArrayT<RealT>** pair_dt,
+                            const ArrayT<IndexT, 2>** pair_faces,
+                            const ArrayT<RealT>** node_dt1,
+                            const ArrayT<RealT>** node_dt2,
+                            const ArrayT<IndexT>** histogram )
+{
+   auto cs = CouplingSchemeManager::getInstance().findData(cs_id);
+
+   SLIC_ERROR_IF(!cs, "tribol::getTimestepVoteDetails(): invalid " << 
+                 "CouplingScheme id.");
+
+   const auto& vote_data = cs->getTimestepVoteData();
+   if (!vote_data.m_enabled)
+   {
+      SLIC_WARNING("tribol::getTimestepVoteDetails(): call " << 
+                   "tribol::enableTimestepVoteDetails() prior to calling tribol::update().");
+      return 1;
+   }
+
+   if (pair_dt != nullptr)
+   {
+      *pair_dt = &vote_data.m_pair_dt;
+   }
+   if (pair_faces != nullptr)
+   {
+      *pair_faces = &vote_data.m_pair_faces;
+   }
+   if (node_dt1 != nullptr)
+   {
+      *node_dt1 = &vote_data.m_node_dt1;
+   }
+   if (node_dt2 != nullptr)
+   {
+      *node_dt2 = &vote_data.m_node_dt2;
+   }
+   if (histogram != nullptr)
+   {
+      *histogram = &vote_data.m_histogram;
+   }
+
+   return 0;
+
+} // end getTimestepVoteDetails()
+
 //------------------------------------------------------------------------------
 void registerMortarGaps( IndexT mesh_id,
                          RealT * gaps )
@@ -946,16 +1335,28 @@ int update( int cycle, RealT t, RealT &dt )
    // which may arise from host-code registration or from skipped schemes // 
    //                                                                     //
    /////////////////////////////////////////////////////////////////////////
+   // coupling schemes with batching enabled are grouped with compatible 
+   // coupling schemes. the contact planes of each group are computed in 
+   // a single kernel launch after the coupling scheme loop, followed by the
+   // common plane penalty enforcement and timestep vote of the group (see 
+   // applyPhysicsBatched()). binning still runs per coupling scheme.
+   std::vector<std::vector<CouplingScheme*>> batches;
+
    for (auto& cs_pair : CouplingSchemeManager::getInstance())
    {
       auto& cs = cs_pair.second;
 
+      // a skipped coupling scheme reports no work in the load balance
+      // diagnostics below
+      cs.getLoadBalanceData().clearLocal();
+
       // initialize and check for valid coupling scheme. If not valid, the coupling 
       // scheme will not be valid across all ranks and we will skip this coupling scheme
       if (!cs.init())
       {
          SLIC_WARNING_ROOT("tribol::update(): skipping invalid CouplingScheme " << 
                            cs_pair.first << "Please see warnings.");
+         cs.updateExactGhostData();
          continue;
       }
 
@@ -963,6 +1364,29 @@ int update( int cycle, RealT t, RealT &dt )
       // Note, this routine is guarded against null meshes
       cs.performBinning();
 
+      // replace reduced-precision ghost coordinates of the binned faces with
+      // exact values (mfem meshes only)
+      cs.updateExactGhostData();
+
+      if (canBatchCouplingSchemes( cs, cs ))
+      {
+         bool batched = false;
+         for (auto& batch : batches)
+         {
+            if (canBatchCouplingSchemes( *batch[0], cs ))
+            {
+               batch.push_back( &cs );
+               batched = true;
+               break;
+            }
+         }
+         if (!batched)
+         {
+            batches.push_back( { &cs } );
+         }
+         continue;
+      }
+
       // apply the coupling scheme. Note, there are appropriate guards against zero 
       // element meshes, or null-mesh coupling schemes
       err_cs = cs.apply( cycle, t, dt );
@@ -975,6 +1399,46 @@ int update( int cycle, RealT t, RealT &dt )
 
    } // end of coupling scheme loop
 
+   // loop over batches of coupling schemes
+   for (auto& batch : batches)
+   {
+      axom::utilities::Timer timer( true );
+      computeContactPlanesBatched( batch );
+      timer.stop();
+
+      // the geometry time of a batch is split evenly between its coupling schemes
+      for (auto cs : batch)
+      {
+         cs->getLoadBalanceData().m_local[LB_GEOMETRY_TIME] = timer.elapsedTimeInSec() / batch.size();
+      }
+
+      auto batch_err = applyPhysicsBatched( batch, cycle, t, dt );
+      for (size_t s{0}; s < batch.size(); ++s)
+      {
+         err_cs = batch_err[s];
+
+         if ( err_cs != 0 )
+         {
+            SLIC_WARNING("tribol::update(): coupling scheme " << batch[s]->getId() <<
+                         " returned with an error.");
+         }
+      }
+
+   } // end of batch loop
+
+   // periodically compute the distribution of the contact work across ranks.
+   // This is collective, so it runs for every registered coupling scheme on 
+   // every rank, including coupling schemes skipped on this rank.
+   for (auto& cs_pair : CouplingSchemeManager::getInstance())
+   {
+      auto& cs = cs_pair.second;
+      const int interval = cs.getParameters().load_balance_interval;
+      if (interval > 0 && cycle % interval == 0)
+      {
+         computeLoadBalance( cs, cycle );
+      }
+   }
+
    return err_cs;
 
 } // end update()
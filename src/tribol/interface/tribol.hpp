@@ -9,6 +9,8 @@
 #include "tribol/common/ExecModel.hpp"
 #include "tribol/common/ArrayTypes.hpp"
 #include "tribol/common/Parameters.hpp"
+#include "tribol/interface/Context.hpp"
+#include "tribol/search/ProximityQuery.hpp"
 
 #include <string>
 
@@ -212,6 +214,137 @@ void setLoggingLevel( IndexT cs_id, LoggingLevel log_level );
  */
 void enableTimestepVote( IndexT cs_id, const bool enable );
 
+/*!
+ * \brief Enable storage of per-pair and per-node critical timesteps 
+ *
+ * \param [in] cs_id coupling scheme id
+ * \param [in] enable per-pair and per-node timestep votes and a histogram of
+ *                    the per-pair votes are stored if true
+ *
+ * \note the timestep vote must also be enabled with enableTimestepVote(). Use
+ * getTimestepVoteDetails() to access the data after calling update().
+ *
+ */
+void enableTimestepVoteDetails( IndexT cs_id, const bool enable );
+
+/*!
+ * \brief Enable coloring of the active face-pairs by shared nodes 
+ *
+ * \param [in] cs_id coupling scheme id
+ * \param [in] enable nodal forces are assembled one pair color at a time 
+ *                    without atomics if true
+ *
+ * \note coloring yields nodal forces that do not depend on the order in which
+ * pairs are processed. Currently used by COMMON_PLANE with PENALTY enforcement.
+ *
+ */
+void enablePairColoring( IndexT cs_id, const bool enable );
+
+/*!
+ * \brief Enable batching of the coupling scheme with compatible coupling schemes
+ *
+ * \param [in] cs_id coupling scheme id
+ * \param [in] enable the coupling scheme shares kernel launches with other 
+ *                    coupling schemes with batching enabled if true
+ *
+ * \note coupling schemes are compatible if they have the same execution mode,
+ * contact method, contact case, enforcement method and element types. The 
+ * interface pairs of compatible coupling schemes are checked in a single loop
+ * during tribol::update(), which removes the per-scheme launches and host 
+ * readbacks of the contact plane phase. For COMMON_PLANE + PENALTY coupling 
+ * schemes with the same penalty constraint type and without pair coloring, 
+ * the enforcement and the timestep vote also run as single loops, and all 
+ * coupling schemes of a batch vote on the timestep entering the batch. Face 
+ * data and binning still run per coupling scheme. Rigid surface coupling 
+ * schemes are never batched.
+ *
+ */
+void enableSchemeBatching( IndexT cs_id, const bool enable );
+
+/*!
+ * \brief Sets the number of searches between trials of alternative binning 
+ *        methods for a coupling scheme registered with BINNING_AUTO
+ *
+ * \param [in] cs_id coupling scheme id
+ * \param [in] interval number of searches between trials; 0 disables trials
+ *
+ * \note With BINNING_AUTO, the first search uses a method chosen from mesh 
+ * statistics. Each trial times one search with another applicable method, and
+ * the coupling scheme switches to a method that is consistently faster.
+ *
+ */
+void setAutoBinningInterval( IndexT cs_id, int interval );
+
+/*!
+ * \brief Sets the number of cycles between cross-rank load balance 
+ *        diagnostics for a coupling scheme
+ *
+ * \param [in] cs_id coupling scheme id
+ * \param [in] interval number of cycles between diagnostics; 0 disables them
+ *
+ * \note The diagnostics gather the candidate pairs, active pairs, geometry 
+ * time, and enforcement time of each rank, and log the ratio of the maximum to
+ * the average and the most loaded rank on the root rank. They are collective
+ * over the coupling scheme's communicator and run at the end of update(), 
+ * also on ranks where the coupling scheme is skipped (which report no work),
+ * so the interval must be the same on every rank.
+ *
+ */
+void setLoadBalanceInterval( IndexT cs_id, int interval );
+
+/*!
+ * \brief Sets the distance margin used to skip isolated faces in the search
+ *
+ * \param [in] cs_id coupling scheme id
+ * \param [in] margin distance margin; 0 disables sleeping faces
+ *
+ * \note A mesh 2 face whose bounding box, inflated by the margin, overlaps no 
+ * mesh 1 box is put to sleep and skipped by later searches. It is woken once 
+ * the motion of its bounding box plus the largest motion of a mesh 1 box 
+ * could have closed the margin. Box motion includes changes of the face normal
+ * and radius. The candidate pairs are unchanged. Only used with 
+ * BINNING_BVH.
+ *
+ */
+void setSleepingFaceMargin( IndexT cs_id, RealT margin );
+
+/*!
+ * \brief Sets the candidate pair and contact plane budgets of a coupling scheme
+ *
+ * \param [in] cs_id coupling scheme id
+ * \param [in] candidate_budget target number of unfiltered candidate pairs; 0 disables the budget
+ * \param [in] contact_plane_budget number of contact planes allocated at once; 0 disables the budget
+ *
+ * \note With a candidate budget, BINNING_BVH queries the mesh 2 faces in 
+ * chunks so the unfiltered candidate arrays stay near the budget when the
+ * candidate density is stable. The first chunk of each search holds at most
+ * an eighth of the faces. With a 
+ * contact plane budget, the contact planes are computed in chunks of pairs and
+ * their storage grows with the active planes rather than with the number of 
+ * pairs. Exceeding either budget is logged as a warning and counted (see 
+ * CouplingScheme::getPairBudgetData()). Coupling schemes with a contact plane
+ * budget are not batched.
+ *
+ */
+void setPairBudget( IndexT cs_id, IndexT candidate_budget, IndexT contact_plane_budget );
+
+/*!
+ * \brief Sets the relative face motion below which cached overlap polygons are reused
+ *
+ * \param [in] cs_id coupling scheme id
+ * \param [in] ratio ratio of the largest face radius of a face-pair; 0 disables the cache
+ *
+ * \note Applies to 3D COMMON_PLANE coupling schemes. Each face-pair in contact
+ * caches its overlap polygon in a frame attached to face 1. While the nodal 
+ * motion of the two faces relative to each other stays below the tolerance, 
+ * the next cycles reuse the polygon and only recompute the contact plane 
+ * normal, point and gap. The hit rate is reported in the coupling scheme's 
+ * overlap cache data (see CouplingScheme::getOverlapCacheData()). Coupling 
+ * schemes with an overlap cache are not batched.
+ *
+ */
+void setOverlapCacheRatio( IndexT cs_id, RealT ratio );
+
 /// @}
 
 /// \name Contact Surface Registration Methods
@@ -248,6 +381,154 @@ void registerMesh( IndexT mesh_id,
                    const RealT* z = nullptr,
                    MemorySpace m_space = MemorySpace::Host );
 
+/*!
+ * \brief Registers the mesh description for a contact surface with
+ *        interleaved (xyzxyz...) or blocked (xx...yy...zz...) coordinates
+ *
+ * \param [in] mesh_id the ID of the contact surface
+ * \param [in] num_elements the number of elements on the contact surface
+ * \param [in] num_nodes length of the data arrays being registered
+ * \param [in] connectivity mesh connectivity array for the contact surface
+ * \param [in] element_type the cell type of the contact surface elements
+ * \param [in] coords array of mesh coordinates
+ * \param [in] node_stride distance between the coordinates of consecutive nodes
+ * \param [in] component_stride distance between consecutive coordinate 
+ *             components of a node
+ * \param [in] m_space Memory space of the connectivity and coordinate arrays
+ *
+ * \pre connectivity != nullptr
+ * \pre coords != nullptr
+ *
+ * \note Component d of node i is coords[i*node_stride + d*component_stride].
+ * Interleaved coordinates use node_stride = dim and component_stride = 1; 
+ * blocked coordinates use node_stride = 1 and component_stride = num_nodes.
+ * The coordinates are not copied.
+ */
+void registerStridedMesh( IndexT mesh_id,
+                          IndexT num_elements,
+                          IndexT num_nodes,
+                          const IndexT* connectivity,
+                          int element_type,
+                          const RealT* coords,
+                          IndexT node_stride,
+                          IndexT component_stride,
+                          MemorySpace m_space = MemorySpace::Host );
+
+/*!
+ * \brief Extracts the boundary surface of a linear volume mesh and registers
+ *        it as a contact surface
+ *
+ * \param [in] mesh_id the ID of the contact surface
+ * \param [in] num_elements the number of volume elements
+ * \param [in] num_nodes length of the nodal data arrays being registered
+ * \param [in] connectivity volume element connectivity array
+ * \param [in] element_type the volume element type (LINEAR_HEX or LINEAR_TET)
+ * \param [in] x array of x-components of the mesh coordinates
+ * \param [in] y array of y-components of the mesh coordinates
+ * \param [in] z array of z-components of the mesh coordinates
+ * \param [in] face_attributes optional attribute of each local element face
+ * \param [in] attribute only boundary faces with this attribute are registered
+ *             if face_attributes is not null
+ * \param [in] exec_mode host execution mode used for the extraction
+ *
+ * \pre connectivity != nullptr
+ * \pre x, y, z != nullptr
+ * \pre connectivity and coordinates are in host accessible memory
+ *
+ * \note connectivity is a 2D array with num_elements rows and 8 (hex) or 4
+ * (tet) columns with row-major ordering. face_attributes, if given, is a 2D
+ * array with num_elements rows and 6 (hex) or 4 (tet) columns. The extracted
+ * surface connectivity is owned by Tribol, is oriented with outward normals, 
+ * and indexes into the registered nodal arrays. Surface elements are
+ * LINEAR_QUAD for hex meshes and LINEAR_TRIANGLE for tet meshes.
+ *
+ * \return number of surface faces registered
+ */
+IndexT registerVolumeMeshSurface( IndexT mesh_id,
+                                  IndexT num_elements,
+                                  IndexT num_nodes,
+                                  const IndexT* connectivity,
+                                  int element_type,
+                                  const RealT* x,
+                                  const RealT* y,
+                                  const RealT* z,
+                                  const int* face_attributes = nullptr,
+                                  int attribute = 0,
+                                  ExecutionMode exec_mode = ExecutionMode::Sequential );
+
+/*!
+ * \brief Registers an analytic rigid surface as a contact surface
+ *
+ * \param [in] mesh_id the ID of the contact surface
+ * \param [in] dim spatial dimension of the contact problem
+ * \param [in] surface_type the type of rigid surface (see RigidSurfaceType)
+ * \param [in] point point on the plane, or center (axis point) of the sphere 
+ *             (cylinder)
+ * \param [in] direction outward normal of the plane, or axis of the cylinder
+ * \param [in] radius radius of the cylinder or sphere
+ * \param [in] contact_inside true if deformable surfaces contact the inside of
+ *             the cylinder or sphere
+ * \param [in] m_space Memory space of the deformable meshes it is coupled with
+ *
+ * \pre point != nullptr
+ * \pre direction != nullptr for planes and 3D cylinders
+ *
+ * \note A rigid surface may only be the second mesh of a COMMON_PLANE + 
+ * PENALTY coupling scheme. Contact is evaluated by signed distance queries 
+ * at the nodes of the first mesh, with no search or contact planes. In 2D, 
+ * cylinders and spheres are both circles. The direction is normalized.
+ */
+void registerRigidSurface( IndexT mesh_id,
+                           int dim,
+                           int surface_type,
+                           const RealT* point,
+                           const RealT* direction,
+                           RealT radius = 0.,
+                           bool contact_inside = false,
+                           MemorySpace m_space = MemorySpace::Host );
+
+/*!
+ * \brief Updates the rigid body motion of a rigid surface
+ *
+ * \param [in] mesh_id the ID of the rigid surface
+ * \param [in] point current point on the plane, or center (axis point) of the
+ *             sphere (cylinder)
+ * \param [in] direction current outward normal or axis
+ * \param [in] velocity current translational velocity used in gap-rate 
+ *             penalty enforcement
+ *
+ * \pre registerRigidSurface() has been called for mesh_id
+ *
+ * \note Null arguments leave the corresponding value unchanged.
+ */
+void setRigidSurfaceMotion( IndexT mesh_id,
+                            const RealT* point,
+                            const RealT* direction,
+                            const RealT* velocity = nullptr );
+
+/*!
+ * \brief Registers the parallel ownership of the faces of a contact surface
+ *
+ * \param [in] mesh_id the ID of the contact surface
+ * \param [in] global_face_ids global id of each face, unique over all ranks 
+ *             and over both meshes of a coupling scheme
+ * \param [in] ghost_faces true if a face is a ghost copy of a face owned by 
+ *             another rank
+ *
+ * \pre global_face_ids and ghost_faces have one entry per registered face and
+ *      are in host accessible memory
+ *
+ * \note If both meshes of a coupling scheme have ownership data, a face-pair 
+ * found by the search is only kept on the rank owning the face with the lower
+ * global id, so each pair straddling a ghost boundary is evaluated once. The 
+ * host code must then sum the nodal responses of all ranks, including those 
+ * on ghost nodes. Ownership data must be registered again after each call to 
+ * registerMesh().
+ */
+void registerFaceOwnership( IndexT mesh_id,
+                            const IndexT* global_face_ids,
+                            const bool* ghost_faces );
+
 /*!
  * \brief Registers nodal displacements on the contact surface.
  *
@@ -268,6 +549,25 @@ void registerNodalDisplacements( IndexT mesh_id,
                                  const RealT* dy,
                                  const RealT* dz=nullptr );
 
+/*!
+ * \brief Registers interleaved or blocked nodal displacements on the contact
+ *        surface.
+ *
+ * \param [in] mesh_id the ID of the contact surface.
+ * \param [in] disp array consisting of the displacements
+ * \param [in] node_stride distance between the displacements of consecutive nodes
+ * \param [in] component_stride distance between consecutive displacement 
+ *             components of a node
+ *
+ * \pre disp != nullptr
+ *
+ * \note See registerStridedMesh() for the layout of the data.
+ */
+void registerStridedNodalDisplacements( IndexT mesh_id,
+                                        const RealT* disp,
+                                        IndexT node_stride,
+                                        IndexT component_stride );
+
 /*!
  * \brief Registers nodal velocities on the contact surface.
  *
@@ -288,6 +588,25 @@ void registerNodalVelocities( IndexT mesh_id,
                               const RealT* vy,
                               const RealT* vz=nullptr );
 
+/*!
+ * \brief Registers interleaved or blocked nodal velocities on the contact 
+ *        surface.
+ *
+ * \param [in] mesh_id the ID of the contact surface.
+ * \param [in] vel array consisting of the velocities
+ * \param [in] node_stride distance between the velocities of consecutive nodes
+ * \param [in] component_stride distance between consecutive velocity 
+ *             components of a node
+ *
+ * \pre vel != nullptr
+ *
+ * \note See registerStridedMesh() for the layout of the data.
+ */
+void registerStridedNodalVelocities( IndexT mesh_id,
+                                     const RealT* vel,
+                                     IndexT node_stride,
+                                     IndexT component_stride );
+
 /*!
  * \brief Registers nodal response buffers.
  *
@@ -308,6 +627,25 @@ void registerNodalResponse( IndexT mesh_id,
                             RealT* ry,
                             RealT* rz=nullptr );
 
+/*!
+ * \brief Registers an interleaved or blocked nodal response buffer.
+ *
+ * \param [in] mesh_id the ID of the contact surface.
+ * \param [in,out] response buffer of the contact response
+ * \param [in] node_stride distance between the responses of consecutive nodes
+ * \param [in] component_stride distance between consecutive response 
+ *             components of a node
+ *
+ * \pre response != nullptr
+ *
+ * \note See registerStridedMesh() for the layout of the data. Contact forces
+ * are accumulated directly into the buffer.
+ */
+void registerStridedNodalResponse( IndexT mesh_id,
+                                   RealT* response,
+                                   IndexT node_stride,
+                                   IndexT component_stride );
+
 /*!
  * \brief Get mfem sparse matrix for method specific Jacobian matrix output 
  *
@@ -407,6 +745,38 @@ int getElementBlockJacobians( IndexT cs_id,
                               const ArrayT<int>** col_elem_idx,
                               const ArrayT<mfem::DenseMatrix>** jacobians );
 
+/*!
+ * \brief Get the per-pair and per-node critical timesteps from the last
+ * timestep vote
+ *
+ * \param [in]  cs_id coupling scheme id
+ * \param [out] pair_dt pointer to pointer to array of critical timesteps of
+ * each active pair
+ * \param [out] pair_faces pointer to pointer to 2D array (num pairs x 2) of
+ * the mesh 1 and mesh 2 face ids of each active pair
+ * \param [out] node_dt1 pointer to pointer to array of critical timesteps of
+ * each node on mesh 1
+ * \param [out] node_dt2 pointer to pointer to array of critical timesteps of
+ * each node on mesh 2
+ * \param [out] histogram pointer to pointer to array of pair counts. Bin k
+ * counts pairs with critical timestep in [dt/2^(k+1), dt/2^k), where dt is the
+ * timestep passed to update(); the last bin also counts smaller timesteps.
+ *
+ * Pairs and nodes that do not restrict the timestep report the timestep passed
+ * to update(). Any output argument may be nullptr if it is not needed.
+ *
+ * @note The second pointer of the double pointer is updated by this function to 
+ * point to internally stored arrays in the coupling scheme's memory space.
+ *
+ * \return 0 success (if timestep vote details exist), nonzero for failure
+ */
+int getTimestepVoteDetails( IndexT cs_id,
+                            const ArrayT<RealT>** pair_dt,
+                            const ArrayT<IndexT, 2>** pair_faces,
+                            const ArrayT<RealT>** node_dt1,
+                            const ArrayT<RealT>** node_dt2,
+                            const ArrayT<IndexT>** histogram );
+
 /*!
  * \brief Register gap field on a nonmortar surface mesh associated with the
  * mortar method
@@ -460,7 +830,7 @@ void registerIntElementField( IndexT mesh_id,
  * \param [in] contact_method the contact method, e.g. SINGLE_MORTAR
  * \param [in] contact_model the contact model, e.g. COULOMB
  * \param [in] enforcement_method the enforcement method, e.g. PENALTY
- * \param [in] binning_method the binning method, e.g. BINNING_GRID
+ * \param [in] binning_method the binning method, e.g. BINNING_GRID or BINNING_AUTO
  * \param [in] given_exec_mode preferred execution mode for RAJA kernels
  *
  * \note A mesh for the given contact surface must have already been registered
@@ -518,6 +888,9 @@ int update( int cycle, RealT t, RealT &dt );
 
 /*!
  * \brief Finalizes
+ *
+ * \note Removes the coupling schemes of the current context of the calling 
+ * thread (see ContextScope)
  */
 void finalize();
 
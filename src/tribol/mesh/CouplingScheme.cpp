@@ -146,6 +146,12 @@ void CouplingSchemeErrors::printMethodErrors()
          SLIC_WARNING_ROOT("User must call tribol::registerNodalResponse() for each mesh to use this ContactMethod.");
          break;
       }
+      case INVALID_RIGID_SURFACE_METHOD:
+      {
+         SLIC_WARNING_ROOT("Rigid surfaces are only supported as the second mesh of COMMON_PLANE + " <<
+                           "PENALTY coupling schemes.");
+         break;
+      }
       case NO_METHOD_ERROR:
       {
          break;
@@ -444,11 +450,24 @@ bool CouplingScheme::isValidCouplingScheme()
       return false;
    }
 
-   // set boolean for null meshes
-   this->m_nullMeshes = this->m_mesh1->numberOfElements() <= 0 || this->m_mesh2->numberOfElements() <= 0;
+   // set boolean for null meshes. A rigid surface has no elements, but is not 
+   // a null mesh.
+   this->m_nullMeshes = this->m_mesh1->numberOfElements() <= 0 || 
+      (this->m_mesh2->numberOfElements() <= 0 && !this->m_mesh2->isRigidSurface());
 
-   // check for invalid mesh topology matches in a coupling scheme
-   if (this->m_mesh1->getElementType() != this->m_mesh2->getElementType())
+   // check for invalid mesh topology matches in a coupling scheme. The element
+   // type of a rigid surface only records its dimension.
+   if (this->m_mesh2->isRigidSurface())
+   {
+      if (this->m_mesh1->spatialDimension() != this->m_mesh2->spatialDimension())
+      {
+         SLIC_WARNING_ROOT("Coupling scheme " << this->m_id << " has a rigid surface with a " <<
+                           "different dimension than the deformable mesh.");
+         this->m_mesh1->isMeshValid() = false;
+         this->m_mesh2->isMeshValid() = false;
+      }
+   }
+   else if (this->m_mesh1->getElementType() != this->m_mesh2->getElementType())
    {
       SLIC_WARNING_ROOT("Coupling scheme " << this->m_id << " does not support meshes with " << 
                         "different surface element types.");
@@ -586,6 +605,13 @@ bool CouplingScheme::isValidCase()
       this->m_contactCase = NO_CASE;
    }
 
+   // NODE_TO_SURFACE only supports the default case
+   if (this->m_contactMethod == NODE_TO_SURFACE && this->m_contactCase != NO_CASE)
+   {
+      this->m_couplingSchemeErrors.cs_case_error = NO_CASE_IMPLEMENTATION;
+      isValid = false;
+   }
+
    if (this->m_contactMethod == COMMON_PLANE)
    {
       switch (this->m_contactCase)
@@ -640,6 +666,16 @@ bool CouplingScheme::isValidMethod()
 
    int dim = this->spatialDimension();
 
+   // rigid surfaces are evaluated with nodal signed distance queries and common
+   // plane penalty stiffness only
+   if (this->m_mesh1->isRigidSurface() || 
+       (this->m_mesh2->isRigidSurface() && 
+        (this->m_contactMethod != COMMON_PLANE || this->m_enforcementMethod != PENALTY)))
+   {
+      this->m_couplingSchemeErrors.cs_method_error = INVALID_RIGID_SURFACE_METHOD;
+      return false;
+   }
+
    // check all methods for basic validity issues for non-null meshes
    if (!this->m_nullMeshes)
    {
@@ -677,10 +713,12 @@ bool CouplingScheme::isValidMethod()
             return false;
          } 
       }
-      else if ( this->m_contactMethod == COMMON_PLANE )
+      else if ( this->m_contactMethod == COMMON_PLANE ||
+                this->m_contactMethod == NODE_TO_SURFACE )
       {
          // check for different face types. This is not yet supported
-         if (this->m_mesh1->numberOfNodesPerElement() != this->m_mesh2->numberOfNodesPerElement())
+         if (!this->m_mesh2->isRigidSurface() &&
+             this->m_mesh1->numberOfNodesPerElement() != this->m_mesh2->numberOfNodesPerElement())
          {
             this->m_couplingSchemeErrors.cs_method_error = DIFFERENT_FACE_TYPES; 
             return false;
@@ -696,7 +734,8 @@ bool CouplingScheme::isValidMethod()
 
       if ( this->m_contactMethod == ALIGNED_MORTAR ||
            this->m_contactMethod == SINGLE_MORTAR  ||
-           this->m_contactMethod == COMMON_PLANE )
+           this->m_contactMethod == COMMON_PLANE  ||
+           this->m_contactMethod == NODE_TO_SURFACE )
       {
          if ( this->m_mesh1->numberOfElements() > 0 && !this->m_mesh1->getNodalFields().m_is_nodal_response_set )
          {
@@ -749,6 +788,17 @@ bool CouplingScheme::isValidModel()
          break;
       }
 
+      case NODE_TO_SURFACE:
+      {
+         if ( this->m_contactModel != FRICTIONLESS &&
+              this->m_contactModel != NULL_MODEL )
+         {
+            this->m_couplingSchemeErrors.cs_model_error = NO_MODEL_IMPLEMENTATION_FOR_REGISTERED_METHOD;
+            return false;
+         }   
+         break;
+      }
+
       case COMMON_PLANE:
       {
          if ( this->m_contactModel != FRICTIONLESS &&
@@ -866,9 +916,10 @@ bool CouplingScheme::isValidEnforcement()
       } // end case SINGLE_MORTAR
 
       case COMMON_PLANE:
+      case NODE_TO_SURFACE:
       {
          // check if PENALTY is not chosen. This is the only possible (and foreseeable)
-         // choice for COMMON_PLANE
+         // choice for COMMON_PLANE and NODE_TO_SURFACE
          if ( this->m_enforcementMethod != PENALTY )
          {
             this->m_couplingSchemeErrors.cs_enforcement_error = 
@@ -931,6 +982,7 @@ int CouplingScheme::checkEnforcementData()
          break;
       } // end case SINGLE_MORTAR
       case COMMON_PLANE:
+      case NODE_TO_SURFACE:
       {
          switch (this->m_enforcementMethod)
          {
@@ -951,6 +1003,7 @@ int CouplingScheme::checkEnforcementData()
                // no-op
                break;
          }  // end switch over enforcement method
+         break;
       } // end case COMMON_PLANE
       default:
          // no-op
@@ -1130,12 +1183,12 @@ int CouplingScheme::checkExecutionModeData()
   }
   this->m_allocator_id = this->m_mesh1->getAllocatorId();
 
-  if (m_contactMethod != COMMON_PLANE)
+  if (m_contactMethod != COMMON_PLANE && m_contactMethod != NODE_TO_SURFACE)
   {
     if (m_exec_mode != ExecutionMode::Sequential)
     {
       SLIC_WARNING_ROOT("Only sequential execution on host supported for contact methods "
-        "other than COMMON_PLANE.");
+        "other than COMMON_PLANE and NODE_TO_SURFACE.");
       this->m_couplingSchemeErrors.cs_execution_mode_error =
         ExecutionModeError::INCOMPATIBLE_METHOD;
       err = 1;
@@ -1148,16 +1201,51 @@ int CouplingScheme::checkExecutionModeData()
 //------------------------------------------------------------------------------
 void CouplingScheme::performBinning()
 {
+   // rigid surfaces are evaluated without interface pairs
+   if (this->hasRigidSurface())
+   {
+      m_interface_pairs = ArrayT<InterfacePair>(0, 0, m_allocator_id);
+      return;
+   }
+
    // Find the interacting pairs for this coupling scheme. Will not use
    // binning if setInterfacePairs has been called.
    if( !this->hasFixedBinning() ) 
    {
       // create interface pairs based on allocator id
       m_interface_pairs = ArrayT<InterfacePair>(0, 0, m_allocator_id);
+      m_pairBudgetData.m_peak_candidates = 0;
+
+      if (this->getBinningMethod() == BINNING_AUTO)
+      {
+         // time the search to inform the choice of method for later searches
+         BinningMethod method = selectAutoBinningMethod( *this );
+         axom::utilities::Timer timer( true );
+         InterfacePairFinder finder(this, method);
+         finder.initialize();
+         finder.findInterfacePairs();
+         timer.stop();
+         recordAutoBinningTime( *this, method, timer.elapsedTimeInSec() );
+      }
+      else
+      {
+         InterfacePairFinder finder(this);
+         finder.initialize();
+         finder.findInterfacePairs();
+      }
 
-      InterfacePairFinder finder(this);
-      finder.initialize();
-      finder.findInterfacePairs();
+      // the BVH search bounds its candidate arrays by querying in chunks; the
+      // other methods only report an overrun
+      const IndexT budget = m_parameters.candidate_budget;
+      if (budget > 0 && (m_interface_pairs.size() > budget || 
+                         m_pairBudgetData.m_peak_candidates > budget))
+      {
+         ++m_pairBudgetData.m_num_candidate_overruns;
+         SLIC_WARNING("Coupling scheme " << m_id << ": " << m_interface_pairs.size() << 
+                      " interface pairs (" << m_pairBudgetData.m_peak_candidates << 
+                      " unfiltered candidates in one query) exceed the candidate budget of " <<
+                      budget << ".");
+      }
 
       // For Cartesian binning, we only need to compute the binning once
       if(this->getBinningMethod() == BINNING_CARTESIAN_PRODUCT)
@@ -1165,6 +1253,9 @@ void CouplingScheme::performBinning()
          this->setFixedBinning(true);
       }
 
+      // keep only the pairs this rank is responsible for
+      m_num_ghost_pairs_skipped = this->applyFaceOwnership();
+
       // set fixed binning depending on contact case, 
       // e.g. NO_SLIDING
       this->setFixedBinningPerCase();
@@ -1172,10 +1263,97 @@ void CouplingScheme::performBinning()
    return;
 }
 
+//------------------------------------------------------------------------------
+IndexT CouplingScheme::applyFaceOwnership()
+{
+   const auto& elem_data1 = m_mesh1->getElementData();
+   const auto& elem_data2 = m_mesh2->getElementData();
+   if (!elem_data1.hasFaceOwnership() || !elem_data2.hasFaceOwnership())
+   {
+      return 0;
+   }
+
+   // ownership data is registered in host memory, so filter on the host
+   ArrayT<InterfacePair, 1, MemorySpace::Host> pairs_host(m_interface_pairs);
+   const IndexT num_pairs = pairs_host.size();
+   IndexT num_kept = 0;
+   for (IndexT k{0}; k < num_pairs; ++k)
+   {
+      const auto& pair = pairs_host[k];
+      const IndexT gid1 = elem_data1.m_global_face_ids[pair.m_element_id1];
+      const IndexT gid2 = elem_data2.m_global_face_ids[pair.m_element_id2];
+      const bool ghost = (gid1 <= gid2) ? elem_data1.m_ghost_faces[pair.m_element_id1]
+                                        : elem_data2.m_ghost_faces[pair.m_element_id2];
+      if (!ghost)
+      {
+         pairs_host[num_kept++] = pair;
+      }
+   }
+
+   if (num_kept < num_pairs)
+   {
+      m_interface_pairs = ArrayT<InterfacePair>(num_kept, num_kept, m_allocator_id);
+      axom::copy(m_interface_pairs.data(), pairs_host.data(), num_kept * sizeof(InterfacePair));
+   }
+
+   SLIC_DEBUG("Coupling scheme " << m_id << ": " << num_pairs - num_kept << 
+              " of " << num_pairs << " interface pairs are evaluated on another rank.");
+
+   return num_pairs - num_kept;
+
+} // end CouplingScheme::applyFaceOwnership()
+
+//------------------------------------------------------------------------------
+void CouplingScheme::updateExactGhostData()
+{
+#ifdef BUILD_REDECOMP
+   if (!this->hasMfemData() || !m_mfemMeshData->HasReducedGhostPrecision())
+   {
+      return;
+   }
+
+   // the ghost transfer is collective, so a rank that skips this coupling 
+   // scheme still takes part with no pairs
+   if (!this->m_isValid)
+   {
+      m_mfemMeshData->UpdateExactGhostData(ArrayT<InterfacePair>(0, 0, m_allocator_id));
+      return;
+   }
+   m_mfemMeshData->UpdateExactGhostData(m_interface_pairs);
+
+   // recompute the face data from the exact coordinates without the search
+   // inflation of the face radii
+   auto recompute_face_data = [this](MeshData& mesh)
+   {
+      RealT inflation = mesh.getFaceRadiusInflation();
+      mesh.setFaceRadiusInflation(0.0);
+      mesh.computeFaceData(this->m_exec_mode);
+      mesh.setFaceRadiusInflation(inflation);
+   };
+   recompute_face_data(*this->m_mesh1);
+   if (this->m_mesh_id2 != this->m_mesh_id1)
+   {
+      recompute_face_data(*this->m_mesh2);
+   }
+#endif /* BUILD_REDECOMP */
+
+} // end CouplingScheme::updateExactGhostData()
+
 //------------------------------------------------------------------------------
 int CouplingScheme::apply( int cycle, RealT t, RealT &dt ) 
 {
   auto& params = m_parameters;
+  axom::utilities::Timer timer( true );
+
+  // contact with a rigid surface is evaluated directly in the enforcement, so 
+  // there are no contact planes to compute
+  if (hasRigidSurface())
+  {
+    allocateContactPlanes();
+    timer.stop();
+    m_loadBalanceData.m_local[LB_GEOMETRY_TIME] = timer.elapsedTimeInSec();
+    return applyPhysics( cycle, t, dt );
+  }
   
   // loop over number of interface pairs
   IndexT numPairs = m_interface_pairs.size();
@@ -1189,72 +1367,179 @@ int CouplingScheme::apply( int cycle, RealT t, RealT &dt )
   auto contact_case = m_contactCase;
   ArrayT<int> pair_err_data(1, 1, getAllocatorId());
   auto pair_err = pair_err_data.view();
-  // clear contact planes to be populated/allocated anew for this cycle.
-  // initially allocate array of numPairs size, then shrink to the actual number of pairs
-  if (spatialDimension() == 2)
-  {
-    m_contact_plane2d = ArrayT<ContactPlane2D>(numPairs, numPairs, getAllocatorId());
-    m_contact_plane3d = ArrayT<ContactPlane3D>(0, 1, getAllocatorId());
-  }
-  else
-  {
-    m_contact_plane2d = ArrayT<ContactPlane2D>(0, 1, getAllocatorId());
-    m_contact_plane3d = ArrayT<ContactPlane3D>(numPairs, numPairs, getAllocatorId());
-  }
-  auto planes_2d = m_contact_plane2d.view();
-  auto planes_3d = m_contact_plane3d.view();
+  // clear contact planes to be populated/allocated anew for this cycle. With a
+  // contact plane budget, the arrays start at the budget and grow with the 
+  // active planes instead of being sized for every pair.
+  const IndexT budget = params.contact_plane_budget;
+  IndexT capacity = (budget > 0) ? axom::utilities::min(numPairs, budget) : numPairs;
+  allocateContactPlanes( capacity );
   auto mesh1 = getMesh1().getView();
   auto mesh2 = getMesh2().getView();
   // array of size one for counting number of planes on device
   ArrayT<IndexT> planes_ct_data(1, 1, getAllocatorId());
   auto planes_ct = planes_ct_data.view();
-  forAllExec(getExecutionMode(), numPairs,
-    [pairs, mesh1, mesh2, params, contact_method, contact_case, planes_2d, 
-      planes_3d, planes_ct, pair_err] TRIBOL_HOST_DEVICE (IndexT i) mutable
+  IndexT num_planes = 0;
+  m_pairBudgetData.m_num_plane_chunks = 0;
+  // overlap polygons of 3D common plane pairs may be reused from previous 
+  // cycles. Entries are kept by pair index and checked against the face ids.
+  auto& overlap_cache = m_overlapCacheData;
+  const bool use_overlap_cache = params.overlap_cache_ratio > 0. && 
+                                 contact_method == COMMON_PLANE && 
+                                 spatialDimension() == 3;
+  if (use_overlap_cache)
+  {
+    if (overlap_cache.m_entries.size() != numPairs)
     {
-      auto& pair = pairs[i];
-      
-      // call wrapper around the contact method/case specific 
-      // geometry checks to determine whether to include a pair 
-      // in the active set
-      bool interact = false;
-      FaceGeomError interact_err = CheckInterfacePair(
-        pair, mesh1, mesh2, params, contact_method, contact_case, 
-        interact, planes_2d, planes_3d, planes_ct.data());
-        
-      // // Update pair reporting data for this coupling scheme
-      // this->updatePairReportingData( interact_err );
-
-      // TODO refine how these errors are handled. Here we skip over face-pairs with errors. That is, 
-      // they are not registered for contact, but we don't error out.
-      if (interact_err != NO_FACE_GEOM_ERROR)
-      {
-        pair_err[0] = 1;
-        pair.m_is_contact_candidate = false;
-        // TODO consider printing offending face(s) coordinates for debugging
-        // SLIC_DEBUG("Face geometry error, " << static_cast<int>(interact_err) << "for pair, " << kp << ".");
-        // continue; // TODO SRW why do we need this? Seems like we want to update interface pair below if-statements
-      }
-      else if (!interact)
+      overlap_cache.m_entries = ArrayT<OverlapCacheEntry>(numPairs, numPairs, getAllocatorId());
+    }
+  }
+  else if (overlap_cache.m_entries.size() > 0)
+  {
+    overlap_cache.m_entries = ArrayT<OverlapCacheEntry>(0, 1, getAllocatorId());
+  }
+  OverlapCacheEntry* cache_entries = use_overlap_cache ? overlap_cache.m_entries.data() : nullptr;
+  ArrayT<IndexT> cache_hits_data({0}, getAllocatorId());
+  auto cache_hits = cache_hits_data.view();
+  // each pair adds at most one plane, so a chunk fits in the free capacity
+  for (IndexT first{0}; first < numPairs; )
+  {
+    if (capacity - num_planes < axom::utilities::min(numPairs - first, 
+                                                     axom::utilities::max(budget / 2, IndexT{1})))
+    {
+      capacity = axom::utilities::min(numPairs, num_planes + budget);
+      if (spatialDimension() == 2)
       {
-        pair.m_is_contact_candidate = false;
+        m_contact_plane2d.resize(capacity);
       }
       else
       {
-        pair.m_is_contact_candidate = true;
+        m_contact_plane3d.resize(capacity);
       }
     }
-  );
+    const IndexT num_chunk = axom::utilities::min(capacity - num_planes, numPairs - first);
+    auto planes_2d = m_contact_plane2d.view();
+    auto planes_3d = m_contact_plane3d.view();
+    forAllExec(getExecutionMode(), num_chunk,
+      [pairs, first, mesh1, mesh2, params, contact_method, contact_case, planes_2d, 
+        planes_3d, planes_ct, pair_err, cache_entries, cache_hits] TRIBOL_HOST_DEVICE (IndexT k) mutable
+      {
+        auto& pair = pairs[first + k];
+        OverlapCacheEntry* cache_entry = (cache_entries != nullptr) ? &cache_entries[first + k] : nullptr;
+        
+        // call wrapper around the contact method/case specific 
+        // geometry checks to determine whether to include a pair 
+        // in the active set
+        bool interact = false;
+        FaceGeomError interact_err = CheckInterfacePair(
+          pair, mesh1, mesh2, params, contact_method, contact_case, 
+          interact, planes_2d, planes_3d, planes_ct.data(), cache_entry);
+
+        if (cache_entry != nullptr && cache_entry->m_hit)
+        {
+#ifdef TRIBOL_USE_RAJA
+          RAJA::atomicInc<RAJA::auto_atomic>(cache_hits.data());
+#else
+          ++cache_hits[0];
+#endif
+        }
+          
+        // // Update pair reporting data for this coupling scheme
+        // this->updatePairReportingData( interact_err );
+
+        // TODO refine how these errors are handled. Here we skip over face-pairs with errors. That is, 
+        // they are not registered for contact, but we don't error out.
+        if (interact_err != NO_FACE_GEOM_ERROR)
+        {
+          pair_err[0] = 1;
+          pair.m_is_contact_candidate = false;
+          // TODO consider printing offending face(s) coordinates for debugging
+          // SLIC_DEBUG("Face geometry error, " << static_cast<int>(interact_err) << "for pair, " << kp << ".");
+          // continue; // TODO SRW why do we need this? Seems like we want to update interface pair below if-statements
+        }
+        else if (!interact)
+        {
+          pair.m_is_contact_candidate = false;
+        }
+        else
+        {
+          pair.m_is_contact_candidate = true;
+        }
+      }
+    );
+    first += num_chunk;
+    ++m_pairBudgetData.m_num_plane_chunks;
+    if (budget > 0)
+    {
+      ArrayT<IndexT, 1, MemorySpace::Host> planes_ct_host(planes_ct_data);
+      num_planes = planes_ct_host[0];
+    }
+  }
+
+  if (budget > 0 && num_planes > budget)
+  {
+    ++m_pairBudgetData.m_num_plane_overruns;
+    SLIC_WARNING("Coupling scheme " << m_id << ": " << num_planes << 
+                 " contact planes exceed the budget of " << budget << 
+                 " (" << numPairs << " interface pairs).");
+  }
+
+  if (use_overlap_cache)
+  {
+    ArrayT<IndexT, 1, MemorySpace::Host> cache_hits_host(cache_hits_data);
+    overlap_cache.m_num_lookups = numPairs;
+    overlap_cache.m_num_hits = cache_hits_host[0];
+    overlap_cache.m_total_lookups += numPairs;
+    overlap_cache.m_total_hits += cache_hits_host[0];
+    SLIC_DEBUG("Coupling scheme " << m_id << ": overlap cache hit rate " << 
+               overlap_cache.hitRate() << " (" << overlap_cache.m_num_hits << 
+               " of " << numPairs << " pairs), " << overlap_cache.totalHitRate() << 
+               " since registration.");
+  }
+
+  ArrayT<IndexT, 1, MemorySpace::Host> planes_ct_host(planes_ct_data);
+  ArrayT<int, 1, MemorySpace::Host> pair_err_host(pair_err_data);
+  finalizeContactPlanes(planes_ct_host[0], pair_err_host[0] != 0);
+  timer.stop();
+  m_loadBalanceData.m_local[LB_GEOMETRY_TIME] = timer.elapsedTimeInSec();
+
+  return applyPhysics( cycle, t, dt );
+  
+} // end CouplingScheme::apply()
 
-  ArrayT<int, 1, MemorySpace::Host> planes_ct_host(planes_ct_data);
+//------------------------------------------------------------------------------
+void CouplingScheme::allocateContactPlanes()
+{
+  // initially allocate array of numPairs size, then shrink to the actual 
+  // number of pairs in finalizeContactPlanes()
+  allocateContactPlanes( m_interface_pairs.size() );
+} // end CouplingScheme::allocateContactPlanes()
+
+//------------------------------------------------------------------------------
+void CouplingScheme::allocateContactPlanes( IndexT capacity )
+{
+  if (spatialDimension() == 2)
+  {
+    m_contact_plane2d = ArrayT<ContactPlane2D>(capacity, capacity, getAllocatorId());
+    m_contact_plane3d = ArrayT<ContactPlane3D>(0, 1, getAllocatorId());
+  }
+  else
+  {
+    m_contact_plane2d = ArrayT<ContactPlane2D>(0, 1, getAllocatorId());
+    m_contact_plane3d = ArrayT<ContactPlane3D>(capacity, capacity, getAllocatorId());
+  }
+} // end CouplingScheme::allocateContactPlanes()
+
+//------------------------------------------------------------------------------
+void CouplingScheme::finalizeContactPlanes( IndexT num_planes, bool pair_err )
+{
   // shrink array to actual number of contact planes
   if (spatialDimension() == 2)
   {
-    m_contact_plane2d.resize(planes_ct_host[0]);
+    m_contact_plane2d.resize(num_planes);
   }
   else
   {
-    m_contact_plane3d.resize(planes_ct_host[0]); 
+    m_contact_plane3d.resize(num_planes); 
   }
   
   // Here, the pair_err is checked, which detects an issue with a face-pair geometry
@@ -1267,24 +1552,47 @@ int CouplingScheme::apply( int cycle, RealT t, RealT &dt )
   // may be reasonable and not an error. Alternatively, this warning may indicate a bug 
   // or issue in the cg that a host-code does desire to have resolved. For this reason, this
   // message is kept at the warning level.
-  ArrayT<int, 1, MemorySpace::Host> pair_err_host(pair_err_data);
-  SLIC_INFO_IF( pair_err_host[0]!=0, "CouplingScheme::apply(): possible issues with orientation, " << 
+  SLIC_INFO_IF( pair_err, "CouplingScheme::apply(): possible issues with orientation, " << 
                 "input, or invalid overlaps in CheckInterfacePair()." );
 
-  // aggregate across ranks for this coupling scheme? SRW
+  // see computeLoadBalance() for the counts across ranks
   SLIC_DEBUG("Number of active interface pairs: " << getNumActivePairs());
 
+} // end CouplingScheme::finalizeContactPlanes()
+
+//------------------------------------------------------------------------------
+int CouplingScheme::applyPhysics( int cycle, RealT t, RealT &dt )
+{
+  auto& params = m_parameters;
+
+  // color the active pairs so nodal scatter kernels can run without atomics
+  if (params.enable_pair_coloring)
+  {
+    computePairColoring();
+  }
+
   // wrapper around contact method, case, and 
   // enforcement to apply the interface physics in both 
   // normal and tangential directions. This function loops 
   // over the pairs on the coupling scheme and applies the 
   // appropriate physics in the normal and tangential directions.
+  axom::utilities::Timer timer( true );
   int err = ApplyInterfacePhysics( this, cycle, t );
+  timer.stop();
+
+  // record the contact work on this rank. Its distribution across ranks is
+  // computed by tribol::update() once every coupling scheme has been applied.
+  m_loadBalanceData.m_local[LB_CANDIDATE_PAIRS] = static_cast<double>(m_interface_pairs.size());
+  m_loadBalanceData.m_local[LB_ACTIVE_PAIRS] = static_cast<double>(getNumActivePairs());
+  m_loadBalanceData.m_local[LB_ENFORCEMENT_TIME] = timer.elapsedTimeInSec();
 
   SLIC_WARNING_IF(err!=0, "CouplingScheme::apply(): error in ApplyInterfacePhysics for " <<
                   "coupling scheme, " << this->m_id << ".");
 
-  // compute Tribol timestep vote on the coupling scheme
+  // compute Tribol timestep vote on the coupling scheme. The vote details 
+  // are cleared first so a cycle without a vote does not keep the details of 
+  // a previous cycle.
+  allocateTimestepVoteData( 0, dt );
   if (err == 0 && getNumActivePairs() > 0)
   {
     computeTimeStep(dt);
@@ -1307,7 +1615,35 @@ int CouplingScheme::apply( int cycle, RealT t, RealT &dt )
       return 0;
    }
   
-} // end CouplingScheme::apply()
+} // end CouplingScheme::applyPhysics()
+
+//------------------------------------------------------------------------------
+void CouplingScheme::computePairColoring()
+{
+  const IndexT num_pairs = getNumActivePairs();
+  ArrayT<IndexT> face_ids1_data(num_pairs, num_pairs, getAllocatorId());
+  ArrayT<IndexT> face_ids2_data(num_pairs, num_pairs, getAllocatorId());
+  auto face_ids1 = face_ids1_data.view();
+  auto face_ids2 = face_ids2_data.view();
+  auto cs_view = getView();
+  forAllExec(getExecutionMode(), num_pairs,
+    [cs_view, face_ids1, face_ids2] TRIBOL_HOST_DEVICE (IndexT i)
+    {
+      auto& plane = cs_view.getContactPlane(i);
+      face_ids1[i] = plane.getCpElementId1();
+      face_ids2[i] = plane.getCpElementId2();
+    }
+  );
+
+  m_pairColoring = tribol::computePairColoring( getMesh1().getView(), getMesh2().getView(),
+                                                ArrayViewT<const IndexT>(face_ids1_data.data(), num_pairs),
+                                                ArrayViewT<const IndexT>(face_ids2_data.data(), num_pairs),
+                                                getExecutionMode(), getAllocatorId() );
+
+  SLIC_DEBUG("Coupling scheme " << m_id << " active pairs colored with " << 
+             m_pairColoring.m_num_colors << " colors.");
+
+} // end CouplingScheme::computePairColoring()
 
 //------------------------------------------------------------------------------
 bool CouplingScheme::init()
@@ -1326,6 +1662,31 @@ bool CouplingScheme::init()
       {
          this->m_mesh2->computeFaceData(this->m_exec_mode);
       }
+
+      // precompute the per-face penalty stiffness and rate coefficients
+      if ((this->m_contactMethod == COMMON_PLANE || this->m_contactMethod == NODE_TO_SURFACE) &&
+          this->m_enforcementMethod == PENALTY)
+      {
+         auto& pen_options = this->m_enforcementOptions.penalty_options;
+         bool pen_valid = this->m_mesh1->computePenaltyData(pen_options, this->m_exec_mode);
+         if (this->m_mesh_id2 != this->m_mesh_id1)
+         {
+            pen_valid = this->m_mesh2->computePenaltyData(pen_options, this->m_exec_mode) 
+                        && pen_valid;
+         }
+
+         // a negative element thickness gives an invalid penalty stiffness
+         if (!pen_valid)
+         {
+            SLIC_WARNING_ROOT("CouplingScheme::init(): negative element thickness " << 
+                              "in the penalty stiffness of coupling scheme " << m_id << ".");
+            this->m_couplingSchemeErrors.cs_enforcement_data_error = 
+               ERROR_IN_REGISTERED_ENFORCEMENT_DATA;
+            this->m_couplingSchemeErrors.printEnforcementDataErrors();
+            this->m_isValid = false;
+            return false;
+         }
+      }
       
       this->allocateMethodData();
 
@@ -1454,11 +1815,433 @@ void CouplingScheme::computeTimeStep(RealT &dt)
             }
          }
          break;
+      case NODE_TO_SURFACE : 
+         if ( m_enforcementMethod == PENALTY )
+         {
+            if (m_parameters.enable_timestep_vote)
+            {
+               this->computeNodeToSurfaceTimeStep( dt ); 
+            }
+         }
+         break;
       default :
          break;
    } // end-switch
 }
 
+//------------------------------------------------------------------------------
+void CouplingScheme::allocateTimestepVoteData( IndexT num_pairs, RealT dt )
+{
+  auto& vote_data = m_timestepVoteData;
+  if (!vote_data.m_enabled)
+  {
+    return;
+  }
+
+  // the nodal timesteps are only stored with pairs to vote on
+  const IndexT num_nodes1 = (num_pairs > 0) ? getMesh1().numberOfNodes() : 0;
+  const IndexT num_nodes2 = (num_pairs > 0) ? getMesh2().numberOfNodes() : 0;
+  constexpr int num_bins = TimestepVoteData::num_bins;
+  vote_data.m_pair_dt = ArrayT<RealT>(num_pairs, num_pairs, getAllocatorId());
+  vote_data.m_pair_dt.fill(dt);
+  vote_data.m_pair_faces = ArrayT<IndexT, 2>({num_pairs, 2}, getAllocatorId());
+  vote_data.m_node_dt1 = ArrayT<RealT>(num_nodes1, num_nodes1, getAllocatorId());
+  vote_data.m_node_dt1.fill(dt);
+  vote_data.m_node_dt2 = ArrayT<RealT>(num_nodes2, num_nodes2, getAllocatorId());
+  vote_data.m_node_dt2.fill(dt);
+  // allocate histogram (initialized to 0)
+  vote_data.m_histogram = ArrayT<IndexT>(num_bins, num_bins, getAllocatorId());
+
+} // end CouplingScheme::allocateTimestepVoteData()
+
+//------------------------------------------------------------------------------
+TRIBOL_HOST_DEVICE void CommonPlanePairTimeStep( const CouplingScheme::Viewer& cs_view,
+                                                 IndexT i,
+                                                 RealT proj_ratio,
+                                                 RealT dt,
+                                                 const TimestepVoteView& vote,
+                                                 ArrayViewT<RealT> dt_temp,
+                                                 ArrayViewT<bool> msg )
+{
+  const int dim = cs_view.spatialDimension();
+
+  auto& plane = cs_view.getContactPlane(i);
+
+  auto& mesh1 = cs_view.getMesh1View();
+  auto& mesh2 = cs_view.getMesh2View();
+
+  // get pair indices
+  IndexT index1 = plane.getCpElementId1();
+  IndexT index2 = plane.getCpElementId2();
+
+  constexpr int max_dim = 3;
+  constexpr int max_nodes_per_elem = 4;
+  StackArrayT<RealT, max_dim * max_nodes_per_elem> x1;
+  StackArrayT<RealT, max_dim * max_nodes_per_elem> v1;
+  mesh1.getFaceCoords( index1, x1 );
+  mesh1.getFaceVelocities( index1, v1 );
+
+  StackArrayT<RealT, max_dim * max_nodes_per_elem> x2;
+  StackArrayT<RealT, max_dim * max_nodes_per_elem> v2;
+  mesh2.getFaceCoords( index2, x2 );
+  mesh2.getFaceVelocities( index2, v2 );
+
+  /////////////////////////////////////////////////////////////
+  // calculate face velocities at projected overlap centroid //
+  /////////////////////////////////////////////////////////////
+  StackArrayT<RealT, max_dim> vel_f1;
+  StackArrayT<RealT, max_dim> vel_f2;
+  initRealArray( vel_f1, dim, 0.0 );
+  initRealArray( vel_f2, dim, 0.0 );
+
+  // interpolate nodal velocity at overlap centroid as projected 
+  // onto face 1
+  RealT cXf1 = plane.m_cXf1;
+  RealT cYf1 = plane.m_cYf1;
+  RealT cZf1 = (dim == 3) ? plane.m_cZf1 : 0.;
+  GalerkinEval( x1, cXf1, cYf1, cZf1,
+                LINEAR, PHYSICAL, dim, dim, 
+                v1, vel_f1 );
+  // interpolate nodal velocity at overlap centroid as projected 
+  // onto face 2
+  RealT cXf2 = plane.m_cXf2;
+  RealT cYf2 = plane.m_cYf2;
+  RealT cZf2 = (dim == 3) ? plane.m_cZf2 : 0.;
+  GalerkinEval( x2, cXf2, cYf2, cZf2,
+                LINEAR, PHYSICAL, dim, dim, 
+                v2, vel_f2 );
+
+  ////////////////////////////////////////////////
+  //                                            //
+  // Compute Timestep Vote Based on a Few Cases //
+  //                                            //
+  ////////////////////////////////////////////////
+
+  ///////////////////////////////////////////////
+  // compute data common to all timestep votes //
+  ///////////////////////////////////////////////
+
+  // compute velocity projections:
+  // compute the dot product between the face velocities 
+  // at the overlap-centroid-to-face projected centroid and each
+  // face's outward unit normal AND the overlap normal.
+  RealT v1_dot_n, v2_dot_n, v1_dot_n1, v2_dot_n2;
+  RealT overlapNormal[max_dim];
+  overlapNormal[0] = plane.m_nX;
+  overlapNormal[1] = plane.m_nY;
+  if (dim == 3)
+  {
+    overlapNormal[2] = plane.m_nZ;
+  }
+
+  // get face normals
+  RealT fn1[max_dim], fn2[max_dim];
+  mesh1.getFaceNormal( index1, fn1 );
+  mesh2.getFaceNormal( index2, fn2 );
+
+  // compute projections
+  v1_dot_n  = dotProd( vel_f1, overlapNormal, dim );
+  v2_dot_n  = dotProd( vel_f2, overlapNormal, dim );
+  v1_dot_n1 = dotProd( vel_f1, fn1, dim );
+  v2_dot_n2 = dotProd( vel_f2, fn2, dim );
+
+  // Keep debug print statements. This routine is still in the testing phase
+  //std::cout << "face 1 normal: " << fn1[0] << ", " << fn1[1] << ", " << fn1[2] << std::endl;
+  //std::cout << "face 2 normal: " << fn2[0] << ", " << fn2[1] << ", " << fn2[2] << std::endl;
+  //std::cout << " " << std::endl;
+  //std::cout << "face 1 vel: " << vel_f1[0] << ", " << vel_f1[1] << ", " << vel_f1[2] << std::endl;
+  //std::cout << "face 2 vel: " << vel_f2[0] << ", " << vel_f2[1] << ", " << vel_f2[2] << std::endl;
+  //std::cout << " " << std::endl;
+  //std::cout << "First v1_dot_n1 calc: " << v1_dot_n1 << std::endl;
+  //std::cout << "First v2_dot_n2 calc: " << v2_dot_n2 << std::endl;
+  //std::cout << "First v1_dot_n: " << v1_dot_n << std::endl;
+  //std::cout << "First v2_dot_n: " << v2_dot_n << std::endl;
+
+  // add tiny amount to velocity projections to avoid division by zero. 
+  // Note that if these projections are close to zero, there may be 
+  // stationary interactions or tangential motion. In this case, any 
+  // timestep estimate will be very large, and not control the simulation
+  RealT tiny = 1.e-12;
+  RealT tiny1 = (v1_dot_n >= 0.) ? tiny : -1.*tiny;
+  RealT tiny2 = (v2_dot_n >= 0.) ? tiny : -1.*tiny;
+  v1_dot_n  += tiny1;
+  v2_dot_n  += tiny2;
+  // reset tiny velocity based on face normal projections.
+  tiny1 = (v1_dot_n1 >= 0.) ? tiny : -1.*tiny;
+  tiny2 = (v2_dot_n2 >= 0.) ? tiny : -1.*tiny;
+  v1_dot_n1 += tiny1;
+  v2_dot_n2 += tiny2;
+
+  // Keep debug print statements. This routine is still in the testing phase
+  //std::cout << "Second v1_dot_n1 calc: " << v1_dot_n1 << std::endl;
+  //std::cout << "Second v2_dot_n2 calc: " << v2_dot_n2 << std::endl;
+  //std::cout << "Second v1_dot_n: " << v1_dot_n << std::endl;
+  //std::cout << "Second v2_dot_n: " << v2_dot_n << std::endl;
+
+  // get volume element thicknesses associated with each face in this pair
+  RealT t1 = mesh1.getElementData().m_thickness[index1];
+  RealT t2 = mesh2.getElementData().m_thickness[index2];
+
+  // compute the existing gap vector (recall gap is x1-x2 by convention)
+  RealT gapVec[max_dim];
+  gapVec[0] = plane.m_cXf1 - plane.m_cXf2;
+  gapVec[1] = plane.m_cYf1 - plane.m_cYf2;
+  if (dim == 3)
+  {
+    gapVec[2] = plane.m_cZf1 - plane.m_cZf2;
+  }
+
+  // compute the dot product between gap vector and the outward unit face normals.
+  RealT gap_f1_n1 = dotProd( gapVec, fn1, dim );
+  RealT gap_f2_n2 = dotProd( gapVec, fn2, dim );
+
+  RealT dt1 = 1.e6;  // initialize as large number
+  RealT dt2 = 1.e6;  // initialize as large number
+  RealT alpha = cs_view.getTimestepScale(); // multiplier on timestep estimate
+  bool dt1_check1 = false;
+  bool dt2_check1 = false;
+  bool dt1_vel_check = false;
+  bool dt2_vel_check = false;
+  RealT crit_dt = dt; // critical timestep of this pair
+
+  // maximum allowable interpenetration in the normal direction of each element
+  RealT max_delta1 = proj_ratio * t1;
+  RealT max_delta2 = proj_ratio * t2;
+
+  // Separation or interpenetration trigger for check 1 and 2:
+  // check if there is further interpen or separation based on the 
+  // velocity projection in the direction of the common-plane normal,
+  // which is in the direction of face-2 normal.
+  // The two cases are:
+  // if v1*n < 0 there is interpen
+  // if v2*n > 0 there is interpen 
+  //
+  // Note: we compare strictly to 0. here since a 'tiny' value was 
+  // appropriately added to the velocity projections, which is akin 
+  // to some tolerancing effect
+  dt1_vel_check = (v1_dot_n < 0.) ? true : false; 
+  dt2_vel_check = (v2_dot_n > 0.) ? true : false; 
+
+  //////////////////////////////////////////////////////////////////////////
+  // Check 1. Current interpenetration gap exceeds max allowable interpen // 
+  //////////////////////////////////////////////////////////////////////////
+
+  // check if face-pair is in contact (i.e. gap < gap_tol), which is determined
+  // in Common Plane ApplyNormal<>() routine
+  if (plane.m_inContact)
+  {
+
+    // compute the difference between the 'face-gaps' and the max allowable 
+    // interpen as a function of element thickness. Note, we have to use the 
+    // gap projected onto the outward unit face-normal to check against the
+    // max allowable gap as a factor of the thickness in the element normal
+    // direction
+    RealT delta1 = max_delta1 - gap_f1_n1; // >0 not exceeding max allowable
+    RealT delta2 = max_delta2 + gap_f2_n2; // >0 not exceeding max allowable
+
+    auto exceed_max_gap1 = (delta1 < 0.) ? true : false;
+    auto exceed_max_gap2 = (delta2 < 0.) ? true : false;
+
+    // if velocity projection indicates further interpenetration, and the gaps
+    // EXCEED max allowable, then compute time step estimates to reduce overlap
+    dt1_check1 = (dt1_vel_check) ? exceed_max_gap1 : false;
+    dt2_check1 = (dt2_vel_check) ? exceed_max_gap2 : false;
+
+    msg[0] = exceed_max_gap1;
+    msg[1] = exceed_max_gap2;
+
+    // compute dt for face 1 and 2 based on the velocity and gap projections onto 
+    // the face-normals for faces where currect gap exceeds max allowable gap.
+    //
+    // NOTE:
+    //
+    // This calculation RESETS the current gap to be g = 0, and computes a timestep
+    // such that the velocity projection of the overlap-to-face projected overlap 
+    // centroid does not exceed the max allowable gap. 
+    //
+    // This avoid a timestep crash in the case that the current gap barely exceeds 
+    // the max allowable and also allows a soft contact response with interpen
+    // in excess of the max allowable gap without causing timestep crashes.
+    //
+    // v1_dot_n1 > 0 and v2_dot_n2 > 0 for further interpen
+    dt1 = (dt1_check1) ? alpha * max_delta1 / v1_dot_n1 : dt1;
+    dt2 = (dt2_check1) ? alpha * max_delta2 / v2_dot_n2 : dt2;
+
+    // Keep debug print statements. This routine is still in the testing phase
+    //std::cout << "dt1_check1, delta1 and v1_dot_n1: " << dt1_check1 << ", " << max_delta1 << ", " << v1_dot_n1 << std::endl;
+    //std::cout << "dt2_check1, delta2 and v2_dot_n2: " << dt2_check1 << ", " << max_delta2 << ", " << v2_dot_n2 << std::endl;
+    //std::cout << "dt1 and dt2: " << dt1 << ", " << dt2 << std::endl;
+
+    // update dt_temp1 only for positive dt1 and/or dt2
+    if (dt1 > 0.)
+    {
+      crit_dt = axom::utilities::min(crit_dt, axom::utilities::min(dt1, 1.e6));
+#ifdef TRIBOL_USE_RAJA
+      RAJA::atomicMin<RAJA::auto_atomic>( &dt_temp[0],
+                                          axom::utilities::min(dt1, 1.e6) );
+#else
+      dt_temp[0] = axom::utilities::min(dt_temp[0], axom::utilities::min(dt1, 1.e6));
+#endif
+    }
+    if (dt2 > 0.)
+    {
+      crit_dt = axom::utilities::min(crit_dt, axom::utilities::min(1.e6, dt2));
+#ifdef TRIBOL_USE_RAJA
+      RAJA::atomicMin<RAJA::auto_atomic>( &dt_temp[0],
+                                          axom::utilities::min(1.e6, dt2) );
+#else
+      dt_temp[0] = axom::utilities::min(dt_temp[0], axom::utilities::min(1.e6, dt2));
+#endif
+    }
+
+    if (dt1 < 0. || dt2 < 0.)
+    {
+      msg[2] = true;
+    }
+
+  } // end case 1
+
+  ////////////////////////////////////////////////////////////////////////
+  // 2. Velocity projection exceeds max interpenetration                // 
+  //                                                                    // 
+  //    Note: This is performed for all contact candidates even if they //
+  //          are not 'in contact' per the common-plane method. Every   //
+  //          contact candidate has a contact plane                     //
+  ////////////////////////////////////////////////////////////////////////
+
+  {
+    // compute delta between velocity projection of face-projected 
+    // overlap centroid and the OTHER face's face-projected overlap 
+    // centroid
+    RealT proj_delta_x1 = plane.m_cXf1 + dt * vel_f1[0] - plane.m_cXf2;
+    RealT proj_delta_y1 = plane.m_cYf1 + dt * vel_f1[1] - plane.m_cYf2;
+    RealT proj_delta_z1 = 0.;
+
+    RealT proj_delta_x2 = plane.m_cXf2 + dt * vel_f2[0] - plane.m_cXf1; 
+    RealT proj_delta_y2 = plane.m_cYf2 + dt * vel_f2[1] - plane.m_cYf1;
+    RealT proj_delta_z2 = 0.;
+
+    // compute the dot product between each face's delta and the OTHER 
+    // face's outward unit normal. This is the magnitude of interpenetration 
+    // of one face's projected overlap-centroid in the 'thickness-direction' 
+    // of the other face (with whom in may be in contact currently, or in 
+    // a velocity projected sense).
+    RealT proj_delta_n_1 = proj_delta_x1 * fn2[0] + proj_delta_y1 * fn2[1];
+    RealT proj_delta_n_2 = proj_delta_x2 * fn1[0] + proj_delta_y2 * fn1[1];
+
+    if (dim == 3)
+    {
+      proj_delta_z1 = plane.m_cZf1 + dt * vel_f1[2] - plane.m_cZf2;
+      proj_delta_z2 = plane.m_cZf2 + dt * vel_f2[2] - plane.m_cZf1;
+
+      proj_delta_n_1 += proj_delta_z1 * fn2[2];
+      proj_delta_n_2 += proj_delta_z2 * fn1[2];
+    }
+
+    // Reset the dt velocity check only for faces with continued interpen that exceeds the 
+    // max allowable gap AND where the current gap did NOT exceed that face's max allowable
+    // gap per check 1 (would result in same dt calc).
+    //
+    // Note:
+    // If proj_delta_n_i < 0, (i=1,2) there is interpen from the velocity projection. 
+    // Check this interpen against the maximum allowable to determine if a velocity projection 
+    // timestep estimate is still required.
+    if (dt1_vel_check && !dt1_check1) // continued interpen
+    {
+      dt1_vel_check = (proj_delta_n_1 < 0.) ? ((std::abs(proj_delta_n_1) > max_delta1) ? true : false) : false;
+    }
+
+    if (dt2_vel_check && !dt2_check1) // continued interpen
+    {
+      dt2_vel_check = (proj_delta_n_2 < 0.) ? ((std::abs(proj_delta_n_2) > max_delta2) ? true : false) : false;
+    }
+
+    // compute velocity projection based dt (check 2) using a RESET gap (g=0) such that
+    // the velocity projected gap does not exceed the max allowable gap. This avoid timestep
+    // crashes for velocity projected gaps slightly in excess of the max allowable and still
+    // allows for a soft contact response without a timestep crash.
+    //
+    // v1_dot_n1 > 0 and v2_dot_n2 > 0 for further interpen
+    dt1 = (dt1_vel_check) ? alpha * max_delta1 / v1_dot_n1 : dt1;
+    dt2 = (dt2_vel_check) ? alpha * max_delta2 / v2_dot_n2 : dt2; 
+
+    // Keep debug print statements. This routine is still in the testing phase
+    //std::cout << "dt1_vel_check, (proj_delta_n_1+max_delta1), v1_dot_n1: " << dt1_vel_check << ", " 
+    //          << proj_delta_n_1+max_delta1 << ", " << v1_dot_n1 << std::endl;
+    //std::cout << "dt2_vel_check, (proj_delta_n_2+max_delta2), v2_dot_n2: " << dt2_vel_check << ", " 
+    //          << proj_delta_n_2+max_delta2 << ", " << v2_dot_n2 << std::endl;
+    //std::cout << "dt1 and dt2: " << dt1 << ", " << dt2 << std::endl;
+
+    // update dt_temp2 only for positive dt1 and/or dt2
+    if (dt1 > 0.)
+    {
+      crit_dt = axom::utilities::min(crit_dt, axom::utilities::min(dt1, 1.e6));
+#ifdef TRIBOL_USE_RAJA
+      RAJA::atomicMin<RAJA::auto_atomic>( &dt_temp[1],
+                                          axom::utilities::min(dt1, 1.e6) );
+#else
+      dt_temp[1] = axom::utilities::min(dt_temp[1], axom::utilities::min(dt1, 1.e6));
+#endif
+    }
+    if (dt2 > 0.)
+    {
+      crit_dt = axom::utilities::min(crit_dt, axom::utilities::min(1.e6, dt2));
+#ifdef TRIBOL_USE_RAJA
+      RAJA::atomicMin<RAJA::auto_atomic>( &dt_temp[1],
+                                          axom::utilities::min(1.e6, dt2) );
+#else
+      dt_temp[1] = axom::utilities::min(dt_temp[1], axom::utilities::min(1.e6, dt2));
+#endif
+    }
+    if (dt1 < 0. || dt2 < 0.)
+    {
+      msg[3] = true;
+    }
+
+  } // end check 2
+
+  //////////////////////////////////////////////////////
+  // store per-pair and per-node critical timesteps   //
+  //////////////////////////////////////////////////////
+  if (vote.m_enabled)
+  {
+    vote.m_pair_dt[i] = crit_dt;
+    vote.m_pair_faces(i, 0) = index1;
+    vote.m_pair_faces(i, 1) = index2;
+    for (IndexT a{0}; a < mesh1.numberOfNodesPerElement(); ++a)
+    {
+#ifdef TRIBOL_USE_RAJA
+      RAJA::atomicMin<RAJA::auto_atomic>( &vote.m_node_dt1[mesh1.getGlobalNodeId(index1, a)], crit_dt );
+#else
+      auto& node_dt = vote.m_node_dt1[mesh1.getGlobalNodeId(index1, a)];
+      node_dt = axom::utilities::min(node_dt, crit_dt);
+#endif
+    }
+    for (IndexT a{0}; a < mesh2.numberOfNodesPerElement(); ++a)
+    {
+#ifdef TRIBOL_USE_RAJA
+      RAJA::atomicMin<RAJA::auto_atomic>( &vote.m_node_dt2[mesh2.getGlobalNodeId(index2, a)], crit_dt );
+#else
+      auto& node_dt = vote.m_node_dt2[mesh2.getGlobalNodeId(index2, a)];
+      node_dt = axom::utilities::min(node_dt, crit_dt);
+#endif
+    }
+
+    // bin pairs restricting the timestep by powers of two of dt/crit_dt
+    if (crit_dt < dt)
+    {
+      int bin = static_cast<int>(floor(log2(dt / crit_dt)));
+      bin = axom::utilities::clampVal(bin, 0, TimestepVoteData::num_bins - 1);
+#ifdef TRIBOL_USE_RAJA
+      RAJA::atomicAdd<RAJA::auto_atomic>( &vote.m_histogram[bin], IndexT{1} );
+#else
+      ++vote.m_histogram[bin];
+#endif
+    }
+  }
+
+} // end CommonPlanePairTimeStep()
+
 //------------------------------------------------------------------------------
 void CouplingScheme::computeCommonPlaneTimeStep(RealT &dt)
 {
@@ -1488,7 +2271,6 @@ void CouplingScheme::computeCommonPlaneTimeStep(RealT &dt)
 
   RealT proj_ratio = m_parameters.timestep_pen_frac;
   //int num_sides = 2; // always 2 sides in a single coupling scheme
-  int dim = spatialDimension();
 
   // Loop over each contact plane. Even if pair is not in contact, we still do a
   // velocity projection for that proximate face-pair to see if interpenetration
@@ -1502,8 +2284,82 @@ void CouplingScheme::computeCommonPlaneTimeStep(RealT &dt)
   // [0]: exceed_max_gap1, [1]: exceed_max_gap2, [2]: neg_dt_gap_msg, [3]: neg_dt_vel_proj_msg
   ArrayT<bool> msg_data({false, false, false, false}, getAllocatorId());
   ArrayViewT<bool> msg = msg_data;
+
+  // optionally store the critical timestep of each pair and node and a 
+  // histogram of the pair critical timesteps
+  allocateTimestepVoteData( getNumActivePairs(), dt );
+  TimestepVoteView vote = m_timestepVoteData.view();
+
+  forAllExec(getExecutionMode(), getNumActivePairs(),
+    [cs_view, proj_ratio, msg, dt_temp, dt, vote] TRIBOL_HOST_DEVICE (IndexT i)
+    {
+      CommonPlanePairTimeStep( cs_view, i, proj_ratio, dt, vote, dt_temp, msg );
+    }
+  );
+
+  // print general messages once
+  // Can we output this message on root? SRW
+  ArrayT<bool, 1, MemorySpace::Host> msg_host(msg_data);
+  SLIC_DEBUG_IF(msg_host[0] || msg_host[1], "tribol::computeCommonPlaneTimeStep(): "  <<
+                "there are locations where mesh overlap may be too large. "                <<
+                "Cannot provide timestep vote. Reduce timestep and/or increase " << 
+                "penalty.");
+
+  SLIC_DEBUG_IF(msg_host[2], "tribol::computeCommonPlaneTimeStep():  "        <<
+                "one or more face-pairs have a negative timestep vote based on " << 
+                "maximum gap check." );
+
+  SLIC_DEBUG_IF(msg_host[3], "tribol::computeCommonPlaneTimeStep(): "    <<
+                "one or more face-pairs have a negative timestep vote based on " << 
+                "velocity projection calculation." );                 
+
+  ArrayT<RealT, 1, MemorySpace::Host> dt_temp_host(dt_temp_data);
+  dt = axom::utilities::min(dt_temp_host[0], dt_temp_host[1]);
+}
+
+//------------------------------------------------------------------------------
+void CouplingScheme::computeNodeToSurfaceTimeStep(RealT &dt)
+{
+  // note: as with the common-plane vote, this is a maximum allowable 
+  // interpenetration vote and not a stability estimate. Each mesh 2 node that 
+  // projects into a mesh 1 face of a contact candidate is advanced with its 
+  // relative normal velocity, and the timestep is reduced so that the node 
+  // does not penetrate the mesh 1 face by more than a fraction of the face's 
+  // element thickness.
+
+  auto& mesh1 = getMesh1();
+  auto& mesh2 = getMesh2();
+
+  // element thicknesses set the maximum allowable interpenetration
+  if ( !mesh1.getElementData().m_is_element_thickness_set ||
+       !mesh2.getElementData().m_is_element_thickness_set )
+  {
+    return; 
+  }
+
+  RealT proj_ratio = m_parameters.timestep_pen_frac;
+  int dim = spatialDimension();
+
+  auto cs_view = getView();
+  ArrayT<RealT> dt_temp_data({dt}, getAllocatorId());
+  ArrayViewT<RealT> dt_temp = dt_temp_data;
+  ArrayT<bool> msg_data({false}, getAllocatorId());
+  ArrayViewT<bool> msg = msg_data;
+
+  // optionally store the critical timestep of each pair and node and a 
+  // histogram of the pair critical timesteps
+  auto& vote_data = m_timestepVoteData;
+  const bool store_details = vote_data.m_enabled;
+  allocateTimestepVoteData( getNumActivePairs(), dt );
+  ArrayViewT<RealT> pair_dt = vote_data.m_pair_dt;
+  ArrayViewT<IndexT, 2> pair_faces = vote_data.m_pair_faces;
+  ArrayViewT<RealT> node_dt1 = vote_data.m_node_dt1;
+  ArrayViewT<RealT> node_dt2 = vote_data.m_node_dt2;
+  ArrayViewT<IndexT> histogram = vote_data.m_histogram;
+
   forAllExec(getExecutionMode(), getNumActivePairs(),
-    [cs_view, dim, proj_ratio, msg, dt_temp, dt] TRIBOL_HOST_DEVICE (IndexT i)
+    [cs_view, dim, proj_ratio, msg, dt_temp, dt, store_details, pair_dt, 
+     pair_faces, node_dt1, node_dt2, histogram] TRIBOL_HOST_DEVICE (IndexT i)
     {
       auto& plane = cs_view.getContactPlane(i);
 
@@ -1521,340 +2377,124 @@ void CouplingScheme::computeCommonPlaneTimeStep(RealT &dt)
       mesh1.getFaceCoords( index1, x1 );
       mesh1.getFaceVelocities( index1, v1 );
 
-      StackArrayT<RealT, max_dim * max_nodes_per_elem> x2;
-      StackArrayT<RealT, max_dim * max_nodes_per_elem> v2;
-      mesh2.getFaceCoords( index2, x2 );
-      mesh2.getFaceVelocities( index2, v2 );
-
-      /////////////////////////////////////////////////////////////
-      // calculate face velocities at projected overlap centroid //
-      /////////////////////////////////////////////////////////////
-      StackArrayT<RealT, max_dim> vel_f1;
-      StackArrayT<RealT, max_dim> vel_f2;
-      initRealArray( vel_f1, dim, 0.0 );
-      initRealArray( vel_f2, dim, 0.0 );
-
-      // interpolate nodal velocity at overlap centroid as projected 
-      // onto face 1
-      RealT cXf1 = plane.m_cXf1;
-      RealT cYf1 = plane.m_cYf1;
-      RealT cZf1 = (dim == 3) ? plane.m_cZf1 : 0.;
-      GalerkinEval( x1, cXf1, cYf1, cZf1,
-                    LINEAR, PHYSICAL, dim, dim, 
-                    v1, vel_f1 );
-      // interpolate nodal velocity at overlap centroid as projected 
-      // onto face 2
-      RealT cXf2 = plane.m_cXf2;
-      RealT cYf2 = plane.m_cYf2;
-      RealT cZf2 = (dim == 3) ? plane.m_cZf2 : 0.;
-      GalerkinEval( x2, cXf2, cYf2, cZf2,
-                    LINEAR, PHYSICAL, dim, dim, 
-                    v2, vel_f2 );
-
-      ////////////////////////////////////////////////
-      //                                            //
-      // Compute Timestep Vote Based on a Few Cases //
-      //                                            //
-      ////////////////////////////////////////////////
-
-      ///////////////////////////////////////////////
-      // compute data common to all timestep votes //
-      ///////////////////////////////////////////////
-
-      // compute velocity projections:
-      // compute the dot product between the face velocities 
-      // at the overlap-centroid-to-face projected centroid and each
-      // face's outward unit normal AND the overlap normal.
-      RealT v1_dot_n, v2_dot_n, v1_dot_n1, v2_dot_n2;
-      RealT overlapNormal[max_dim];
-      overlapNormal[0] = plane.m_nX;
-      overlapNormal[1] = plane.m_nY;
-      if (dim == 3)
-      {
-        overlapNormal[2] = plane.m_nZ;
-      }
-
-      // get face normals
-      RealT fn1[max_dim], fn2[max_dim];
+      RealT fn1[max_dim];
       mesh1.getFaceNormal( index1, fn1 );
-      mesh2.getFaceNormal( index2, fn2 );
-
-      // compute projections
-      v1_dot_n  = dotProd( vel_f1, overlapNormal, dim );
-      v2_dot_n  = dotProd( vel_f2, overlapNormal, dim );
-      v1_dot_n1 = dotProd( vel_f1, fn1, dim );
-      v2_dot_n2 = dotProd( vel_f2, fn2, dim );
-
-      // Keep debug print statements. This routine is still in the testing phase
-      //std::cout << "face 1 normal: " << fn1[0] << ", " << fn1[1] << ", " << fn1[2] << std::endl;
-      //std::cout << "face 2 normal: " << fn2[0] << ", " << fn2[1] << ", " << fn2[2] << std::endl;
-      //std::cout << " " << std::endl;
-      //std::cout << "face 1 vel: " << vel_f1[0] << ", " << vel_f1[1] << ", " << vel_f1[2] << std::endl;
-      //std::cout << "face 2 vel: " << vel_f2[0] << ", " << vel_f2[1] << ", " << vel_f2[2] << std::endl;
-      //std::cout << " " << std::endl;
-      //std::cout << "First v1_dot_n1 calc: " << v1_dot_n1 << std::endl;
-      //std::cout << "First v2_dot_n2 calc: " << v2_dot_n2 << std::endl;
-      //std::cout << "First v1_dot_n: " << v1_dot_n << std::endl;
-      //std::cout << "First v2_dot_n: " << v2_dot_n << std::endl;
-
-      // add tiny amount to velocity projections to avoid division by zero. 
-      // Note that if these projections are close to zero, there may be 
-      // stationary interactions or tangential motion. In this case, any 
-      // timestep estimate will be very large, and not control the simulation
-      RealT tiny = 1.e-12;
-      RealT tiny1 = (v1_dot_n >= 0.) ? tiny : -1.*tiny;
-      RealT tiny2 = (v2_dot_n >= 0.) ? tiny : -1.*tiny;
-      v1_dot_n  += tiny1;
-      v2_dot_n  += tiny2;
-      // reset tiny velocity based on face normal projections.
-      tiny1 = (v1_dot_n1 >= 0.) ? tiny : -1.*tiny;
-      tiny2 = (v2_dot_n2 >= 0.) ? tiny : -1.*tiny;
-      v1_dot_n1 += tiny1;
-      v2_dot_n2 += tiny2;
-
-      // Keep debug print statements. This routine is still in the testing phase
-      //std::cout << "Second v1_dot_n1 calc: " << v1_dot_n1 << std::endl;
-      //std::cout << "Second v2_dot_n2 calc: " << v2_dot_n2 << std::endl;
-      //std::cout << "Second v1_dot_n: " << v1_dot_n << std::endl;
-      //std::cout << "Second v2_dot_n: " << v2_dot_n << std::endl;
-
-      // get volume element thicknesses associated with each face in this pair
-      RealT t1 = mesh1.getElementData().m_thickness[index1];
-      RealT t2 = mesh2.getElementData().m_thickness[index2];
-
-      // compute the existing gap vector (recall gap is x1-x2 by convention)
-      RealT gapVec[max_dim];
-      gapVec[0] = plane.m_cXf1 - plane.m_cXf2;
-      gapVec[1] = plane.m_cYf1 - plane.m_cYf2;
-      if (dim == 3)
-      {
-        gapVec[2] = plane.m_cZf1 - plane.m_cZf2;
-      }
-
-      // compute the dot product between gap vector and the outward unit face normals.
-      RealT gap_f1_n1 = dotProd( gapVec, fn1, dim );
-      RealT gap_f2_n2 = dotProd( gapVec, fn2, dim );
-
-      RealT dt1 = 1.e6;  // initialize as large number
-      RealT dt2 = 1.e6;  // initialize as large number
+
+      // maximum allowable interpenetration of a mesh 2 node into face 1
+      RealT max_delta = proj_ratio * mesh1.getElementData().m_thickness[index1];
       RealT alpha = cs_view.getTimestepScale(); // multiplier on timestep estimate
-      bool dt1_check1 = false;
-      bool dt2_check1 = false;
-      bool dt1_vel_check = false;
-      bool dt2_vel_check = false;
-
-      // maximum allowable interpenetration in the normal direction of each element
-      RealT max_delta1 = proj_ratio * t1;
-      RealT max_delta2 = proj_ratio * t2;
-
-      // Separation or interpenetration trigger for check 1 and 2:
-      // check if there is further interpen or separation based on the 
-      // velocity projection in the direction of the common-plane normal,
-      // which is in the direction of face-2 normal.
-      // The two cases are:
-      // if v1*n < 0 there is interpen
-      // if v2*n > 0 there is interpen 
-      //
-      // Note: we compare strictly to 0. here since a 'tiny' value was 
-      // appropriately added to the velocity projections, which is akin 
-      // to some tolerancing effect
-      dt1_vel_check = (v1_dot_n < 0.) ? true : false; 
-      dt2_vel_check = (v2_dot_n > 0.) ? true : false; 
-
-      //////////////////////////////////////////////////////////////////////////
-      // Check 1. Current interpenetration gap exceeds max allowable interpen // 
-      //////////////////////////////////////////////////////////////////////////
-
-      // check if face-pair is in contact (i.e. gap < gap_tol), which is determined
-      // in Common Plane ApplyNormal<>() routine
-      if (plane.m_inContact)
-      {
-
-        // compute the difference between the 'face-gaps' and the max allowable 
-        // interpen as a function of element thickness. Note, we have to use the 
-        // gap projected onto the outward unit face-normal to check against the
-        // max allowable gap as a factor of the thickness in the element normal
-        // direction
-        RealT delta1 = max_delta1 - gap_f1_n1; // >0 not exceeding max allowable
-        RealT delta2 = max_delta2 + gap_f2_n2; // >0 not exceeding max allowable
-
-        auto exceed_max_gap1 = (delta1 < 0.) ? true : false;
-        auto exceed_max_gap2 = (delta2 < 0.) ? true : false;
-
-        // if velocity projection indicates further interpenetration, and the gaps
-        // EXCEED max allowable, then compute time step estimates to reduce overlap
-        dt1_check1 = (dt1_vel_check) ? exceed_max_gap1 : false;
-        dt2_check1 = (dt2_vel_check) ? exceed_max_gap2 : false;
-
-        msg[0] = exceed_max_gap1;
-        msg[1] = exceed_max_gap2;
-
-        // compute dt for face 1 and 2 based on the velocity and gap projections onto 
-        // the face-normals for faces where currect gap exceeds max allowable gap.
-        //
-        // NOTE:
-        //
-        // This calculation RESETS the current gap to be g = 0, and computes a timestep
-        // such that the velocity projection of the overlap-to-face projected overlap 
-        // centroid does not exceed the max allowable gap. 
-        //
-        // This avoid a timestep crash in the case that the current gap barely exceeds 
-        // the max allowable and also allows a soft contact response with interpen
-        // in excess of the max allowable gap without causing timestep crashes.
-        //
-        // v1_dot_n1 > 0 and v2_dot_n2 > 0 for further interpen
-        dt1 = (dt1_check1) ? alpha * max_delta1 / v1_dot_n1 : dt1;
-        dt2 = (dt2_check1) ? alpha * max_delta2 / v2_dot_n2 : dt2;
-
-        // Keep debug print statements. This routine is still in the testing phase
-        //std::cout << "dt1_check1, delta1 and v1_dot_n1: " << dt1_check1 << ", " << max_delta1 << ", " << v1_dot_n1 << std::endl;
-        //std::cout << "dt2_check1, delta2 and v2_dot_n2: " << dt2_check1 << ", " << max_delta2 << ", " << v2_dot_n2 << std::endl;
-        //std::cout << "dt1 and dt2: " << dt1 << ", " << dt2 << std::endl;
-
-        // update dt_temp1 only for positive dt1 and/or dt2
-        if (dt1 > 0.)
+      RealT crit_dt = dt; // critical timestep of this pair
+
+      for (IndexT a{0}; a < mesh2.numberOfNodesPerElement(); ++a)
+      {
+        IndexT node_id = mesh2.getGlobalNodeId( index2, a );
+
+        RealT xn[max_dim];
+        RealT vn[max_dim];
+        for (int d{0}; d < dim; ++d)
         {
-#ifdef TRIBOL_USE_RAJA
-          RAJA::atomicMin<RAJA::auto_atomic>( &dt_temp[0],
-                                              axom::utilities::min(dt1, 1.e6) );
-#else
-          dt_temp[0] = axom::utilities::min(dt_temp[0], axom::utilities::min(dt1, 1.e6));
-#endif
+          xn[d] = mesh2.getPosition()[d][node_id];
+          vn[d] = mesh2.getVelocity()[d][node_id];
         }
-        if (dt2 > 0.)
+
+        RealT xp[max_dim];
+        RealT gap {0.};
+        if (!ProjectNodeToFace( mesh1, index1, xn, xp, gap ))
         {
-#ifdef TRIBOL_USE_RAJA
-          RAJA::atomicMin<RAJA::auto_atomic>( &dt_temp[0],
-                                              axom::utilities::min(1.e6, dt2) );
-#else
-          dt_temp[0] = axom::utilities::min(dt_temp[0], axom::utilities::min(1.e6, dt2));
-#endif
+          continue;
         }
 
-        if (dt1 < 0. || dt2 < 0.)
+        // interpolate the face 1 velocity at the projected node
+        RealT vp[max_dim];
+        initRealArray( vp, dim, 0. );
+        GalerkinEval( x1, xp[0], xp[1], (dim == 3) ? xp[2] : 0.,
+                      LINEAR, PHYSICAL, dim, dim, v1, vp );
+
+        // relative normal velocity; negative for further interpenetration
+        RealT vel_gap = 0.;
+        for (int d{0}; d < dim; ++d)
         {
-          msg[2] = true;
+          vel_gap += (vn[d] - vp[d]) * fn1[d];
         }
-
-      } // end case 1
-
-      ////////////////////////////////////////////////////////////////////////
-      // 2. Velocity projection exceeds max interpenetration                // 
-      //                                                                    // 
-      //    Note: This is performed for all contact candidates even if they //
-      //          are not 'in contact' per the common-plane method. Every   //
-      //          contact candidate has a contact plane                     //
-      ////////////////////////////////////////////////////////////////////////
-
-      {
-        // compute delta between velocity projection of face-projected 
-        // overlap centroid and the OTHER face's face-projected overlap 
-        // centroid
-        RealT proj_delta_x1 = plane.m_cXf1 + dt * vel_f1[0] - plane.m_cXf2;
-        RealT proj_delta_y1 = plane.m_cYf1 + dt * vel_f1[1] - plane.m_cYf2;
-        RealT proj_delta_z1 = 0.;
-
-        RealT proj_delta_x2 = plane.m_cXf2 + dt * vel_f2[0] - plane.m_cXf1; 
-        RealT proj_delta_y2 = plane.m_cYf2 + dt * vel_f2[1] - plane.m_cYf1;
-        RealT proj_delta_z2 = 0.;
-
-        // compute the dot product between each face's delta and the OTHER 
-        // face's outward unit normal. This is the magnitude of interpenetration 
-        // of one face's projected overlap-centroid in the 'thickness-direction' 
-        // of the other face (with whom in may be in contact currently, or in 
-        // a velocity projected sense).
-        RealT proj_delta_n_1 = proj_delta_x1 * fn2[0] + proj_delta_y1 * fn2[1];
-        RealT proj_delta_n_2 = proj_delta_x2 * fn1[0] + proj_delta_y2 * fn1[1];
-
-        if (dim == 3)
+        if (vel_gap >= 0.)
         {
-          proj_delta_z1 = plane.m_cZf1 + dt * vel_f1[2] - plane.m_cZf2;
-          proj_delta_z2 = plane.m_cZf2 + dt * vel_f2[2] - plane.m_cZf1;
-
-          proj_delta_n_1 += proj_delta_z1 * fn2[2];
-          proj_delta_n_2 += proj_delta_z2 * fn1[2];
+          continue;
         }
 
-        // Reset the dt velocity check only for faces with continued interpen that exceeds the 
-        // max allowable gap AND where the current gap did NOT exceed that face's max allowable
-        // gap per check 1 (would result in same dt calc).
-        //
-        // Note:
-        // If proj_delta_n_i < 0, (i=1,2) there is interpen from the velocity projection. 
-        // Check this interpen against the maximum allowable to determine if a velocity projection 
-        // timestep estimate is still required.
-        if (dt1_vel_check && !dt1_check1) // continued interpen
+        // velocity projected gap over the current timestep
+        if (gap + dt * vel_gap >= -max_delta)
         {
-          dt1_vel_check = (proj_delta_n_1 < 0.) ? ((std::abs(proj_delta_n_1) > max_delta1) ? true : false) : false;
+          continue;
         }
-        
-        if (dt2_vel_check && !dt2_check1) // continued interpen
+
+        // remaining allowable interpenetration. If the current gap already 
+        // exceeds the max allowable, reset the gap to zero (see the note in 
+        // computeCommonPlaneTimeStep()) to avoid a timestep crash.
+        RealT delta = max_delta + axom::utilities::min( gap, 0. );
+        if (delta <= 0.)
         {
-          dt2_vel_check = (proj_delta_n_2 < 0.) ? ((std::abs(proj_delta_n_2) > max_delta2) ? true : false) : false;
+          msg[0] = true;
+          delta = max_delta;
         }
 
-        // compute velocity projection based dt (check 2) using a RESET gap (g=0) such that
-        // the velocity projected gap does not exceed the max allowable gap. This avoid timestep
-        // crashes for velocity projected gaps slightly in excess of the max allowable and still
-        // allows for a soft contact response without a timestep crash.
-        //
-        // v1_dot_n1 > 0 and v2_dot_n2 > 0 for further interpen
-        dt1 = (dt1_vel_check) ? alpha * max_delta1 / v1_dot_n1 : dt1;
-        dt2 = (dt2_vel_check) ? alpha * max_delta2 / v2_dot_n2 : dt2; 
-
-        // Keep debug print statements. This routine is still in the testing phase
-        //std::cout << "dt1_vel_check, (proj_delta_n_1+max_delta1), v1_dot_n1: " << dt1_vel_check << ", " 
-        //          << proj_delta_n_1+max_delta1 << ", " << v1_dot_n1 << std::endl;
-        //std::cout << "dt2_vel_check, (proj_delta_n_2+max_delta2), v2_dot_n2: " << dt2_vel_check << ", " 
-        //          << proj_delta_n_2+max_delta2 << ", " << v2_dot_n2 << std::endl;
-        //std::cout << "dt1 and dt2: " << dt1 << ", " << dt2 << std::endl;
-
-        // update dt_temp2 only for positive dt1 and/or dt2
-        if (dt1 > 0.)
+        RealT node_dt = axom::utilities::min( alpha * delta / (-vel_gap), 1.e6 );
+        crit_dt = axom::utilities::min( crit_dt, node_dt );
+#ifdef TRIBOL_USE_RAJA
+        RAJA::atomicMin<RAJA::auto_atomic>( &dt_temp[0], node_dt );
+#else
+        dt_temp[0] = axom::utilities::min( dt_temp[0], node_dt );
+#endif
+      } // end loop over face 2 nodes
+
+      //////////////////////////////////////////////////////
+      // store per-pair and per-node critical timesteps   //
+      //////////////////////////////////////////////////////
+      if (store_details)
+      {
+        pair_dt[i] = crit_dt;
+        pair_faces(i, 0) = index1;
+        pair_faces(i, 1) = index2;
+        for (IndexT a{0}; a < mesh1.numberOfNodesPerElement(); ++a)
         {
 #ifdef TRIBOL_USE_RAJA
-          RAJA::atomicMin<RAJA::auto_atomic>( &dt_temp[1],
-                                              axom::utilities::min(dt1, 1.e6) );
+          RAJA::atomicMin<RAJA::auto_atomic>( &node_dt1[mesh1.getGlobalNodeId(index1, a)], crit_dt );
 #else
-          dt_temp[1] = axom::utilities::min(dt_temp[1], axom::utilities::min(dt1, 1.e6));
+          auto& node_dt = node_dt1[mesh1.getGlobalNodeId(index1, a)];
+          node_dt = axom::utilities::min(node_dt, crit_dt);
 #endif
         }
-        if (dt2 > 0.)
+        for (IndexT a{0}; a < mesh2.numberOfNodesPerElement(); ++a)
         {
 #ifdef TRIBOL_USE_RAJA
-          RAJA::atomicMin<RAJA::auto_atomic>( &dt_temp[1],
-                                              axom::utilities::min(1.e6, dt2) );
+          RAJA::atomicMin<RAJA::auto_atomic>( &node_dt2[mesh2.getGlobalNodeId(index2, a)], crit_dt );
 #else
-          dt_temp[1] = axom::utilities::min(dt_temp[1], axom::utilities::min(1.e6, dt2));
+          auto& node_dt = node_dt2[mesh2.getGlobalNodeId(index2, a)];
+          node_dt = axom::utilities::min(node_dt, crit_dt);
 #endif
         }
-        if (dt1 < 0. || dt2 < 0.)
+
+        // bin pairs restricting the timestep by powers of two of dt/crit_dt
+        if (crit_dt < dt)
         {
-          msg[3] = true;
+          int bin = static_cast<int>(floor(log2(dt / crit_dt)));
+          bin = axom::utilities::clampVal(bin, 0, TimestepVoteData::num_bins - 1);
+#ifdef TRIBOL_USE_RAJA
+          RAJA::atomicAdd<RAJA::auto_atomic>( &histogram[bin], IndexT{1} );
+#else
+          ++histogram[bin];
+#endif
         }
-
-      } // end check 2
+      }
     }
   );
 
-  // print general messages once
-  // Can we output this message on root? SRW
   ArrayT<bool, 1, MemorySpace::Host> msg_host(msg_data);
-  SLIC_DEBUG_IF(msg_host[0] || msg_host[1], "tribol::computeCommonPlaneTimeStep(): "  <<
-                "there are locations where mesh overlap may be too large. "                <<
-                "Cannot provide timestep vote. Reduce timestep and/or increase " << 
-                "penalty.");
-
-  SLIC_DEBUG_IF(msg_host[2], "tribol::computeCommonPlaneTimeStep():  "        <<
-                "one or more face-pairs have a negative timestep vote based on " << 
-                "maximum gap check." );
-
-  SLIC_DEBUG_IF(msg_host[3], "tribol::computeCommonPlaneTimeStep(): "    <<
-                "one or more face-pairs have a negative timestep vote based on " << 
-                "velocity projection calculation." );                 
+  SLIC_DEBUG_IF(msg_host[0], "tribol::computeNodeToSurfaceTimeStep(): "  <<
+                "there are nodes where interpenetration may be too large. "     <<
+                "Reduce timestep and/or increase penalty.");
 
   ArrayT<RealT, 1, MemorySpace::Host> dt_temp_host(dt_temp_data);
-  dt = axom::utilities::min(dt_temp_host[0], dt_temp_host[1]);
+  dt = dt_temp_host[0];
 }
 
 //------------------------------------------------------------------------------
@@ -2015,6 +2655,12 @@ TRIBOL_HOST_DEVICE RealT CouplingScheme::Viewer::getGapTol( int fid1, int fid2 )
          } // end switch over m_contactModel
          break;
 
+      case NODE_TO_SURFACE :
+         gap_tol = -1. * m_parameters.gap_tol_ratio *  
+                     axom::utilities::max( m_mesh1.getFaceRadius()[fid1],
+                                           m_mesh2.getFaceRadius()[fid2] );
+         break;
+
       default : 
          break;
    } // end switch over m_contactMethod
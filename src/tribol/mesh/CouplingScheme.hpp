@@ -13,7 +13,11 @@
 #include "tribol/mesh/MfemData.hpp"
 #include "tribol/utils/DataManager.hpp"
 #include "tribol/mesh/InterfacePairs.hpp"
+#include "tribol/mesh/PairColoring.hpp"
 #include "tribol/geom/ContactPlane.hpp"
+#include "tribol/search/AutoBinning.hpp"
+#include "tribol/search/SleepingFaces.hpp"
+#include "tribol/utils/LoadBalance.hpp"
 
 // Axom includes
 #include "axom/core.hpp"
@@ -31,6 +35,113 @@ public:
    int numBadFaceGeometry {0};
 };
 
+/**
+ * @brief Struct holding views of the timestep vote output of a coupling scheme
+ *
+ * @see TimestepVoteData
+ */
+struct TimestepVoteView
+{
+public:
+
+   bool m_enabled;                     ///< True if the details below are stored
+   ArrayViewT<RealT> m_pair_dt;        ///< Critical timestep of each active pair
+   ArrayViewT<IndexT, 2> m_pair_faces; ///< Face ids (mesh 1, mesh 2) of each active pair
+   ArrayViewT<RealT> m_node_dt1;       ///< Critical timestep of each node on mesh 1
+   ArrayViewT<RealT> m_node_dt2;       ///< Critical timestep of each node on mesh 2
+   ArrayViewT<IndexT> m_histogram;     ///< Histogram of the pair critical timesteps
+};
+
+/**
+ * @brief Struct holding detailed timestep vote output of a coupling scheme
+ *
+ * When enabled, the common plane timestep vote stores the critical timestep of
+ * each active pair and each mesh node, and a histogram of the per-pair 
+ * critical timesteps. Pairs and nodes that do not restrict the timestep report
+ * the incoming timestep. Arrays are stored in the coupling scheme's memory 
+ * space and are resized each time the vote is computed.
+ */
+struct TimestepVoteData
+{
+public:
+
+   static constexpr int num_bins = 16; ///< Number of histogram bins
+
+   bool m_enabled {false}; ///< True if per-pair and per-node critical timesteps are stored
+
+   ArrayT<RealT> m_pair_dt;          ///< Critical timestep of each active pair
+   ArrayT<IndexT, 2> m_pair_faces;   ///< Face ids (mesh 1, mesh 2) of each active pair
+   ArrayT<RealT> m_node_dt1;         ///< Critical timestep of each node on mesh 1
+   ArrayT<RealT> m_node_dt2;         ///< Critical timestep of each node on mesh 2
+
+   /// Bin k counts pairs with critical timestep in [dt/2^(k+1), dt/2^k);
+   /// the last bin also counts all smaller timesteps
+   ArrayT<IndexT> m_histogram;
+
+   /// Returns views of the timestep vote output for use in kernels
+   TimestepVoteView view()
+   {
+      return TimestepVoteView{ m_enabled, m_pair_dt.view(), m_pair_faces.view(), 
+                               m_node_dt1.view(), m_node_dt2.view(), m_histogram.view() };
+   }
+};
+
+/**
+ * @brief Struct holding the candidate pair and contact plane budget state of a
+ *        coupling scheme
+ *
+ * With a candidate budget, the BVH search queries the mesh 2 faces in chunks.
+ * The first chunk is capped at a fixed fraction of the faces and later chunks
+ * are sized from the measured candidate density, keeping the unfiltered 
+ * candidate arrays near the budget when the density is stable. With a contact
+ * plane budget, apply() computes the contact planes in chunks of pairs and 
+ * grows the plane arrays with the active planes instead of sizing them for 
+ * every pair. Searches and cycles that exceed a budget are counted and logged.
+ */
+struct PairBudgetData
+{
+public:
+
+   RealT m_candidates_per_face {-1.}; ///< Unfiltered BVH candidates per queried face in the last search; negative before the first
+   IndexT m_peak_candidates {0};      ///< Largest unfiltered BVH candidate array of the last search
+   IndexT m_num_query_chunks {0};     ///< Number of BVH query chunks in the last search
+   IndexT m_num_plane_chunks {0};     ///< Number of pair chunks in the last contact plane computation
+   int m_num_candidate_overruns {0};  ///< Number of searches that exceeded the candidate budget
+   int m_num_plane_overruns {0};      ///< Number of cycles whose contact planes exceeded the plane budget
+};
+
+/**
+ * @brief Struct holding the overlap polygon cache of a coupling scheme
+ *
+ * With a positive overlap_cache_ratio parameter, 3D COMMON_PLANE coupling 
+ * schemes keep one cache entry per interface pair index. An entry is only 
+ * reused for the face-pair it was computed for, so changes in the pair 
+ * ordering between searches show up as misses rather than wrong polygons.
+ */
+struct OverlapCacheData
+{
+public:
+
+   ArrayT<OverlapCacheEntry> m_entries; ///< Cache entries indexed by interface pair
+
+   IndexT m_num_lookups {0};       ///< Number of pairs checked with the cache in the last cycle
+   IndexT m_num_hits {0};          ///< Number of pairs reusing a cached polygon in the last cycle
+   long long m_total_lookups {0};  ///< Number of pairs checked with the cache since registration
+   long long m_total_hits {0};     ///< Number of pairs reusing a cached polygon since registration
+
+   /// Returns the fraction of pairs reusing a cached polygon in the last cycle
+   RealT hitRate() const
+   {
+      return (m_num_lookups > 0) ? static_cast<RealT>(m_num_hits) / m_num_lookups : 0.;
+   }
+
+   /// Returns the fraction of pairs reusing a cached polygon since registration
+   RealT totalHitRate() const
+   {
+      return (m_total_lookups > 0) ? static_cast<RealT>(m_total_hits) / m_total_lookups : 0.;
+   }
+};
+
 /**
  * @brief Enumerates execution mode errors 
  */
@@ -175,6 +286,41 @@ public:
      */
     TRIBOL_HOST_DEVICE RealT getGapTol( int fid1, int fid2 ) const;
 
+    /**
+     * @brief Get the coupling scheme parameters
+     * 
+     * @return const reference to the Parameters struct
+     */
+    TRIBOL_HOST_DEVICE const Parameters& getParameters() const { return m_parameters; }
+
+    /**
+     * @brief Get the contact case
+     * 
+     * @return contact case
+     */
+    TRIBOL_HOST_DEVICE ContactCase getContactCase() const { return m_contact_case; }
+
+    /**
+     * @brief Get the contact method
+     * 
+     * @return contact method
+     */
+    TRIBOL_HOST_DEVICE ContactMethod getContactMethod() const { return m_contact_method; }
+
+    /**
+     * @brief Get the view of the 2D contact planes
+     * 
+     * @return array view of 2D contact planes
+     */
+    TRIBOL_HOST_DEVICE ArrayViewT<ContactPlane2D> get2DContactPlanes() const { return m_contact_plane2d; }
+
+    /**
+     * @brief Get the view of the 3D contact planes
+     * 
+     * @return array view of 3D contact planes
+     */
+    TRIBOL_HOST_DEVICE ArrayViewT<ContactPlane3D> get3DContactPlanes() const { return m_contact_plane3d; }
+
   private:
     /// Struct holding parameters for the coupling scheme
     Parameters m_parameters;
@@ -268,6 +414,9 @@ public:
    */
   Parameters& getParameters() { return m_parameters; }
 
+  /// @overload
+  const Parameters& getParameters() const { return m_parameters; }
+
   /**
    * @brief Get a reference to the first mesh
    * 
@@ -514,6 +663,14 @@ public:
    */
   bool nullMeshes() const { return m_nullMeshes; }
 
+  /**
+   * @brief Returns true if the second mesh is an analytic rigid surface
+   *
+   * @return true if mesh 2 is a rigid surface registered with 
+   * tribol::registerRigidSurface()
+   */
+  bool hasRigidSurface() const { return m_mesh2 != nullptr && m_mesh2->isRigidSurface(); }
+
   /**
    * @brief Returns true if a valid mode is specified, otherwise false
    *
@@ -581,6 +738,36 @@ public:
    */
   void performBinning();
 
+  /**
+   * @brief Removes interface pairs evaluated on another rank
+   *
+   * A pair is kept only if the face with the lower global id is owned by 
+   * this rank, so each pair straddling a ghost boundary is evaluated on 
+   * exactly one rank. Does nothing unless both meshes have face ownership 
+   * data (see registerFaceOwnership()).
+   *
+   * @return number of pairs removed
+   */
+  IndexT applyFaceOwnership();
+
+  /**
+   * @brief Returns the number of pairs removed by the face ownership rule in 
+   * the last binning
+   */
+  IndexT getNumGhostPairsSkipped() const { return m_num_ghost_pairs_skipped; }
+
+  /**
+   * @brief Replaces reduced-precision ghost data with exact values
+   *
+   * If the MFEM mesh data sends reduced-precision ghost coordinates (see
+   * MfemMeshData::SetReducedGhostPrecision()), the exact coordinates (and
+   * velocities) of the ghost faces in the interface pairs are fetched and the
+   * face data is recomputed from them. Call after performBinning() and before
+   * apply(). Collective if the option is set: call on every rank, also if
+   * init() failed.
+   */
+  void updateExactGhostData();
+
   /**
    * @brief Applies the CouplingScheme
    *
@@ -592,6 +779,45 @@ public:
    */
   int apply( int cycle, RealT t, RealT &dt );
 
+  /**
+   * @brief Allocates the contact plane arrays for the current number of 
+   * interface pairs
+   *
+   * @note The first phase of apply(). The arrays are sized to hold a plane 
+   * for every pair and are shrunk in finalizeContactPlanes().
+   */
+  void allocateContactPlanes();
+
+  /**
+   * @brief Allocates the contact plane arrays to hold a given number of planes
+   *
+   * @param [in] capacity number of contact planes
+   */
+  void allocateContactPlanes( IndexT capacity );
+
+  /**
+   * @brief Shrinks the contact plane arrays to the number of active pairs
+   *
+   * @param [in] num_planes number of contact planes found by CheckInterfacePair()
+   * @param [in] pair_err true if CheckInterfacePair() reported a face geometry error
+   */
+  void finalizeContactPlanes( IndexT num_planes, bool pair_err );
+
+  /**
+   * @brief Applies the interface physics and computes the timestep vote over 
+   * the active pairs
+   *
+   * @param [in] cycle the cycle at which this method is invoked.
+   * @param [in] t the simulation time at the given cycle
+   * @param [in/out] dt the simulation dt at the given cycle sent back as Tribol timestep vote
+   *
+   * @pre the contact planes have been computed, i.e. finalizeContactPlanes() 
+   * has been called
+   *
+   * @return 0 if successful apply
+   */
+  int applyPhysics( int cycle, RealT t, RealT &dt );
+
   /**
    * @brief Wrapper around method specific calculation of the Tribol timestep vote 
    *
@@ -609,6 +835,13 @@ public:
     m_output_directory = directory;
   }
 
+  /**
+   * @brief Get the output directory for file output
+   * 
+   * @return file system path of the output directory
+   */
+  const std::string& getOutputDirectory() const { return m_output_directory; }
+
   /**
    * @brief Wrapper to call method specific visualization output routines
    *
@@ -815,6 +1048,93 @@ public:
 
 #endif /* BUILD_REDECOMP */
 
+  /**
+   * @brief Get the detailed timestep vote data
+   * 
+   * @return reference to the TimestepVoteData struct
+   */
+  TimestepVoteData& getTimestepVoteData() { return m_timestepVoteData; }
+
+  /// @overload
+  const TimestepVoteData& getTimestepVoteData() const { return m_timestepVoteData; }
+
+  /**
+   * @brief Get the coloring of the active pairs
+   * 
+   * @note The coloring is recomputed in apply() when enabled via the 
+   * enable_pair_coloring parameter
+   *
+   * @return reference to the PairColoring struct
+   */
+  const PairColoring& getPairColoring() const { return m_pairColoring; }
+
+  /**
+   * @brief Get the binning method selection state used with BINNING_AUTO
+   *
+   * @return reference to the AutoBinningData struct
+   */
+  AutoBinningData& getAutoBinningData() { return m_autoBinningData; }
+
+  /// @overload
+  const AutoBinningData& getAutoBinningData() const { return m_autoBinningData; }
+
+  /**
+   * @brief Get the sleeping face state used by the BVH search
+   *
+   * @return reference to the SleepingFaceData struct
+   */
+  SleepingFaceData& getSleepingFaceData() { return m_sleepingFaceData; }
+
+  /// @overload
+  const SleepingFaceData& getSleepingFaceData() const { return m_sleepingFaceData; }
+
+  /**
+   * @brief Get the candidate pair and contact plane budget state
+   *
+   * @return reference to the PairBudgetData struct
+   */
+  PairBudgetData& getPairBudgetData() { return m_pairBudgetData; }
+
+  /// @overload
+  const PairBudgetData& getPairBudgetData() const { return m_pairBudgetData; }
+
+  /**
+   * @brief Get the overlap polygon cache and its hit counts
+   *
+   * @return reference to the OverlapCacheData struct
+   */
+  OverlapCacheData& getOverlapCacheData() { return m_overlapCacheData; }
+
+  /// @overload
+  const OverlapCacheData& getOverlapCacheData() const { return m_overlapCacheData; }
+
+  /**
+   * @brief Get the per-rank contact work and its distribution across ranks
+   *
+   * @return reference to the LoadBalanceData struct
+   */
+  LoadBalanceData& getLoadBalanceData() { return m_loadBalanceData; }
+
+  /// @overload
+  const LoadBalanceData& getLoadBalanceData() const { return m_loadBalanceData; }
+
+  /**
+   * @brief Colors the active pairs (contact planes) by shared nodes
+   */
+  void computePairColoring();
+
+  /**
+   * @brief Allocates the per-pair and per-node timestep vote details
+   *
+   * Pair and node timesteps are set to dt and the histogram to zero. With no
+   * pairs, the pair and node arrays are empty. No-op if the details are not 
+   * enabled.
+   *
+   * @param [in] num_pairs number of pairs voting on the timestep
+   * @param [in] dt simulation timestep at given cycle
+   */
+  void allocateTimestepVoteData( IndexT num_pairs, RealT dt );
+
   /**
    * @brief Computes common-plane specific time step vote
    *
@@ -822,6 +1142,13 @@ public:
    */
   void computeCommonPlaneTimeStep( RealT &dt );
 
+  /**
+   * @brief Computes node-to-surface specific time step vote
+   *
+   * @param [in/out] dt simulation timestep at given cycle
+   */
+  void computeNodeToSurfaceTimeStep( RealT &dt );
+
 private:
 
   IndexT m_id; ///< Coupling Scheme id
@@ -859,6 +1186,7 @@ private:
   bool m_isTied;       ///< True if surfaces have been "tied" (Tied contact only)
 
   ArrayT<InterfacePair> m_interface_pairs; ///< List of interface pairs
+  IndexT m_num_ghost_pairs_skipped {0};    ///< Number of pairs evaluated on another rank in the last binning
 
   ArrayT<ContactPlane2D> m_contact_plane2d; ///< List of 2D contact planes
   ArrayT<ContactPlane3D> m_contact_plane3d; ///< List of 3D contact planes
@@ -870,6 +1198,13 @@ private:
   CouplingSchemeInfo   m_couplingSchemeInfo;   ///< struct handling info to be printed
 
   PairReportingData    m_pairReportingData;    ///< struct handling on-rank pair reporting data from computational geometry
+  TimestepVoteData     m_timestepVoteData;     ///< struct holding per-pair and per-node timestep votes
+  PairColoring         m_pairColoring;         ///< coloring of the active pairs by shared nodes
+  AutoBinningData      m_autoBinningData;      ///< binning method selection state for BINNING_AUTO
+  SleepingFaceData     m_sleepingFaceData;     ///< mesh 2 faces skipped by the BVH search
+  PairBudgetData       m_pairBudgetData;       ///< candidate pair and contact plane budget state
+  OverlapCacheData     m_overlapCacheData;     ///< common plane overlap polygon cache
+  LoadBalanceData      m_loadBalanceData;      ///< per-rank contact work and cross-rank statistics
 
 #ifdef BUILD_REDECOMP
 
@@ -881,6 +1216,31 @@ private:
 
 }; // end class CouplingScheme
 
+/**
+ * @brief Computes the common plane timestep vote of an active pair
+ *
+ * The vote of the pair is combined into dt_temp with an atomic min: dt_temp[0]
+ * holds the vote of the pairs whose current gap exceeds the maximum allowable
+ * interpenetration and dt_temp[1] the vote from the velocity projection. If 
+ * vote.m_enabled, the critical timestep of the pair and its nodes and the 
+ * histogram are also updated.
+ *
+ * @param [in] cs_view view of the coupling scheme
+ * @param [in] i id of the active pair (contact plane)
+ * @param [in] proj_ratio maximum allowable interpenetration as a fraction of the element thickness
+ * @param [in] dt simulation timestep at given cycle
+ * @param [in] vote views of the timestep vote output of the coupling scheme
+ * @param [in,out] dt_temp timestep votes of the gap check and of the velocity projection
+ * @param [in,out] msg debug message flags (see CouplingScheme::computeCommonPlaneTimeStep())
+ */
+TRIBOL_HOST_DEVICE void CommonPlanePairTimeStep( const CouplingScheme::Viewer& cs_view,
+                                                 IndexT i,
+                                                 RealT proj_ratio,
+                                                 RealT dt,
+                                                 const TimestepVoteView& vote,
+                                                 ArrayViewT<RealT> dt_temp,
+                                                 ArrayViewT<bool> msg );
+
 using CouplingSchemeManager = DataManager<CouplingScheme>;
 
 } /* namespace tribol */
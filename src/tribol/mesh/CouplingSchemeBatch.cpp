@@ -0,0 +1,351 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#include "tribol/mesh/CouplingSchemeBatch.hpp"
+#include "tribol/common/LoopExec.hpp"
+#include "tribol/geom/ContactPlane.hpp"
+#include "tribol/physics/CommonPlane.hpp"
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+
+namespace tribol
+{
+
+namespace
+{
+
+/// Data of a coupling scheme in a batch needed to check its interface pairs
+struct BatchedScheme
+{
+  CouplingScheme::Viewer cs;
+  ArrayViewT<InterfacePair> pairs;
+};
+
+/// Data of a coupling scheme in a batch needed for its timestep vote
+struct BatchedVoteScheme
+{
+  CouplingScheme::Viewer cs;
+  TimestepVoteView vote;
+  RealT proj_ratio;
+  bool votes;
+};
+
+/**
+ * @brief Computes the common plane timestep vote of a batch of coupling schemes
+ *
+ * @param [in] schemes coupling schemes in the batch
+ * @param [in] plane_offsets per-scheme offsets into the contact planes of the batch
+ * @param [in] num_planes total number of contact planes in the batch
+ * @param [in] scheme_err enforcement error code of each coupling scheme
+ * @param [in,out] dt simulation timestep at given cycle
+ *
+ * @note Applies the checks of CouplingScheme::computeTimeStep() and 
+ * CouplingScheme::computeCommonPlaneTimeStep() to each coupling scheme and 
+ * computes the votes of all voting coupling schemes in one loop.
+ */
+void computeTimeStepBatched( const std::vector<CouplingScheme*>& schemes,
+                             ArrayViewT<const IndexT> plane_offsets,
+                             IndexT num_planes,
+                             const std::vector<int>& scheme_err,
+                             RealT& dt )
+{
+  const IndexT num_schemes = static_cast<IndexT>(schemes.size());
+
+  // a cycle without a vote does not keep the details of a previous cycle
+  for (auto cs : schemes)
+  {
+    cs->allocateTimestepVoteData( 0, dt );
+  }
+
+  if (dt < 1.e-8)
+  {
+    // current timestep too small for Tribol vote. Leave unchanged and return
+    return;
+  }
+
+  ArrayT<BatchedVoteScheme, 1, MemorySpace::Host> schemes_host(0, num_schemes);
+  bool any_votes = false;
+  for (IndexT s{0}; s < num_schemes; ++s)
+  {
+    auto& cs = *schemes[s];
+    auto& mesh1 = cs.getMesh1();
+    auto& mesh2 = cs.getMesh2();
+    bool votes = scheme_err[s] == 0 && cs.getNumActivePairs() > 0;
+
+    // make sure velocities are registered
+    if (votes && (!mesh1.hasVelocity() || !mesh2.hasVelocity()))
+    {
+      if (mesh1.numberOfElements() > 0 && mesh2.numberOfElements() > 0)
+      {
+        // invalid registration of nodal velocities for non-null meshes
+        dt = -1.0;
+        return;
+      }
+      votes = false;
+    }
+
+    // element thicknesses set the maximum allowable interpenetration
+    votes = votes && cs.getParameters().enable_timestep_vote &&
+            mesh1.getElementData().m_is_element_thickness_set &&
+            mesh2.getElementData().m_is_element_thickness_set;
+    if (votes)
+    {
+      cs.allocateTimestepVoteData( cs.getNumActivePairs(), dt );
+    }
+    any_votes = any_votes || votes;
+    schemes_host.push_back( BatchedVoteScheme{ cs.getView(), cs.getTimestepVoteData().view(), 
+                                               cs.getParameters().timestep_pen_frac, votes } );
+  }
+
+  if (!any_votes)
+  {
+    return;
+  }
+
+  const ExecutionMode exec_mode = schemes[0]->getExecutionMode();
+  const int allocator_id = schemes[0]->getAllocatorId();
+  BatchedVoteScheme* batch = axom::allocate<BatchedVoteScheme>(num_schemes, allocator_id);
+  axom::copy(batch, schemes_host.data(), num_schemes * sizeof(BatchedVoteScheme));
+
+  ArrayT<RealT> dt_temp_data({dt, dt}, allocator_id);
+  ArrayViewT<RealT> dt_temp = dt_temp_data;
+  // [0]: exceed_max_gap1, [1]: exceed_max_gap2, [2]: neg_dt_gap_msg, [3]: neg_dt_vel_proj_msg
+  ArrayT<bool> msg_data({false, false, false, false}, allocator_id);
+  ArrayViewT<bool> msg = msg_data;
+
+  forAllExec(exec_mode, num_planes,
+    [batch, plane_offsets, num_schemes, dt, dt_temp, msg] TRIBOL_HOST_DEVICE (IndexT k)
+    {
+      const IndexT s = findBatchScheme( plane_offsets, num_schemes, k );
+      const auto& scheme = batch[s];
+      if (scheme.votes)
+      {
+        CommonPlanePairTimeStep( scheme.cs, k - plane_offsets[s], scheme.proj_ratio, dt, 
+                                 scheme.vote, dt_temp, msg );
+      }
+    }
+  );
+
+  axom::deallocate(batch);
+
+  ArrayT<bool, 1, MemorySpace::Host> msg_host(msg_data);
+  SLIC_DEBUG_IF(msg_host[0] || msg_host[1], "tribol::computeTimeStepBatched(): " <<
+                "there are locations where mesh overlap may be too large. " <<
+                "Cannot provide timestep vote. Reduce timestep and/or increase " << 
+                "penalty.");
+  SLIC_DEBUG_IF(msg_host[2], "tribol::computeTimeStepBatched(): " <<
+                "one or more face-pairs have a negative timestep vote based on " << 
+                "maximum gap check." );
+  SLIC_DEBUG_IF(msg_host[3], "tribol::computeTimeStepBatched(): " <<
+                "one or more face-pairs have a negative timestep vote based on " << 
+                "velocity projection calculation." );
+
+  ArrayT<RealT, 1, MemorySpace::Host> dt_temp_host(dt_temp_data);
+  dt = axom::utilities::min(dt_temp_host[0], dt_temp_host[1]);
+
+} // end computeTimeStepBatched()
+
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+bool canBatchCouplingSchemes( const CouplingScheme& cs1, const CouplingScheme& cs2 )
+{
+  // rigid surface schemes have no contact planes to batch
+  return cs1.getParameters().enable_scheme_batching && 
+         cs2.getParameters().enable_scheme_batching &&
+         !cs1.hasRigidSurface() && !cs2.hasRigidSurface() &&
+         cs1.getParameters().contact_plane_budget == 0 &&
+         cs2.getParameters().contact_plane_budget == 0 &&
+         cs1.getParameters().overlap_cache_ratio == 0. &&
+         cs2.getParameters().overlap_cache_ratio == 0. &&
+         cs1.getExecutionMode() == cs2.getExecutionMode() &&
+         cs1.spatialDimension() == cs2.spatialDimension() &&
+         cs1.getContactMethod() == cs2.getContactMethod() &&
+         cs1.getContactCase() == cs2.getContactCase() &&
+         cs1.getEnforcementMethod() == cs2.getEnforcementMethod() &&
+         cs1.getMesh1().getElementType() == cs2.getMesh1().getElementType() &&
+         cs1.getMesh2().getElementType() == cs2.getMesh2().getElementType();
+}
+
+//------------------------------------------------------------------------------
+void computeContactPlanesBatched( const std::vector<CouplingScheme*>& schemes )
+{
+  const IndexT num_schemes = static_cast<IndexT>(schemes.size());
+  if (num_schemes == 0)
+  {
+    return;
+  }
+
+  const ExecutionMode exec_mode = schemes[0]->getExecutionMode();
+  const int allocator_id = schemes[0]->getAllocatorId();
+
+  ///////////////////////////////////////////////////////////
+  // build the scheme offset table and the per-scheme data //
+  ///////////////////////////////////////////////////////////
+  ArrayT<IndexT, 1, MemorySpace::Host> offsets_host(num_schemes + 1, num_schemes + 1);
+  ArrayT<BatchedScheme, 1, MemorySpace::Host> schemes_host(0, num_schemes);
+  offsets_host[0] = 0;
+  for (IndexT s{0}; s < num_schemes; ++s)
+  {
+    auto& cs = *schemes[s];
+    SLIC_ASSERT( canBatchCouplingSchemes( *schemes[0], cs ) );
+    cs.allocateContactPlanes();
+    offsets_host[s+1] = offsets_host[s] + cs.getInterfacePairs().size();
+    schemes_host.push_back( BatchedScheme{ cs.getView(), cs.getInterfacePairs().view() } );
+  }
+  const IndexT num_pairs = offsets_host[num_schemes];
+
+  SLIC_DEBUG("Batch of " << num_schemes << " coupling schemes has " << num_pairs << " pairs.");
+
+  ArrayT<IndexT> offsets_data(num_schemes + 1, num_schemes + 1, allocator_id);
+  axom::copy(offsets_data.data(), offsets_host.data(), (num_schemes + 1) * sizeof(IndexT));
+  BatchedScheme* batch = axom::allocate<BatchedScheme>(num_schemes, allocator_id);
+  axom::copy(batch, schemes_host.data(), num_schemes * sizeof(BatchedScheme));
+
+  // per-scheme plane counts and face geometry error flags
+  ArrayT<IndexT> planes_ct_data(num_schemes, num_schemes, allocator_id);
+  ArrayT<int> pair_err_data(num_schemes, num_schemes, allocator_id);
+  ArrayViewT<const IndexT> offsets( offsets_data.data(), num_schemes + 1 );
+  auto planes_ct = planes_ct_data.view();
+  auto pair_err = pair_err_data.view();
+
+  forAllExec(exec_mode, num_pairs,
+    [batch, offsets, num_schemes, planes_ct, pair_err] TRIBOL_HOST_DEVICE (IndexT i)
+    {
+      const IndexT s = findBatchScheme( offsets, num_schemes, i );
+      const auto& cs = batch[s].cs;
+      auto& pair = batch[s].pairs[i - offsets[s]];
+      auto planes_2d = cs.get2DContactPlanes();
+      auto planes_3d = cs.get3DContactPlanes();
+
+      bool interact = false;
+      FaceGeomError interact_err = CheckInterfacePair(
+        pair, cs.getMesh1View(), cs.getMesh2View(), cs.getParameters(), 
+        cs.getContactMethod(), cs.getContactCase(), interact, planes_2d, 
+        planes_3d, &planes_ct[s]);
+
+      // skip face-pairs with errors, matching CouplingScheme::apply()
+      if (interact_err != NO_FACE_GEOM_ERROR)
+      {
+        pair_err[s] = 1;
+        pair.m_is_contact_candidate = false;
+      }
+      else
+      {
+        pair.m_is_contact_candidate = interact;
+      }
+    }
+  );
+
+  axom::deallocate(batch);
+
+  // a single read back for the whole batch
+  ArrayT<IndexT, 1, MemorySpace::Host> planes_ct_host(planes_ct_data);
+  ArrayT<int, 1, MemorySpace::Host> pair_err_host(pair_err_data);
+  for (IndexT s{0}; s < num_schemes; ++s)
+  {
+    schemes[s]->finalizeContactPlanes(planes_ct_host[s], pair_err_host[s] != 0);
+  }
+
+} // end computeContactPlanesBatched()
+
+//------------------------------------------------------------------------------
+bool canBatchPhysics( const std::vector<CouplingScheme*>& schemes )
+{
+  if (schemes.empty())
+  {
+    return false;
+  }
+  const auto constraint_type = 
+    schemes[0]->getEnforcementOptions().penalty_options.constraint_type;
+  for (auto cs : schemes)
+  {
+    // the batched enforcement scatters with atomics, so coupling schemes with
+    // pair coloring are applied one at a time
+    if (cs->getContactMethod() != COMMON_PLANE ||
+        cs->getEnforcementMethod() != PENALTY ||
+        cs->getParameters().enable_pair_coloring ||
+        cs->getEnforcementOptions().penalty_options.constraint_type != constraint_type)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+std::vector<int> applyPhysicsBatched( const std::vector<CouplingScheme*>& schemes,
+                                      int cycle, 
+                                      RealT t, 
+                                      RealT& dt )
+{
+  const IndexT num_schemes = static_cast<IndexT>(schemes.size());
+  std::vector<int> scheme_err(num_schemes, 0);
+
+  if (!canBatchPhysics( schemes ))
+  {
+    for (IndexT s{0}; s < num_schemes; ++s)
+    {
+      scheme_err[s] = schemes[s]->applyPhysics( cycle, t, dt );
+    }
+    return scheme_err;
+  }
+
+  ////////////////////////////////////////////////////////////
+  // build the scheme offset table of the active pairs. The //
+  // enforcement and the timestep vote both loop over it.   //
+  ////////////////////////////////////////////////////////////
+  const int allocator_id = schemes[0]->getAllocatorId();
+  ArrayT<IndexT, 1, MemorySpace::Host> offsets_host(num_schemes + 1, num_schemes + 1);
+  offsets_host[0] = 0;
+  for (IndexT s{0}; s < num_schemes; ++s)
+  {
+    offsets_host[s+1] = offsets_host[s] + schemes[s]->getNumActivePairs();
+  }
+  const IndexT num_planes = offsets_host[num_schemes];
+  ArrayT<IndexT> offsets_data(num_schemes + 1, num_schemes + 1, allocator_id);
+  axom::copy(offsets_data.data(), offsets_host.data(), (num_schemes + 1) * sizeof(IndexT));
+  ArrayViewT<const IndexT> plane_offsets( offsets_data.data(), num_schemes + 1 );
+
+  axom::utilities::Timer timer( true );
+  scheme_err = ApplyCommonPlanePenaltyBatched( schemes, plane_offsets, num_planes );
+  timer.stop();
+
+  for (IndexT s{0}; s < num_schemes; ++s)
+  {
+    auto& cs = *schemes[s];
+
+    // the enforcement time of a batch is split evenly between its coupling schemes
+    auto& lb_local = cs.getLoadBalanceData().m_local;
+    lb_local[LB_CANDIDATE_PAIRS] = static_cast<double>(cs.getInterfacePairs().size());
+    lb_local[LB_ACTIVE_PAIRS] = static_cast<double>(cs.getNumActivePairs());
+    lb_local[LB_ENFORCEMENT_TIME] = timer.elapsedTimeInSec() / num_schemes;
+
+    SLIC_WARNING_IF(scheme_err[s] != 0, "applyPhysicsBatched(): error in the penalty " <<
+                    "enforcement of coupling scheme, " << cs.getId() << ".");
+  }
+
+  computeTimeStepBatched( schemes, plane_offsets, num_planes, scheme_err, dt );
+
+  for (IndexT s{0}; s < num_schemes; ++s)
+  {
+    auto& cs = *schemes[s];
+    cs.writeInterfaceOutput( cs.getOutputDirectory(), cs.getParameters().vis_type, cycle, t );
+    if (scheme_err[s] != 0)
+    {
+      scheme_err[s] = 1;
+    }
+    else
+    {
+      cs.printPairReportingData();
+    }
+  }
+
+  return scheme_err;
+
+} // end applyPhysicsBatched()
+
+} // end namespace tribol
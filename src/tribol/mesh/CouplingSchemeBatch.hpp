@@ -0,0 +1,131 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_MESH_COUPLINGSCHEMEBATCH_HPP_
+#define SRC_MESH_COUPLINGSCHEMEBATCH_HPP_
+
+#include "tribol/mesh/CouplingScheme.hpp"
+
+#include <vector>
+
+namespace tribol
+{
+
+/**
+ * @brief Checks if two coupling schemes may be processed in the same batch
+ *
+ * Batched coupling schemes share the contact plane kernel launch, so they must
+ * have the same execution mode, spatial dimension, contact method, contact 
+ * case, enforcement method and element types. Both coupling schemes must also
+ * have batching enabled, no rigid surface, no contact plane budget and no 
+ * overlap cache. Passing the same coupling scheme twice checks whether it may
+ * be batched at all.
+ *
+ * @param [in] cs1 first coupling scheme
+ * @param [in] cs2 second coupling scheme
+ *
+ * @pre both coupling schemes have been initialized
+ *
+ * @return true if the coupling schemes are compatible
+ */
+bool canBatchCouplingSchemes( const CouplingScheme& cs1, const CouplingScheme& cs2 );
+
+/**
+ * @brief Computes the contact planes of a batch of coupling schemes
+ *
+ * The interface pairs of all coupling schemes in the batch are treated as one
+ * segmented array. A table of per-scheme offsets into the segmented array maps 
+ * each pair to its coupling scheme, so CheckInterfacePair() runs as a single 
+ * loop over all pairs. Plane counts and face geometry errors of the batch are 
+ * read back to the host at once.
+ *
+ * @param [in] schemes coupling schemes in the batch
+ *
+ * @pre each pair of coupling schemes in the batch passes canBatchCouplingSchemes()
+ * @pre binning has been performed on each coupling scheme
+ *
+ * @note Equivalent to the contact plane phase of CouplingScheme::apply(). Face
+ * data and binning still run per coupling scheme. Call applyPhysicsBatched()
+ * on the batch afterwards.
+ */
+void computeContactPlanesBatched( const std::vector<CouplingScheme*>& schemes );
+
+/**
+ * @brief Checks if the interface physics of a batch of coupling schemes may be
+ * applied in one pass
+ *
+ * The batched interface physics is implemented for COMMON_PLANE + PENALTY 
+ * coupling schemes with the same penalty constraint type and without pair 
+ * coloring.
+ *
+ * @param [in] schemes coupling schemes in the batch
+ *
+ * @pre each pair of coupling schemes in the batch passes canBatchCouplingSchemes()
+ *
+ * @return true if applyPhysicsBatched() processes the batch in one pass
+ */
+bool canBatchPhysics( const std::vector<CouplingScheme*>& schemes );
+
+/**
+ * @brief Applies the interface physics and computes the timestep vote of a 
+ * batch of coupling schemes
+ *
+ * If the batch passes canBatchPhysics(), the contact planes of all coupling 
+ * schemes are treated as one segmented array with a table of per-scheme 
+ * offsets, and the penalty enforcement and the timestep vote each run as a 
+ * single loop over all planes. Otherwise, CouplingScheme::applyPhysics() is 
+ * called on each coupling scheme.
+ *
+ * @param [in] schemes coupling schemes in the batch
+ * @param [in] cycle the cycle at which this method is invoked
+ * @param [in] t the simulation time at the given cycle
+ * @param [in,out] dt the simulation dt at the given cycle sent back as Tribol timestep vote
+ *
+ * @pre computeContactPlanesBatched() has been called on the batch
+ *
+ * @return return code of each coupling scheme, as of CouplingScheme::applyPhysics()
+ *
+ * @note In a batch, all coupling schemes vote on the timestep entering the 
+ * batch and the batch returns the minimum vote. Coupling schemes applied one 
+ * at a time vote on the timestep reduced by the coupling schemes before them.
+ */
+std::vector<int> applyPhysicsBatched( const std::vector<CouplingScheme*>& schemes,
+                                      int cycle, 
+                                      RealT t, 
+                                      RealT& dt );
+
+/**
+ * @brief Finds the coupling scheme of an entry of a segmented batch array
+ *
+ * @param [in] offsets per-scheme offsets into the segmented array (size num_schemes + 1)
+ * @param [in] num_schemes number of coupling schemes in the batch
+ * @param [in] i index into the segmented array
+ *
+ * @return coupling scheme s with offsets[s] <= i < offsets[s+1]
+ */
+TRIBOL_HOST_DEVICE inline IndexT findBatchScheme( ArrayViewT<const IndexT> offsets, 
+                                                  IndexT num_schemes, 
+                                                  IndexT i )
+{
+  IndexT lo = 0;
+  IndexT hi = num_schemes;
+  while (hi - lo > 1)
+  {
+    IndexT mid = (lo + hi) / 2;
+    if (offsets[mid] <= i)
+    {
+      lo = mid;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+} // end namespace tribol
+
+#endif /* SRC_MESH_COUPLINGSCHEMEBATCH_HPP_ */
@@ -12,6 +12,7 @@
 #include <sstream>
 #include <iomanip>
 #include <fstream>
+#include <vector>
 
 #include "axom/slic.hpp"
 #include "axom/fmt.hpp"
@@ -244,6 +245,12 @@ void MeshData::setPosition( const RealT* x,
   m_position = createNodalVector(x, y, z);
 }
 
+//------------------------------------------------------------------------------
+void MeshData::setPosition( const RealT* data, IndexT node_stride, IndexT component_stride )
+{
+  m_position = createStridedNodalVector(data, node_stride, component_stride);
+}
+
 //------------------------------------------------------------------------------
 void MeshData::setDisplacement( const RealT* ux,
                                 const RealT* uy,
@@ -252,6 +259,12 @@ void MeshData::setDisplacement( const RealT* ux,
   m_disp = createNodalVector(ux, uy, uz);
 }
 
+//------------------------------------------------------------------------------
+void MeshData::setDisplacement( const RealT* data, IndexT node_stride, IndexT component_stride )
+{
+  m_disp = createStridedNodalVector(data, node_stride, component_stride);
+}
+
 //------------------------------------------------------------------------------
 void MeshData::setVelocity( const RealT* vx,
                             const RealT* vy,
@@ -260,6 +273,12 @@ void MeshData::setVelocity( const RealT* vx,
   m_vel = createNodalVector(vx, vy, vz);
 }
 
+//------------------------------------------------------------------------------
+void MeshData::setVelocity( const RealT* data, IndexT node_stride, IndexT component_stride )
+{
+  m_vel = createStridedNodalVector(data, node_stride, component_stride);
+}
+
 //------------------------------------------------------------------------------
 void MeshData::setResponse( RealT* rx,
                             RealT* ry,
@@ -268,6 +287,21 @@ void MeshData::setResponse( RealT* rx,
   m_response = createNodalVector(rx, ry, rz);
 }
 
+//------------------------------------------------------------------------------
+void MeshData::setResponse( RealT* data, IndexT node_stride, IndexT component_stride )
+{
+  m_response = createStridedNodalVector(data, node_stride, component_stride);
+}
+
+//------------------------------------------------------------------------------
+void MeshData::setOwnedConnectivity( Array2D<IndexT>&& connectivity )
+{
+  m_owned_connectivity = std::move(connectivity);
+  m_connectivity = createConnectivity(m_owned_connectivity.shape()[0], 
+                                      m_owned_connectivity.data());
+  getElementData().m_num_cells = m_owned_connectivity.shape()[0];
+}
+
 //------------------------------------------------------------------------------
 int MeshData::getDimFromElementType() const
 {
@@ -382,17 +416,22 @@ bool MeshData::computeFaceData(ExecutionMode exec_mode)
   
   ArrayT<IndexT> face_data_ok_data({static_cast<IndexT>(true)}, m_allocator_id);
 
+  // gather the face-major nodal coordinates (and velocities) once per cycle;
+  // the loop below and downstream kernels read these contiguous rows
+  computeFaceCoords(exec_mode);
+
   // loop over all elements in the mesh
   Array2DView<RealT> c = m_c;
-  MultiViewArrayView<const RealT> x = m_position;
+  Array2DView<const RealT> x( m_face_x.data(), m_face_x.shape() );
   Array2DView<RealT> n = m_n;
   Array1DView<RealT> area = m_area;
   Array1DView<RealT> radius = m_face_radius;
+  auto radius_inflation = m_face_radius_inflation;
   auto dim = m_dim;
   auto conn = m_connectivity;
   ArrayViewT<IndexT> face_data_ok = face_data_ok_data;
   forAllExec(exec_mode, numberOfElements(), 
-    [c, x, n, area, radius, dim, conn, face_data_ok] TRIBOL_HOST_DEVICE (IndexT i) {
+    [c, x, n, area, radius, radius_inflation, dim, conn, face_data_ok] TRIBOL_HOST_DEVICE (IndexT i) {
 
       // compute the vertex average centroid. This will lie in the 
       // plane of the face for planar faces, and will be used as 
@@ -401,10 +440,9 @@ bool MeshData::computeFaceData(ExecutionMode exec_mode)
       // loop over the nodes per element
       auto num_nodes_per_elem = conn.shape()[1];
       for (int j=0; j<num_nodes_per_elem; ++j) {
-        auto node_id = conn(i, j);
         for (IndexT d{0}; d < dim; ++d)
         {
-          c[d][i] += x[d][ node_id ];
+          c[d][i] += x(i, dim*j + d);
         }
       } // end loop over nodes
      
@@ -421,18 +459,17 @@ bool MeshData::computeFaceData(ExecutionMode exec_mode)
       // "link" vector from the ith node to the face center
       RealT sqr_radius = 0.0;
       for (int j=0; j<num_nodes_per_elem; ++j) {
-        const int node_id = conn(i, j);
         RealT sqr_link_mag = 0.0;
         for (IndexT d{0}; d < dim; ++d)
         {
-          RealT lv = x[d][node_id] - c[d][i];
+          RealT lv = x(i, dim*j + d) - c[d][i];
           sqr_link_mag += lv * lv;
         }
         if (sqr_link_mag > sqr_radius) {
           sqr_radius = sqr_link_mag;
         }
       } 
-      radius[i] = sqrt(sqr_radius);
+      radius[i] = sqrt(sqr_radius) + radius_inflation;
 
       // compute the outward facing normal
       if (dim == 2) {
@@ -441,10 +478,8 @@ bool MeshData::computeFaceData(ExecutionMode exec_mode)
         // counter-clockwise ordering of the quad4 area element
         // to which the 1D line segment belongs. This is to properly 
         // orient the normal outward
-        auto node_id = conn(i, 0);
-        auto next_node_id = conn(i, 1);
-        RealT lambdaX = x[0][ next_node_id ] - x[0][ node_id ];
-        RealT lambdaY = x[1][ next_node_id ] - x[1][ node_id ];
+        RealT lambdaX = x(i, 2) - x(i, 0);
+        RealT lambdaY = x(i, 3) - x(i, 1);
   
         n[0][i] = lambdaY;
         n[1][i] = -lambdaX;
@@ -479,22 +514,22 @@ bool MeshData::computeFaceData(ExecutionMode exec_mode)
         // normal
         for (int j=0; j<num_nodes_per_elem; ++j) 
         {
-          auto node_id = conn(i, j);
-          auto next_node_id = conn(i, 0);
+          auto a = 3*j;
+          auto next_a = 0;
           if (j < num_nodes_per_elem - 1)
           {
-            next_node_id = conn(i, j+1);
+            next_a = 3*(j+1);
           }
           // first triangle edge vector between the face's two edge nodes
-          auto vX1 = x[0][ next_node_id ] - x[0][ node_id ];
-          auto vY1 = x[1][ next_node_id ] - x[1][ node_id ];
-          auto vZ1 = x[2][ next_node_id ] - x[2][ node_id ];
+          auto vX1 = x(i, next_a) - x(i, a);
+          auto vY1 = x(i, next_a+1) - x(i, a+1);
+          auto vZ1 = x(i, next_a+2) - x(i, a+2);
           
           // second triangle edge vector between the face centroid 
           // and the face edge's first node
-          auto vX2 = c[0][i] - x[0][ node_id ];
-          auto vY2 = c[1][i] - x[1][ node_id ];
-          auto vZ2 = c[2][i] - x[2][ node_id ];
+          auto vX2 = c[0][i] - x(i, a);
+          auto vY2 = c[1][i] - x(i, a+1);
+          auto vZ2 = c[2][i] - x(i, a+2);
 
           // compute the contribution to the pallet normal as v1 x v2. Sum these
           // into the face normal component variables stored on the mesh data
@@ -546,6 +581,109 @@ bool MeshData::computeFaceData(ExecutionMode exec_mode)
 
 } // end MeshData::computeFaceData()
 
+//------------------------------------------------------------------------------
+void MeshData::computeFaceCoords(ExecutionMode exec_mode)
+{
+  const IndexT num_values = m_dim * numberOfNodesPerElement();
+  m_face_x = Array2D<RealT>({numberOfElements(), num_values}, m_allocator_id);
+  m_face_v = hasVelocity() ? Array2D<RealT>({numberOfElements(), num_values}, m_allocator_id)
+                           : Array2D<RealT>();
+
+  Array2DView<RealT> face_x = m_face_x;
+  Array2DView<RealT> face_v = m_face_v;
+  VectorFieldView<const RealT> x = m_position;
+  VectorFieldView<const RealT> v = m_vel;
+  auto dim = m_dim;
+  auto conn = m_connectivity;
+  bool has_vel = hasVelocity();
+  forAllExec(exec_mode, numberOfElements(), 
+    [face_x, face_v, x, v, dim, conn, has_vel] TRIBOL_HOST_DEVICE (IndexT i) {
+      for (IndexT a{0}; a < conn.shape()[1]; ++a)
+      {
+        auto node_id = conn(i, a);
+        for (int d{0}; d < dim; ++d)
+        {
+          face_x(i, dim*a + d) = x[d][node_id];
+          if (has_vel)
+          {
+            face_v(i, dim*a + d) = v[d][node_id];
+          }
+        }
+      }
+  });
+
+} // end MeshData::computeFaceCoords()
+
+//------------------------------------------------------------------------------
+bool MeshData::computePenaltyData( const PenaltyEnforcementOptions& pen_options,
+                                   ExecutionMode exec_mode )
+{
+  m_face_penalty_stiffness = Array1D<RealT>(numberOfElements(), numberOfElements(), m_allocator_id);
+  m_face_rate_penalty = Array1D<RealT>(numberOfElements(), numberOfElements(), m_allocator_id);
+
+  if (numberOfElements() == 0)
+  {
+    return true;
+  }
+
+  ArrayT<bool> neg_thickness_data({false}, m_allocator_id);
+  ArrayViewT<bool> neg_thickness = neg_thickness_data;
+
+  Array1DView<RealT> stiffness = m_face_penalty_stiffness;
+  Array1DView<RealT> rate_penalty = m_face_rate_penalty;
+  auto mat_mod = m_element_data.m_mat_mod;
+  auto thickness = m_element_data.m_thickness;
+
+  // resolve the mesh-constant values on the host so the kernel is free of 
+  // option lookups
+  const bool element_penalty = 
+    pen_options.kinematic_calculation == KINEMATIC_ELEMENT;
+  const RealT pen_scale = m_element_data.m_penalty_scale;
+  const RealT const_stiffness = pen_scale * m_element_data.m_penalty_stiffness;
+  const RealT tiny_length = pen_options.tiny_length;
+  RealT rate_coef = 0.;
+  if (pen_options.constraint_type == KINEMATIC_AND_RATE)
+  {
+    switch (pen_options.rate_calculation)
+    {
+      case RATE_CONSTANT:
+        rate_coef = m_element_data.m_rate_penalty_stiffness;
+        break;
+      case RATE_PERCENT:
+        rate_coef = m_element_data.m_rate_percent_stiffness;
+        break;
+      default:
+        // no-op, quiet compiler
+        break;
+    }
+  }
+
+  forAllExec(exec_mode, numberOfElements(),
+    [stiffness, rate_penalty, mat_mod, thickness, element_penalty, pen_scale,
+     const_stiffness, tiny_length, rate_coef, neg_thickness] TRIBOL_HOST_DEVICE (IndexT i) {
+      if (element_penalty)
+      {
+        // add tiny_length to element thickness to avoid division by zero
+        RealT t = thickness[i] + tiny_length;
+        if (t < 0.)
+        {
+          neg_thickness[0] = true;
+        }
+        // pre-multiply the material modulus by the mesh penalty scale
+        stiffness[i] = pen_scale * mat_mod[i] / t;
+      }
+      else
+      {
+        stiffness[i] = const_stiffness;
+      }
+      rate_penalty[i] = rate_coef;
+  });
+
+  ArrayT<bool, 1, MemorySpace::Host> neg_thickness_host(neg_thickness_data);
+  return !neg_thickness_host[0];
+
+} // end MeshData::computePenaltyData()
+
 //------------------------------------------------------------------------------
 RealT MeshData::computeEdgeLength( int faceId ) 
 {
@@ -727,23 +865,38 @@ void MeshData::print(std::ostream& os) const
       return;
    }
 
+   // nodal components may be strided, so gather them before printing
+   auto gather = [num_verts]( const StridedArrayView<const RealT>& comp )
+   {
+      std::vector<RealT> vals( num_verts );
+      for (int i{0}; i < num_verts; ++i)
+      {
+         vals[i] = comp[i];
+      }
+      return vals;
+   };
+
    os << "{\n";
    os << axom::fmt::format("  verts ({}) {{",num_verts);
    // positions
-   os << axom::fmt::format("\n\tx: {}", axom::fmt::join(m_position[0].data(), m_position[0].data()+num_verts, ", "));
-   os << axom::fmt::format("\n\ty: {}", axom::fmt::join(m_position[1].data(), m_position[1].data()+num_verts, ", "));
+   os << axom::fmt::format("\n\tx: {}", axom::fmt::join(gather(m_position[0]), ", "));
+   os << axom::fmt::format("\n\ty: {}", axom::fmt::join(gather(m_position[1]), ", "));
    if(m_dim == 3)
    {  
-      os << axom::fmt::format("\n\tz: {}", axom::fmt::join(m_position[2].data(), m_position[2].data()+num_verts, ", "));
+      os << axom::fmt::format("\n\tz: {}", axom::fmt::join(gather(m_position[2]), ", "));
    }
    // contact response (force)
    if( !m_response.empty() )
    {
-      os << axom::fmt::format("\n\tfx: {}", axom::fmt::join(m_response[0].data(), m_response[0].data()+num_verts, ", "));
-      os << axom::fmt::format("\n\tfy: {}", axom::fmt::join(m_response[1].data(), m_response[1].data()+num_verts, ", "));
+      auto response = [&gather]( const StridedArrayView<RealT>& comp )
+      {
+         return gather( StridedArrayView<const RealT>( comp.data(), comp.size(), comp.stride() ) );
+      };
+      os << axom::fmt::format("\n\tfx: {}", axom::fmt::join(response(m_response[0]), ", "));
+      os << axom::fmt::format("\n\tfy: {}", axom::fmt::join(response(m_response[1]), ", "));
       if(m_dim == 3)
       {  
-         os << axom::fmt::format("\n\tfz: {}", axom::fmt::join(m_response[2].data(), m_response[2].data()+num_verts, ", "));
+         os << axom::fmt::format("\n\tfz: {}", axom::fmt::join(response(m_response[2]), ", "));
       }
    }
    os << "\n  }";
@@ -799,6 +952,12 @@ MeshData::Viewer::Viewer(MeshData& mesh)
 , m_n( mesh.m_n )
 , m_face_radius( mesh.m_face_radius )
 , m_area( mesh.m_area )
+, m_face_penalty_stiffness( mesh.m_face_penalty_stiffness )
+, m_face_rate_penalty( mesh.m_face_rate_penalty )
+, m_face_x( mesh.m_face_x.data(), mesh.m_face_x.shape() )
+, m_face_v( mesh.m_face_v.data(), mesh.m_face_v.shape() )
+, m_is_rigid( mesh.m_is_rigid )
+, m_rigid_surface( mesh.m_rigid_surface )
 , m_nodal_fields( mesh.m_nodal_fields )
 , m_element_data( mesh.m_element_data )
 {}
@@ -808,6 +967,15 @@ TRIBOL_HOST_DEVICE void MeshData::Viewer::getFaceCoords( IndexT face_id, RealT*
 {
   auto dim = spatialDimension();
 
+  if (!m_face_x.empty())
+  {
+    for (IndexT k{0}; k < dim * numberOfNodesPerElement(); ++k)
+    {
+      coords[k] = m_face_x(face_id, k);
+    }
+    return;
+  }
+
   for (IndexT a{0}; a < numberOfNodesPerElement(); ++a)
   {
     IndexT node_id = getGlobalNodeId(face_id, a);
@@ -826,6 +994,15 @@ TRIBOL_HOST_DEVICE void MeshData::Viewer::getFaceVelocities( IndexT face_id, Rea
 {
   auto dim = spatialDimension();
 
+  if (!m_face_v.empty())
+  {
+    for (IndexT k{0}; k < dim * numberOfNodesPerElement(); ++k)
+    {
+      vels[k] = m_face_v(face_id, k);
+    }
+    return;
+  }
+
   for (IndexT a{0}; a < numberOfNodesPerElement(); ++a)
   {
     IndexT node_id = getGlobalNodeId(face_id, a);
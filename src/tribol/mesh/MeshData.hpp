@@ -11,6 +11,7 @@
 #include "tribol/common/ArrayTypes.hpp"
 #include "tribol/common/LoopExec.hpp"
 #include "tribol/common/Parameters.hpp"
+#include "tribol/geom/RigidSurface.hpp"
 #include "tribol/utils/DataManager.hpp"
 
 namespace tribol
@@ -64,6 +65,23 @@ struct MeshElemData
 
   bool m_is_element_thickness_set          {false}; ///< True if element thickness is set
 
+  //////////////////////////////////
+  // PARALLEL FACE OWNERSHIP DATA //
+  //////////////////////////////////
+  ArrayViewT<const IndexT> m_global_face_ids; ///< Global id of each contact face, unique over all ranks and meshes
+  ArrayViewT<const bool> m_ghost_faces;       ///< True if a contact face is a ghost of a face owned by another rank
+
+  /*!
+  * \brief Checks if parallel face ownership data has been registered
+  *
+  * \return true if global face ids and ghost flags are set
+  */
+  bool hasFaceOwnership() const 
+  { 
+    return m_num_cells > 0 && m_global_face_ids.size() == m_num_cells && 
+           m_ghost_faces.size() == m_num_cells;
+  }
+
   /*!
   * \brief Checks if the kinematic penalty data is valid
   *
@@ -194,11 +212,11 @@ public:
     }
 
     /**
-     * @brief Get the nodal position array views
+     * @brief Get the nodal position component views
      * 
-     * @return array view of the nodal position arrays
+     * @return view of the nodal position components
      */
-    TRIBOL_HOST_DEVICE const MultiViewArrayView<const RealT>& getPosition() const
+    TRIBOL_HOST_DEVICE const VectorFieldView<const RealT>& getPosition() const
     {
       return m_position;
     }
@@ -211,11 +229,11 @@ public:
     TRIBOL_HOST_DEVICE bool hasDisplacement() const { return !m_disp.empty(); }
 
     /**
-     * @brief Get the nodal displacement array views
+     * @brief Get the nodal displacement component views
      * 
-     * @return array view of the nodal displacement arrays
+     * @return view of the nodal displacement components
      */
-    TRIBOL_HOST_DEVICE const MultiViewArrayView<const RealT>& getDisplacement() const
+    TRIBOL_HOST_DEVICE const VectorFieldView<const RealT>& getDisplacement() const
     {
       return m_disp;
     }
@@ -228,11 +246,11 @@ public:
     TRIBOL_HOST_DEVICE bool hasVelocity() const { return !m_vel.empty(); }
 
     /**
-     * @brief Get the nodal velocity array views
+     * @brief Get the nodal velocity component views
      * 
-     * @return array view of the nodal velocity arrays
+     * @return view of the nodal velocity components
      */
-    TRIBOL_HOST_DEVICE const MultiViewArrayView<const RealT>& getVelocity() const
+    TRIBOL_HOST_DEVICE const VectorFieldView<const RealT>& getVelocity() const
     {
       return m_vel;
     }
@@ -245,11 +263,11 @@ public:
     TRIBOL_HOST_DEVICE bool hasResponse() const { return !m_response.empty(); }
 
     /**
-     * @brief Get the nodal response array views
+     * @brief Get the nodal response component views
      * 
-     * @return array view of the nodal response arrays
+     * @return view of the nodal response components
      */
-    TRIBOL_HOST_DEVICE const MultiViewArrayView<RealT>& getResponse() const
+    TRIBOL_HOST_DEVICE const VectorFieldView<RealT>& getResponse() const
     {
       return m_response;
     }
@@ -339,6 +357,53 @@ public:
       return m_area;
     }
 
+    /**
+     * @brief Is the per-face penalty stiffness vector populated?
+     * 
+     * @return true if non-empty; false otherwise
+     */
+    TRIBOL_HOST_DEVICE bool hasFacePenaltyStiffness() const { return !m_face_penalty_stiffness.empty(); }
+
+    /**
+     * @brief Get an array view of the per-face kinematic penalty stiffness
+     *
+     * @note Each entry is the face spring stiffness (K/t or the constant
+     * penalty) premultiplied by the mesh penalty scale
+     * 
+     * @return array view of the per-face kinematic penalty stiffness
+     */
+    TRIBOL_HOST_DEVICE const Array1DView<RealT>& getFacePenaltyStiffness() const
+    {
+      return m_face_penalty_stiffness;
+    }
+
+    /**
+     * @brief Get an array view of the per-face rate penalty coefficients
+     *
+     * @note Entries hold the rate penalty stiffness for RATE_CONSTANT and the
+     * rate percent for RATE_PERCENT
+     * 
+     * @return array view of the per-face rate penalty coefficients
+     */
+    TRIBOL_HOST_DEVICE const Array1DView<RealT>& getFaceRatePenalty() const
+    {
+      return m_face_rate_penalty;
+    }
+
+    /**
+     * @brief Is the mesh an analytic rigid surface?
+     * 
+     * @return true if the mesh describes a rigid surface; false otherwise
+     */
+    TRIBOL_HOST_DEVICE bool isRigidSurface() const { return m_is_rigid; }
+
+    /**
+     * @brief Get the analytic rigid surface description
+     * 
+     * @return rigid surface (only meaningful if isRigidSurface() is true)
+     */
+    TRIBOL_HOST_DEVICE const RigidSurface& getRigidSurface() const { return m_rigid_surface; }
+
     /**
      * @brief Get an array view of the element connectivity
      * 
@@ -356,6 +421,9 @@ public:
     * \param [in] face_id integer id of face
     * \param [in/out] coords pointer to an array of stacked (x,y,z) nodal coordinates
     *
+    * \note Reads the face-major coordinate cache if computeFaceData() has been
+    * called; otherwise gathers from the nodal arrays.
+    *
     */
     TRIBOL_HOST_DEVICE void getFaceCoords( IndexT face_id, RealT* coords ) const;
 
@@ -366,6 +434,9 @@ public:
     * \param [in] face_id integer id of face
     * \param [in/out] nodalVel pointer to an array of stacked (x,y,z) nodal velocities
     *
+    * \note Reads the face-major velocity cache if computeFaceData() has been
+    * called; otherwise gathers from the nodal arrays.
+    *
     */
     TRIBOL_HOST_DEVICE void getFaceVelocities( IndexT face_id, RealT* vels ) const;
 
@@ -395,17 +466,17 @@ public:
     /// Umpire allocator ID of the memory space (0 if no Umpire)
     const int m_allocator_id;
 
-    /// Array of views of nodal position data
-    const MultiViewArrayView<const RealT> m_position;
+    /// Views of nodal position components
+    const VectorFieldView<const RealT> m_position;
     
-    /// Array of views of nodal displacement data
-    const MultiViewArrayView<const RealT> m_disp;
+    /// Views of nodal displacement components
+    const VectorFieldView<const RealT> m_disp;
 
-    /// Array of views of nodal velocity data
-    const MultiViewArrayView<const RealT> m_vel;
+    /// Views of nodal velocity components
+    const VectorFieldView<const RealT> m_vel;
 
-    /// Array of views of nodal response data
-    const MultiViewArrayView<RealT> m_response;
+    /// Views of nodal response components
+    const VectorFieldView<RealT> m_response;
 
     /// Array view of 2D nodal normal data
     const Array2DView<RealT> m_node_n;
@@ -424,6 +495,24 @@ public:
 
     /// Array view of element area data
     const ArrayViewT<RealT> m_area;
+
+    /// Array view of per-face kinematic penalty stiffness data
+    const ArrayViewT<RealT> m_face_penalty_stiffness;
+
+    /// Array view of per-face rate penalty coefficient data
+    const ArrayViewT<RealT> m_face_rate_penalty;
+
+    /// Array view of face-major nodal coordinates
+    const Array2DView<const RealT> m_face_x;
+
+    /// Array view of face-major nodal velocities
+    const Array2DView<const RealT> m_face_v;
+
+    /// True if the mesh is an analytic rigid surface
+    const bool m_is_rigid;
+
+    /// Analytic rigid surface description
+    const RigidSurface m_rigid_surface;
     
     MeshNodalData m_nodal_fields; ///< method specific nodal fields
     MeshElemData  m_element_data; ///< method/enforcement specific element data
@@ -576,6 +665,19 @@ public:
                     const RealT* y,
                     const RealT* z );
 
+  /**
+   * @brief Set the pointer and strides of interleaved or blocked nodal 
+   * position data
+   *
+   * Component d of node i is data[i*node_stride + d*component_stride], e.g.
+   * node_stride = dim and component_stride = 1 for xyzxyz... data.
+   * 
+   * @param data pointer to the nodal position data
+   * @param node_stride distance between consecutive nodes
+   * @param component_stride distance between consecutive components
+   */
+  void setPosition( const RealT* data, IndexT node_stride, IndexT component_stride );
+
   /**
    * @brief Set the pointers to the nodal displacement data
    * 
@@ -587,6 +689,16 @@ public:
                         const RealT* uy,
                         const RealT* uz );
 
+  /**
+   * @brief Set the pointer and strides of interleaved or blocked nodal 
+   * displacement data
+   * 
+   * @param data pointer to the nodal displacement data
+   * @param node_stride distance between consecutive nodes
+   * @param component_stride distance between consecutive components
+   */
+  void setDisplacement( const RealT* data, IndexT node_stride, IndexT component_stride );
+
   /**
    * @brief Set the pointers to the nodal velocity data
    * 
@@ -597,6 +709,16 @@ public:
   void setVelocity( const RealT* vx,
                     const RealT* vy,
                     const RealT* vz );
+
+  /**
+   * @brief Set the pointer and strides of interleaved or blocked nodal 
+   * velocity data
+   * 
+   * @param data pointer to the nodal velocity data
+   * @param node_stride distance between consecutive nodes
+   * @param component_stride distance between consecutive components
+   */
+  void setVelocity( const RealT* data, IndexT node_stride, IndexT component_stride );
   
   /**
    * @brief Is the velocity vector populated?
@@ -606,6 +728,62 @@ public:
    */
   bool hasVelocity() const { return !m_vel.empty(); }
 
+  /**
+   * @brief Marks the mesh as an analytic rigid surface
+   *
+   * A rigid surface mesh has no elements or nodal data. It may only be used as
+   * the second mesh of a coupling scheme.
+   * 
+   * @param surface analytic description of the surface
+   */
+  void setRigidSurface( const RigidSurface& surface )
+  {
+    m_rigid_surface = surface;
+    m_is_rigid = true;
+  }
+
+  /**
+   * @brief Is the mesh an analytic rigid surface?
+   * 
+   * @return true if the mesh describes a rigid surface; false otherwise
+   */
+  bool isRigidSurface() const { return m_is_rigid; }
+
+  /**
+   * @brief Get the analytic rigid surface description
+   * 
+   * @return rigid surface (only meaningful if isRigidSurface() is true)
+   */
+  RigidSurface& getRigidSurface() { return m_rigid_surface; }
+
+  /**
+   * @brief Set a length added to each face radius computed in computeFaceData()
+   *
+   * Used when the nodal coordinates are only known to within a rounding bound,
+   * e.g. reduced-precision ghost coordinates, so that the proximity checks of
+   * the search stay conservative.
+   * 
+   * @param inflation non-negative face radius inflation
+   */
+  void setFaceRadiusInflation( RealT inflation ) { m_face_radius_inflation = inflation; }
+
+  /**
+   * @brief Get the length added to each face radius
+   * 
+   * @return face radius inflation
+   */
+  RealT getFaceRadiusInflation() const { return m_face_radius_inflation; }
+
+  /**
+   * @brief Transfers ownership of the element connectivity to the mesh
+   *
+   * This is used for connectivity created by Tribol, e.g. surfaces extracted
+   * from volume meshes, which have no host-code owner.
+   * 
+   * @param connectivity element connectivity (one row per element)
+   */
+  void setOwnedConnectivity( Array2D<IndexT>&& connectivity );
+
   /**
    * @brief Set the pointers to the nodal response data
    * 
@@ -615,6 +793,16 @@ public:
    */
   void setResponse( RealT* rx, RealT* ry, RealT* rz );
 
+  /**
+   * @brief Set the pointer and strides of interleaved or blocked nodal 
+   * response data
+   * 
+   * @param data pointer to the nodal response data
+   * @param node_stride distance between consecutive nodes
+   * @param component_stride distance between consecutive components
+   */
+  void setResponse( RealT* data, IndexT node_stride, IndexT component_stride );
+
   /**
    * @brief Construct a non-owned, shallow copy of the MeshData
    * 
@@ -641,12 +829,29 @@ private:
    * @param x pointer to array of x-components
    * @param y pointer to array of y-components
    * @param z pointer to array of z-components
-   * @return Array of array views of vector components
+   * @param node_stride distance between the components of consecutive nodes
+   * @return Views of vector components
+   */
+  template <typename T>
+  VectorFieldView<T> createNodalVector( T* x, 
+                                        T* y,
+                                        T* z,
+                                        IndexT node_stride = 1 ) const;
+
+  /**
+   * @brief Converts a pointer to interleaved or blocked vector data to views of
+   * the vector components
+   * 
+   * @tparam T underlying type of the components
+   * @param data pointer to the vector data
+   * @param node_stride distance between consecutive nodes
+   * @param component_stride distance between consecutive components
+   * @return Views of vector components
    */
   template <typename T>
-  MultiArrayView<T> createNodalVector( T* x, 
-                                       T* y,
-                                       T* z ) const;
+  VectorFieldView<T> createStridedNodalVector( T* data,
+                                               IndexT node_stride,
+                                               IndexT component_stride ) const;
 
   /**
    * @brief Converts pointer to element connectivity to an array view
@@ -672,21 +877,32 @@ private:
   MeshElemData  m_element_data;        ///< method/enforcement specific element data
 
   // Nodal field data
-  MultiArrayView<const RealT> m_position; ///< Coordinates of nodes in mesh
-  MultiArrayView<const RealT> m_disp;     ///< Nodal displacements
-  MultiArrayView<const RealT> m_vel;      ///< Nodal velocity
-  MultiArrayView<RealT> m_response;       ///< Nodal responses (forces)
+  VectorFieldView<const RealT> m_position; ///< Coordinates of nodes in mesh
+  VectorFieldView<const RealT> m_disp;     ///< Nodal displacements
+  VectorFieldView<const RealT> m_vel;      ///< Nodal velocity
+  VectorFieldView<RealT> m_response;       ///< Nodal responses (forces)
 
   Array2D<RealT> m_node_n;             ///< Outward unit node normals
 
   // Element field data
   Array2DView<const IndexT> m_connectivity;  ///< Element connectivity arrays
+  Array2D<IndexT> m_owned_connectivity;      ///< Element connectivity owned by the mesh (if any)
 
   Array2D<RealT> m_c;           ///< Vertex averaged element centroids
   Array2D<RealT> m_n;           ///< Outward unit element normals
   Array1D<RealT> m_face_radius; ///< Face radius used in low level proximity check
+  RealT m_face_radius_inflation {0.}; ///< Length added to each face radius
   Array1D<RealT> m_area;        ///< Element areas
 
+  Array1D<RealT> m_face_penalty_stiffness; ///< Scaled kinematic penalty stiffness per face
+  Array1D<RealT> m_face_rate_penalty;      ///< Rate penalty coefficient per face
+
+  Array2D<RealT> m_face_x; ///< Stacked (x,y,z) nodal coordinates of each face (one row per face)
+  Array2D<RealT> m_face_v; ///< Stacked (x,y,z) nodal velocities of each face (one row per face)
+
+  bool m_is_rigid {false};       ///< True if the mesh is an analytic rigid surface
+  RigidSurface m_rigid_surface;  ///< Analytic rigid surface description
+
 public:
 
   /*!
@@ -711,6 +927,35 @@ public:
   * This routine accounts for warped faces by computing an average normal.
   */
   bool computeFaceData(ExecutionMode exec_mode);
+
+  /*!
+  * \brief Gathers the nodal coordinates (and velocities, if registered) of
+  *        each face into face-major arrays
+  *
+  * \param [in] exec_mode defines where loops should be executed
+  *
+  * Row i holds the stacked (x,y,z) values of the nodes of face i, so kernels
+  * looping over faces or face-pairs read one contiguous block per face
+  * instead of gathering through the connectivity. This is called by 
+  * computeFaceData() once per update.
+  */
+  void computeFaceCoords(ExecutionMode exec_mode);
+
+  /*!
+  * \brief Computes the per-face kinematic penalty stiffness and rate penalty
+  *        coefficients used by common plane penalty enforcement
+  *
+  * \param [in] pen_options penalty enforcement options
+  * \param [in] exec_mode defines where loops should be executed
+  * \return true if no negative element thicknesses are encountered
+  *
+  * This routine folds the penalty calculation options and the mesh penalty
+  * scale into compact per-face arrays so the enforcement kernel only gathers
+  * face values. It should be called once per update after the penalty data
+  * has been checked.
+  */
+  bool computePenaltyData( const PenaltyEnforcementOptions& pen_options,
+                           ExecutionMode exec_mode );
   
   /*!
   * \brief Computes average nodal normals for use with mortar methods
@@ -739,16 +984,26 @@ public:
 
 //------------------------------------------------------------------------------
 template <typename T>
-MultiArrayView<T> MeshData::createNodalVector( T* x, T* y, T* z ) const
+VectorFieldView<T> MeshData::createNodalVector( T* x, T* y, T* z, IndexT node_stride ) const
+{
+  return VectorFieldView<T>( m_dim,
+                             StridedArrayView<T>(x, m_num_nodes, node_stride),
+                             StridedArrayView<T>(y, m_num_nodes, node_stride),
+                             StridedArrayView<T>(m_dim == 3 ? z : nullptr, m_num_nodes, node_stride) );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+VectorFieldView<T> MeshData::createStridedNodalVector( T* data,
+                                                       IndexT node_stride,
+                                                       IndexT component_stride ) const
 {
-  MultiArrayView<T> host_nodal_vector(m_dim, m_dim);
-  host_nodal_vector[0] = ArrayViewT<T>(x, m_num_nodes);
-  host_nodal_vector[1] = ArrayViewT<T>(y, m_num_nodes);
-  if (m_dim == 3)
+  if (data == nullptr)
   {
-    host_nodal_vector[2] = ArrayViewT<T>(z, m_num_nodes);
+    return createNodalVector<T>( nullptr, nullptr, nullptr, node_stride );
   }
-  return MultiArrayView<T>(host_nodal_vector, m_allocator_id);
+  return createNodalVector( data, data + component_stride, 
+                            m_dim == 3 ? data + 2*component_stride : nullptr, node_stride );
 }
 
 using MeshManager = DataManager<MeshData>;
@@ -8,6 +8,8 @@
 
 #ifdef BUILD_REDECOMP
 
+#include <cmath>
+
 #include "axom/slic.hpp"
 
 namespace tribol
@@ -68,14 +70,20 @@ std::unique_ptr<mfem::ParGridFunction> SubmeshLORTransfer::CreateLORGridFunction
 SubmeshRedecompTransfer::SubmeshRedecompTransfer(
   mfem::ParFiniteElementSpace& submesh_fes,
   SubmeshLORTransfer* submesh_lor_xfer,
-  redecomp::RedecompMesh& redecomp_mesh
+  redecomp::RedecompMesh& redecomp_mesh,
+  bool reduced_ghosts
 )
 : submesh_fes_ { submesh_fes },
   redecomp_fes_ { submesh_lor_xfer ?
     CreateRedecompFESpace(redecomp_mesh, *submesh_lor_xfer->GetLORGridFn().ParFESpace()) :
     CreateRedecompFESpace(redecomp_mesh, submesh_fes_) },
   submesh_lor_xfer_ { submesh_lor_xfer },
-  redecomp_xfer_ { } // default (element transfer) constructor
+  redecomp_xfer_ { }, // default (element transfer) constructor
+  ghost_xfer_ { reduced_ghosts ?
+    std::make_unique<const redecomp::TransferByNodes>(
+      submesh_lor_xfer ? *submesh_lor_xfer->GetLORGridFn().ParFESpace() : submesh_fes_,
+      *redecomp_fes_
+    ) : nullptr }
 {
   // make sure submesh_fes is a submesh and redecomp's parent is submesh_fes's
   // submesh
@@ -107,12 +115,36 @@ void SubmeshRedecompTransfer::SubmeshToRedecomp(
     submesh_lor_xfer_->TransferToLORGridFn(submesh_src);
     src_ptr = &submesh_lor_xfer_->GetLORGridFn();
   }
+  if (ghost_xfer_)
+  {
+    ghost_xfer_->TransferToSerialReducedGhosts(*src_ptr, redecomp_dst);
+    return;
+  }
   redecomp_xfer_.TransferToSerial(*src_ptr, redecomp_dst);
 }
 
+void SubmeshRedecompTransfer::SubmeshGhostElemsToRedecomp(
+  const mfem::ParGridFunction& submesh_src,
+  mfem::GridFunction& redecomp_dst,
+  const axom::Array<int>& redecomp_elems
+) const
+{
+  SLIC_ERROR_ROOT_IF(!ghost_xfer_, 
+    "Exact ghost values require a SubmeshRedecompTransfer with reduced_ghosts = true.");
+  auto src_ptr = &submesh_src;
+  if (submesh_lor_xfer_)
+  {
+    submesh_lor_xfer_->GetLORGridFn() = 0.0;
+    submesh_lor_xfer_->TransferToLORGridFn(submesh_src);
+    src_ptr = &submesh_lor_xfer_->GetLORGridFn();
+  }
+  ghost_xfer_->TransferGhostElemsToSerial(*src_ptr, redecomp_dst, redecomp_elems);
+}
+
 void SubmeshRedecompTransfer::RedecompToSubmesh(
   const mfem::GridFunction& redecomp_src,
-  mfem::Vector& submesh_dst
+  mfem::Vector& submesh_dst,
+  bool accumulate
 ) const
 {
   auto dst_ptr = &submesh_dst;
@@ -126,6 +158,17 @@ void SubmeshRedecompTransfer::RedecompToSubmesh(
   }
   // transfer data from redecomp mesh
   mfem::ParGridFunction dst_gridfn(dst_fespace_ptr, *dst_ptr);
+  if (accumulate)
+  {
+    // each redecomp contribution is added on one rank only, so the sum of shared dof values already equals the
+    // actual dof value
+    redecomp_xfer_.AccumulateToParallel(redecomp_src, dst_gridfn);
+    if (submesh_lor_xfer_)
+    {
+      submesh_lor_xfer_->TransferFromLORVector(submesh_dst);
+    }
+    return;
+  }
   redecomp_xfer_.TransferToParallel(redecomp_src, dst_gridfn);
 
   // using redecomp, shared dof values are set equal (i.e. a ParGridFunction), but we want the sum of shared dof values
@@ -171,14 +214,16 @@ ParentRedecompTransfer::ParentRedecompTransfer(
   const mfem::ParFiniteElementSpace& parent_fes,
   mfem::ParGridFunction& submesh_gridfn,
   SubmeshLORTransfer* submesh_lor_xfer,
-  redecomp::RedecompMesh& redecomp_mesh
+  redecomp::RedecompMesh& redecomp_mesh,
+  bool reduced_ghosts
 )
 : parent_fes_ { parent_fes },
   submesh_gridfn_ { submesh_gridfn },
   submesh_redecomp_xfer_ { 
     *submesh_gridfn_.ParFESpace(),
     submesh_lor_xfer, 
-    redecomp_mesh
+    redecomp_mesh,
+    reduced_ghosts
   }
 {
   // Note: this is checked in the SubmeshRedecompTransfer constructor
@@ -202,13 +247,25 @@ void ParentRedecompTransfer::ParentToRedecomp(
   submesh_redecomp_xfer_.SubmeshToRedecomp(submesh_gridfn_, redecomp_dst);
 }
 
+void ParentRedecompTransfer::ParentGhostElemsToRedecomp(
+  const mfem::ParGridFunction& parent_src,
+  mfem::GridFunction& redecomp_dst,
+  const axom::Array<int>& redecomp_elems
+) const
+{
+  submesh_gridfn_ = 0.0;
+  submesh_redecomp_xfer_.GetSubmesh().Transfer(parent_src, submesh_gridfn_);
+  submesh_redecomp_xfer_.SubmeshGhostElemsToRedecomp(submesh_gridfn_, redecomp_dst, redecomp_elems);
+}
+
 void ParentRedecompTransfer::RedecompToParent(
   const mfem::GridFunction& redecomp_src,
-  mfem::Vector& parent_dst
+  mfem::Vector& parent_dst,
+  bool accumulate
 ) const
 {
   submesh_gridfn_ = 0.0;
-  submesh_redecomp_xfer_.RedecompToSubmesh(redecomp_src, submesh_gridfn_);
+  submesh_redecomp_xfer_.RedecompToSubmesh(redecomp_src, submesh_gridfn_, accumulate);
   // submesh transfer requires a grid function.  create one using parent_dst's data
   mfem::ParGridFunction parent_gridfn(&parent_fes_, parent_dst);
   submesh_redecomp_xfer_.GetSubmesh().Transfer(submesh_gridfn_, parent_gridfn);
@@ -231,6 +288,13 @@ void ParentField::UpdateField(ParentRedecompTransfer& parent_redecomp_xfer)
   update_data_ = std::make_unique<UpdateData>(parent_redecomp_xfer, parent_gridfn_);
 }
 
+void ParentField::UpdateGhostElems(const axom::Array<int>& redecomp_elems)
+{
+  auto& update_data = GetUpdateData();
+  update_data.parent_redecomp_xfer_.ParentGhostElemsToRedecomp(
+    parent_gridfn_, update_data.redecomp_gridfn_, redecomp_elems);
+}
+
 std::vector<const RealT*> ParentField::GetRedecompFieldPtrs() const
 {
   auto data_ptrs = std::vector<const RealT*>(3, nullptr);
@@ -425,7 +489,8 @@ void MfemMeshData::UpdateMfemMeshData()
     submesh_xfer_gridfn_,
     submesh_lor_xfer_.get(),
     attributes_1_, 
-    attributes_2_
+    attributes_2_,
+    reduced_ghost_precision_
   );
   coords_.UpdateField(update_data_->vector_xfer_);
   redecomp_response_.SetSpace(coords_.GetRedecompGridFn().FESpace());
@@ -495,7 +560,53 @@ void MfemMeshData::UpdateMfemMeshData()
 
 void MfemMeshData::GetParentResponse(mfem::Vector& r) const
 {
-  GetParentRedecompTransfer().RedecompToParent(redecomp_response_, r);
+  GetParentRedecompTransfer().RedecompToParent(redecomp_response_, r, ghost_pair_ownership_);
+}
+
+RealT MfemMeshData::GetGhostRadiusInflation() const
+{
+  if (!reduced_ghost_precision_)
+  {
+    return 0.0;
+  }
+  // each rounded coordinate is off by at most delta, so a node or a vertex
+  // averaged centroid moves by at most sqrt(dim) * delta and a face radius 
+  // changes by at most twice that. Inflating each radius by 2 * sqrt(dim) * delta
+  // and again by the centroid motion keeps the box and radius checks of the
+  // search conservative.
+  const auto& coords = coords_.GetRedecompGridFn();
+  const RealT delta = redecomp::TransferByNodes::GhostRoundingBound(coords.Normlinf());
+  return 3.0 * std::sqrt(static_cast<RealT>(coords.FESpace()->GetVDim())) * delta;
+}
+
+void MfemMeshData::UpdateExactGhostData(const ArrayT<InterfacePair>& pairs)
+{
+  // gather the redecomp elements of the ghost faces in the pairs
+  ArrayT<InterfacePair, 1, MemorySpace::Host> pairs_host(pairs);
+  const auto& update_data = GetUpdateData();
+  std::set<int> ghost_elems;
+  for (const auto& pair : pairs_host)
+  {
+    if (update_data.ghost_faces_1_[pair.m_element_id1])
+    {
+      ghost_elems.insert(update_data.elem_map_1_[static_cast<size_t>(pair.m_element_id1)]);
+    }
+    if (update_data.ghost_faces_2_[pair.m_element_id2])
+    {
+      ghost_elems.insert(update_data.elem_map_2_[static_cast<size_t>(pair.m_element_id2)]);
+    }
+  }
+  axom::Array<int> redecomp_elems(0, static_cast<axom::IndexType>(ghost_elems.size()));
+  for (auto e : ghost_elems)
+  {
+    redecomp_elems.push_back(e);
+  }
+
+  coords_.UpdateGhostElems(redecomp_elems);
+  if (velocity_)
+  {
+    velocity_->UpdateGhostElems(redecomp_elems);
+  }
 }
 
 void MfemMeshData::SetParentVelocity(const mfem::ParGridFunction& velocity)
@@ -660,18 +771,21 @@ MfemMeshData::UpdateData::UpdateData(
   mfem::ParGridFunction& submesh_gridfn,
   SubmeshLORTransfer* submesh_lor_xfer,
   const std::set<int>& attributes_1,
-  const std::set<int>& attributes_2
+  const std::set<int>& attributes_2,
+  bool reduced_ghosts
 )
 : redecomp_mesh_ { lor_mesh ? 
     redecomp::RedecompMesh(*lor_mesh) :
     redecomp::RedecompMesh(submesh)
   },
-  vector_xfer_ { parent_fes, submesh_gridfn, submesh_lor_xfer, redecomp_mesh_ }
+  vector_xfer_ { parent_fes, submesh_gridfn, submesh_lor_xfer, redecomp_mesh_, reduced_ghosts }
 {
   // set element type based on redecomp mesh
   SetElementData();
   // updates the connectivity of the tribol surface mesh
   UpdateConnectivity(attributes_1, attributes_2);
+  // updates the parallel ownership of the tribol surface mesh elements
+  UpdateFaceOwnership(lor_mesh ? *lor_mesh : submesh);
 }
 
 void MfemMeshData::UpdateData::UpdateConnectivity(
@@ -721,6 +835,53 @@ void MfemMeshData::UpdateData::UpdateConnectivity(
   elem_map_2_.shrink_to_fit();
 }
 
+void MfemMeshData::UpdateData::UpdateFaceOwnership(mfem::ParMesh& redecomp_parent)
+{
+  // transfer the global element ids of the redecomp parent mesh to the redecomp mesh. element ids are stored as
+  // doubles, which are exact for ids below 2^53.
+  mfem::QuadratureFunction parent_ids(new mfem::QuadratureSpace(&redecomp_parent, 0));
+  parent_ids.SetOwnsSpace(true);
+  for (int e{0}; e < redecomp_parent.GetNE(); ++e)
+  {
+    mfem::Vector quad_val;
+    parent_ids.GetValues(e, quad_val);
+    quad_val[0] = static_cast<double>(redecomp_parent.GetGlobalElementNum(e));
+  }
+  mfem::QuadratureFunction redecomp_ids(new mfem::QuadratureSpace(&redecomp_mesh_, 0));
+  redecomp_ids.SetOwnsSpace(true);
+  redecomp_ids = -1.0;
+  redecomp::RedecompTransfer redecomp_xfer;
+  redecomp_xfer.TransferToSerial(parent_ids, redecomp_ids);
+
+  // mark redecomp ghost elements. ghost elements are sorted by parent rank.
+  std::vector<bool> is_ghost(static_cast<size_t>(redecomp_mesh_.GetNE()), false);
+  const auto& ghost_elems = redecomp_mesh_.getRedecompToParentGhostElems();
+  for (int r{0}; r < redecomp_mesh_.getMPIUtility().NRanks(); ++r)
+  {
+    for (auto e : ghost_elems[r])
+    {
+      is_ghost[static_cast<size_t>(e)] = true;
+    }
+  }
+
+  auto fill_ownership = [&redecomp_ids, &is_ghost](
+    const std::vector<int>& elem_map, ArrayT<IndexT>& global_ids, ArrayT<bool>& ghost_faces)
+  {
+    // keep at least one entry so data() is a valid pointer
+    global_ids = ArrayT<IndexT>(0, elem_map.empty() ? 1 : elem_map.size());
+    ghost_faces = ArrayT<bool>(0, elem_map.empty() ? 1 : elem_map.size());
+    for (auto redecomp_e : elem_map)
+    {
+      mfem::Vector quad_val;
+      redecomp_ids.GetValues(redecomp_e, quad_val);
+      global_ids.push_back(static_cast<IndexT>(quad_val[0]));
+      ghost_faces.push_back(is_ghost[static_cast<size_t>(redecomp_e)]);
+    }
+  };
+  fill_ownership(elem_map_1_, global_face_ids_1_, ghost_faces_1_);
+  fill_ownership(elem_map_2_, global_face_ids_2_, ghost_faces_2_);
+}
+
 MfemMeshData::UpdateData& MfemMeshData::GetUpdateData()
 {
   SLIC_ERROR_ROOT_IF(
@@ -1007,18 +1168,21 @@ std::unique_ptr<mfem::BlockOperator> MfemJacobianData::GetMfemBlockJacobian(
       static_cast<int>(BlockSpace::NONMORTAR)
     );
   }
-  // move to submesh level
+  // combine the mortar and nonmortar contributions so both are moved with a
+  // single transfer (and a single cached transfer pattern)
+  auto test_elems = ArrayT<int>(0, 2 * lm_elems.size());
+  test_elems.append(lm_elems.view());
+  test_elems.append(lm_elems.view());
+  auto trial_elems = ArrayT<int>(0, mortar_elems.size() + nonmortar_elems.size());
+  trial_elems.append(mortar_elems.view());
+  trial_elems.append(nonmortar_elems.view());
+  // move to submesh level.  the element Jacobians are passed in place (the 
+  // element index lists cover the mortar then the nonmortar contributions)
   auto submesh_J = GetUpdateData().submesh_redecomp_xfer_->TransferToParallelSparse(
-    lm_elems, 
-    mortar_elems, 
-    *elem_J_1
-  );
-  submesh_J += GetUpdateData().submesh_redecomp_xfer_->TransferToParallelSparse(
-    lm_elems, 
-    nonmortar_elems, 
-    *elem_J_2
+    test_elems, 
+    trial_elems, 
+    {elem_J_1, elem_J_2}
   );
-  submesh_J.Finalize();
 
   // transform J values from submesh to parent mesh
   auto J = submesh_J.GetJ();
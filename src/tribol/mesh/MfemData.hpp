@@ -17,8 +17,10 @@
 
 #include "axom/core.hpp"
 #include "redecomp/redecomp.hpp"
+#include "redecomp/transfer/TransferByNodes.hpp"
 
 #include "tribol/common/Parameters.hpp"
+#include "tribol/mesh/InterfacePairs.hpp"
 #include "tribol/mesh/MethodCouplingData.hpp"
 
 namespace tribol
@@ -166,11 +168,14 @@ public:
    * @param submesh_lor_xfer Submesh to LOR grid function transfer object (if
    * using LOR; nullptr otherwise)
    * @param redecomp_mesh RedecompMesh of the redecomposed contact surface mesh
+   * @param reduced_ghosts Send values on ghost-only nodes in single precision
+   * in SubmeshToRedecomp() (see SubmeshGhostElemsToRedecomp())
    */
   SubmeshRedecompTransfer(
     mfem::ParFiniteElementSpace& submesh_fes,
     SubmeshLORTransfer* submesh_lor_xfer,
-    redecomp::RedecompMesh& redecomp_mesh
+    redecomp::RedecompMesh& redecomp_mesh,
+    bool reduced_ghosts = false
   );
 
   /**
@@ -185,6 +190,31 @@ public:
     mfem::GridFunction& redecomp_dst
   ) const;
 
+  /**
+   * @brief Transfer exact grid function values on the ghost-only nodes of the
+   * given redecomp elements from the parent-linked boundary submesh
+   *
+   * @note This method is collective; ranks without elements to update must
+   * call it with an empty list.
+   *
+   * @pre The transfer object was constructed with reduced_ghosts = true
+   *
+   * @param [in] submesh_src Grid function on parent-linked boundary submesh
+   * @param [in,out] redecomp_dst Grid function on redecomp mesh
+   * @param [in] redecomp_elems Redecomp elements whose exact values are needed
+   */
+  void SubmeshGhostElemsToRedecomp(
+    const mfem::ParGridFunction& submesh_src,
+    mfem::GridFunction& redecomp_dst,
+    const axom::Array<int>& redecomp_elems
+  ) const;
+
+  /**
+   * @brief Returns true if values on ghost-only nodes are sent in single
+   * precision by SubmeshToRedecomp()
+   */
+  bool HasReducedGhosts() const { return ghost_xfer_ != nullptr; }
+
   /**
    * @brief Transfer grid function on redecomp mesh to vector on parent-linked boundary submesh
    *
@@ -192,12 +222,17 @@ public:
    * parallel summation for shared DOF values to be equal.  This arrangement of DOF values is in line with dual vectors
    * in MFEM.
    *
+   * @note If accumulate is true, the redecomp_src GridFunction instead holds a partial contribution on each redecomp
+   * rank (including on ghost elements), and the contributions of all redecomp ranks are summed.
+   *
    * @param redecomp_src Grid function on redecomp mesh
    * @param submesh_dst Zero-valued vector on parent-linked boundary submesh
+   * @param accumulate Sum partial redecomp contributions instead of copying complete values
    */
   void RedecompToSubmesh(
     const mfem::GridFunction& redecomp_src,
-    mfem::Vector& submesh_dst
+    mfem::Vector& submesh_dst,
+    bool accumulate = false
   ) const;
 
   /**
@@ -256,6 +291,12 @@ private:
    * mesh
    */
   const redecomp::RedecompTransfer redecomp_xfer_;
+
+  /**
+   * @brief Node-based transfer object sending values on ghost-only nodes in
+   * single precision (if reduced_ghosts is true; nullptr otherwise)
+   */
+  std::unique_ptr<const redecomp::TransferByNodes> ghost_xfer_;
 };
 
 /**
@@ -284,12 +325,15 @@ public:
    * @param submesh_lor_xfer Submesh to LOR grid function transfer object (if
    * using LOR; nullptr otherwise)
    * @param redecomp_mesh RedecompMesh of the redecomposed contact surface mesh
+   * @param reduced_ghosts Send values on ghost-only nodes in single precision
+   * in ParentToRedecomp() (see ParentGhostElemsToRedecomp())
    */
   ParentRedecompTransfer(
     const mfem::ParFiniteElementSpace& parent_fes,
     mfem::ParGridFunction& submesh_gridfn,
     SubmeshLORTransfer* submesh_lor_xfer,
-    redecomp::RedecompMesh& redecomp_mesh
+    redecomp::RedecompMesh& redecomp_mesh,
+    bool reduced_ghosts = false
   );
 
   /**
@@ -303,6 +347,23 @@ public:
     const mfem::ParGridFunction& parent_src,
     mfem::GridFunction& redecomp_dst
   ) const;
+
+  /**
+   * @brief Transfer exact grid function values on the ghost-only nodes of the
+   * given redecomp elements from the parent mesh
+   *
+   * @note This method is collective; ranks without elements to update must
+   * call it with an empty list.
+   *
+   * @param [in] parent_src Grid function on parent mesh
+   * @param [in,out] redecomp_dst Grid function on redecomp mesh
+   * @param [in] redecomp_elems Redecomp elements whose exact values are needed
+   */
+  void ParentGhostElemsToRedecomp(
+    const mfem::ParGridFunction& parent_src,
+    mfem::GridFunction& redecomp_dst,
+    const axom::Array<int>& redecomp_elems
+  ) const;
   
   /**
    * @brief Transfer grid function on redecomp mesh to vector on parent mesh
@@ -313,8 +374,13 @@ public:
    *
    * @param [in] redecomp_src Grid function on RedecompMesh
    * @param [out] parent_dst Zero-valued vector on parent mesh
+   * @param [in] accumulate Sum partial redecomp contributions (see SubmeshRedecompTransfer::RedecompToSubmesh())
    */
-  void RedecompToParent(const mfem::GridFunction& redecomp_src, mfem::Vector& parent_dst) const;
+  void RedecompToParent(
+    const mfem::GridFunction& redecomp_src,
+    mfem::Vector& parent_dst,
+    bool accumulate = false
+  ) const;
 
   /**
    * @brief Get the parent-linked boundary submesh finite element space
@@ -389,6 +455,17 @@ public:
    */
   void UpdateField(ParentRedecompTransfer& parent_redecomp_xfer);
 
+  /**
+   * @brief Replace the values on the ghost-only nodes of the given redecomp
+   * elements with exact values from the parent mesh
+   *
+   * @note This method is collective (see
+   * ParentRedecompTransfer::ParentGhostElemsToRedecomp())
+   *
+   * @param redecomp_elems Redecomp elements whose exact values are needed
+   */
+  void UpdateGhostElems(const axom::Array<int>& redecomp_elems);
+
   /**
    * @brief Get the parent grid function
    * 
@@ -796,6 +873,95 @@ public:
    */
   void GetParentResponse(mfem::Vector& r) const;
 
+  /**
+   * @brief Enable or disable exactly-once evaluation of face-pairs across ghost boundaries
+   *
+   * If enabled, face ownership is registered with the Tribol meshes so each face-pair is only evaluated on the rank
+   * owning the face with the lower global id, and the partial nodal responses on each redecomp rank (including ghost
+   * nodes) are summed in GetParentResponse().
+   *
+   * @param ghost_pair_ownership True to evaluate each face-pair on one rank
+   */
+  void SetGhostPairOwnership(bool ghost_pair_ownership) { ghost_pair_ownership_ = ghost_pair_ownership; }
+
+  /**
+   * @brief Returns true if each face-pair is evaluated on one rank only
+   */
+  bool HasGhostPairOwnership() const { return ghost_pair_ownership_; }
+
+  /**
+   * @brief Enable or disable single precision transfer of vector field values
+   * on ghost-only nodes
+   *
+   * If enabled, UpdateMfemMeshData() sends coordinates and velocities on nodes
+   * that only belong to ghost elements as float. The search runs on these
+   * values with face radii inflated by GetGhostRadiusInflation(), and
+   * UpdateExactGhostData() then fetches exact values for the ghost faces of
+   * the candidate pairs before the contact geometry is computed.
+   *
+   * @param reduced_ghost_precision True to send ghost-only values as float
+   *
+   * @note Takes effect on the next call to UpdateMfemMeshData()
+   */
+  void SetReducedGhostPrecision(bool reduced_ghost_precision)
+  {
+    reduced_ghost_precision_ = reduced_ghost_precision;
+  }
+
+  /**
+   * @brief Returns true if vector field values on ghost-only nodes are sent in
+   * single precision
+   */
+  bool HasReducedGhostPrecision() const { return reduced_ghost_precision_; }
+
+  /**
+   * @brief Returns a bound on the change of a face radius, plus the change of
+   * the face centroid, caused by rounding the ghost-only coordinates
+   *
+   * @return Face radius inflation making the search conservative (0 if ghost
+   * values are sent exactly)
+   */
+  RealT GetGhostRadiusInflation() const;
+
+  /**
+   * @brief Fetches exact coordinates (and velocities, if set) on the
+   * ghost-only nodes of the ghost faces in the given interface pairs
+   *
+   * @note This method is collective; ranks without pairs must call it with an
+   * empty array.
+   *
+   * @param pairs Interface pairs of the Tribol registered meshes
+   */
+  void UpdateExactGhostData(const ArrayT<InterfacePair>& pairs);
+
+  /**
+   * @brief Get the global face ids of the first Tribol registered mesh
+   *
+   * @return const IndexT* 
+   */
+  const IndexT* GetMesh1GlobalFaceIds() const { return GetUpdateData().global_face_ids_1_.data(); }
+
+  /**
+   * @brief Get the global face ids of the second Tribol registered mesh
+   *
+   * @return const IndexT* 
+   */
+  const IndexT* GetMesh2GlobalFaceIds() const { return GetUpdateData().global_face_ids_2_.data(); }
+
+  /**
+   * @brief Get the ghost face flags of the first Tribol registered mesh
+   *
+   * @return const bool* 
+   */
+  const bool* GetMesh1GhostFaces() const { return GetUpdateData().ghost_faces_1_.data(); }
+
+  /**
+   * @brief Get the ghost face flags of the second Tribol registered mesh
+   *
+   * @return const bool* 
+   */
+  const bool* GetMesh2GhostFaces() const { return GetUpdateData().ghost_faces_2_.data(); }
+
   /**
    * @brief Get the parent to redecomp grid function transfer object
    * 
@@ -1164,6 +1330,8 @@ private:
      * the first Tribol registered mesh
      * @param attributes_2 Set of boundary attributes identifying elements in
      * the second Tribol registered mesh
+     * @param reduced_ghosts Send vector field values on ghost-only nodes in
+     * single precision
      */
     UpdateData(
       mfem::ParSubMesh& submesh,
@@ -1172,7 +1340,8 @@ private:
       mfem::ParGridFunction& submesh_gridfn,
       SubmeshLORTransfer* submesh_lor_xfer,
       const std::set<int>& attributes_1,
-      const std::set<int>& attributes_2
+      const std::set<int>& attributes_2,
+      bool reduced_ghosts
     );
 
     /**
@@ -1219,6 +1388,26 @@ private:
     */
     int num_verts_per_elem_;
 
+    /**
+     * @brief Global element id of the redecomp parent element for each element of the first Tribol registered mesh
+     */
+    ArrayT<IndexT> global_face_ids_1_;
+
+    /**
+     * @brief Global element id of the redecomp parent element for each element of the second Tribol registered mesh
+     */
+    ArrayT<IndexT> global_face_ids_2_;
+
+    /**
+     * @brief True for each element of the first Tribol registered mesh that is a redecomp ghost element
+     */
+    ArrayT<bool> ghost_faces_1_;
+
+    /**
+     * @brief True for each element of the second Tribol registered mesh that is a redecomp ghost element
+     */
+    ArrayT<bool> ghost_faces_2_;
+
   private:
     /**
      * @brief Builds connectivity arrays and redecomp mesh to Tribol registered
@@ -1234,6 +1423,15 @@ private:
       const std::set<int>& attributes_2
     );
 
+    /**
+     * @brief Builds the global element ids and ghost flags of the elements in the Tribol registered meshes
+     *
+     * @param redecomp_parent Parent mesh of the redecomp mesh (the LOR mesh if using LOR; the submesh otherwise)
+     *
+     * @note Requires the element maps built in UpdateConnectivity()
+     */
+    void UpdateFaceOwnership(mfem::ParMesh& redecomp_parent);
+
     /**
      * @brief Sets the number of vertices per element and the element type for the redecomp mesh
      */
@@ -1333,6 +1531,16 @@ private:
    */
   std::unique_ptr<ParentField> velocity_;
 
+  /**
+   * @brief True if each face-pair is evaluated on the rank owning the face with the lower global id
+   */
+  bool ghost_pair_ownership_ { false };
+
+  /**
+   * @brief True if vector field values on ghost-only nodes are sent in single precision
+   */
+  bool reduced_ghost_precision_ { false };
+
   /**
    * @brief Kinematic constant contact penalty for the first Tribol registered mesh
    */
@@ -0,0 +1,235 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#include "tribol/mesh/PairColoring.hpp"
+#include "tribol/common/LoopExec.hpp"
+
+#include <cstdint>
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+
+namespace tribol
+{
+
+namespace
+{
+
+using MaskT = unsigned long long;
+
+constexpr int num_mask_colors = 64;
+
+// unique, nonzero priority of a pair. a hash of the pair id occupies the upper
+// bits so that neighboring pairs do not form long chains of decreasing
+// priority; the pair id in the lower bits makes the priority unique.
+TRIBOL_HOST_DEVICE inline MaskT pairPriority( IndexT i )
+{
+  std::uint32_t h = static_cast<std::uint32_t>(i);
+  h ^= h >> 16;
+  h *= 0x7feb352dU;
+  h ^= h >> 15;
+  h *= 0x846ca68bU;
+  h ^= h >> 16;
+  return (static_cast<MaskT>(h) << 32) | (static_cast<MaskT>(i) + 1);
+}
+
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+PairColoring computePairColoring( const MeshData::Viewer& mesh1,
+                                  const MeshData::Viewer& mesh2,
+                                  ArrayViewT<const IndexT> face_ids1,
+                                  ArrayViewT<const IndexT> face_ids2,
+                                  ExecutionMode exec_mode,
+                                  int allocator_id )
+{
+  PairColoring coloring;
+  const IndexT num_pairs = face_ids1.size();
+  SLIC_ERROR_ROOT_IF( face_ids2.size() != num_pairs,
+                      "tribol::computePairColoring(): face id arrays differ in size." );
+
+  if (num_pairs == 0)
+  {
+    coloring.m_pair_color = ArrayT<IndexT>(0, 0, allocator_id);
+    coloring.m_color_pairs = ArrayT<IndexT>(0, 0, allocator_id);
+    coloring.m_color_offsets = ArrayT<IndexT, 1, MemorySpace::Host>({0});
+    return coloring;
+  }
+
+  // nodes of both meshes are numbered in a single index space. the node ids
+  // coincide if both sides of the pairs are on the same mesh.
+  const IndexT node_offset2 = (mesh1.meshId() == mesh2.meshId()) ? 0 : mesh1.numberOfNodes();
+  const IndexT num_nodes = node_offset2 + mesh2.numberOfNodes();
+
+  ArrayT<IndexT> color_data(num_pairs, num_pairs, allocator_id);
+  ArrayT<MaskT> node_mask_data(num_nodes, num_nodes, allocator_id);
+  ArrayT<MaskT> node_max_data(num_nodes, num_nodes, allocator_id);
+  ArrayT<IndexT> num_uncolored_data({0}, allocator_id);
+  auto color = color_data.view();
+  auto node_mask = node_mask_data.view();
+  auto node_max = node_max_data.view();
+  auto num_uncolored = num_uncolored_data.view();
+
+  forAllExec(exec_mode, num_pairs,
+    [color] TRIBOL_HOST_DEVICE (IndexT i) {
+      color[i] = -1;
+    }
+  );
+
+  IndexT uncolored = num_pairs;
+  IndexT round = 0;
+  while (uncolored > 0)
+  {
+    ///////////////////////////////////////////////////////
+    // find the largest uncolored pair priority per node //
+    ///////////////////////////////////////////////////////
+    forAllExec(exec_mode, num_nodes,
+      [node_max] TRIBOL_HOST_DEVICE (IndexT n) {
+        node_max[n] = 0;
+      }
+    );
+    forAllExec(exec_mode, num_pairs,
+      [color, node_max, mesh1, mesh2, face_ids1, face_ids2, node_offset2]
+      TRIBOL_HOST_DEVICE (IndexT i) {
+        if (color[i] >= 0)
+        {
+          return;
+        }
+        MaskT priority = pairPriority(i);
+        for (IndexT a{0}; a < mesh1.numberOfNodesPerElement(); ++a)
+        {
+          IndexT n = mesh1.getGlobalNodeId(face_ids1[i], a);
+#ifdef TRIBOL_USE_RAJA
+          RAJA::atomicMax<RAJA::auto_atomic>( &node_max[n], priority );
+#else
+          node_max[n] = axom::utilities::max(node_max[n], priority);
+#endif
+        }
+        for (IndexT a{0}; a < mesh2.numberOfNodesPerElement(); ++a)
+        {
+          IndexT n = node_offset2 + mesh2.getGlobalNodeId(face_ids2[i], a);
+#ifdef TRIBOL_USE_RAJA
+          RAJA::atomicMax<RAJA::auto_atomic>( &node_max[n], priority );
+#else
+          node_max[n] = axom::utilities::max(node_max[n], priority);
+#endif
+        }
+      }
+    );
+
+    ///////////////////////////////////////////////////////////////
+    // color the local maxima. these pairs share no nodes, so    //
+    // each may update the color masks at its nodes without      //
+    // atomics.                                                  //
+    ///////////////////////////////////////////////////////////////
+    num_uncolored_data.fill(0);
+    forAllExec(exec_mode, num_pairs,
+      [color, node_mask, node_max, num_uncolored, mesh1, mesh2, face_ids1,
+       face_ids2, node_offset2, round] TRIBOL_HOST_DEVICE (IndexT i) {
+        if (color[i] >= 0)
+        {
+          return;
+        }
+        const IndexT num_nodes1 = mesh1.numberOfNodesPerElement();
+        const IndexT num_nodes2 = mesh2.numberOfNodesPerElement();
+        auto pair_node = [=](IndexT a) {
+          return (a < num_nodes1) ? mesh1.getGlobalNodeId(face_ids1[i], a) :
+            node_offset2 + mesh2.getGlobalNodeId(face_ids2[i], a - num_nodes1);
+        };
+
+        MaskT priority = pairPriority(i);
+        MaskT used = 0;
+        for (IndexT a{0}; a < num_nodes1 + num_nodes2; ++a)
+        {
+          IndexT n = pair_node(a);
+          if (node_max[n] != priority)
+          {
+#ifdef TRIBOL_USE_RAJA
+            RAJA::atomicAdd<RAJA::auto_atomic>( &num_uncolored[0], IndexT{1} );
+#else
+            ++num_uncolored[0];
+#endif
+            return;
+          }
+          used |= node_mask[n];
+        }
+
+        // smallest color not used at the pair's nodes; fall back to a color
+        // unique to this round if all mask colors are taken
+        IndexT c = num_mask_colors + round;
+        for (int k{0}; k < num_mask_colors; ++k)
+        {
+          if (!((used >> k) & MaskT{1}))
+          {
+            c = k;
+            break;
+          }
+        }
+        color[i] = c;
+        if (c < num_mask_colors)
+        {
+          for (IndexT a{0}; a < num_nodes1 + num_nodes2; ++a)
+          {
+            node_mask[pair_node(a)] |= (MaskT{1} << c);
+          }
+        }
+      }
+    );
+
+    ArrayT<IndexT, 1, MemorySpace::Host> num_uncolored_host(num_uncolored_data);
+    uncolored = num_uncolored_host[0];
+    ++round;
+  }
+
+  //////////////////////////////////////////////////////////////////
+  // compact the colors and sort the pairs by color (on the host) //
+  //////////////////////////////////////////////////////////////////
+  ArrayT<IndexT, 1, MemorySpace::Host> color_host(color_data);
+  IndexT max_color = 0;
+  for (IndexT i{0}; i < num_pairs; ++i)
+  {
+    max_color = axom::utilities::max(max_color, color_host[i]);
+  }
+  ArrayT<IndexT, 1, MemorySpace::Host> color_map(max_color + 1, max_color + 1);
+  for (IndexT i{0}; i < num_pairs; ++i)
+  {
+    color_map[color_host[i]] = 1;
+  }
+  IndexT num_colors = 0;
+  for (IndexT c{0}; c <= max_color; ++c)
+  {
+    color_map[c] = color_map[c] ? num_colors++ : -1;
+  }
+
+  ArrayT<IndexT, 1, MemorySpace::Host> offsets(num_colors + 1, num_colors + 1);
+  for (IndexT i{0}; i < num_pairs; ++i)
+  {
+    color_host[i] = color_map[color_host[i]];
+    ++offsets[color_host[i] + 1];
+  }
+  for (IndexT c{0}; c < num_colors; ++c)
+  {
+    offsets[c+1] += offsets[c];
+  }
+  ArrayT<IndexT, 1, MemorySpace::Host> color_pairs_host(num_pairs, num_pairs);
+  ArrayT<IndexT, 1, MemorySpace::Host> fill_ct(num_colors, num_colors);
+  for (IndexT i{0}; i < num_pairs; ++i)
+  {
+    IndexT c = color_host[i];
+    color_pairs_host[offsets[c] + fill_ct[c]++] = i;
+  }
+
+  coloring.m_num_colors = num_colors;
+  coloring.m_color_offsets = std::move(offsets);
+  coloring.m_pair_color = ArrayT<IndexT>(num_pairs, num_pairs, allocator_id);
+  coloring.m_color_pairs = ArrayT<IndexT>(num_pairs, num_pairs, allocator_id);
+  axom::copy(coloring.m_pair_color.data(), color_host.data(), num_pairs * sizeof(IndexT));
+  axom::copy(coloring.m_color_pairs.data(), color_pairs_host.data(), num_pairs * sizeof(IndexT));
+
+  return coloring;
+
+} // end computePairColoring()
+
+} // end namespace tribol
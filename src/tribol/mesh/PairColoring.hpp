@@ -0,0 +1,69 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_MESH_PAIRCOLORING_HPP_
+#define SRC_MESH_PAIRCOLORING_HPP_
+
+#include "tribol/common/ArrayTypes.hpp"
+#include "tribol/common/BasicTypes.hpp"
+#include "tribol/common/ExecModel.hpp"
+#include "tribol/mesh/MeshData.hpp"
+
+namespace tribol
+{
+
+/**
+ * @brief Coloring of face-pairs such that pairs of the same color share no nodes
+ *
+ * Pairs are grouped by color in compressed row storage: the pairs of color c
+ * are m_color_pairs[m_color_offsets[c]] through
+ * m_color_pairs[m_color_offsets[c+1]-1]. Kernels that scatter to nodes may
+ * process one color at a time with plain (non-atomic) stores. Since colors are
+ * processed in a fixed order, the nodal sums are also deterministic.
+ */
+struct PairColoring
+{
+public:
+
+   IndexT m_num_colors {0}; ///< Number of (non-empty) colors
+
+   ArrayT<IndexT> m_pair_color;    ///< Color of each pair
+   ArrayT<IndexT> m_color_pairs;   ///< Pair ids sorted by color
+
+   /// Offsets of each color in m_color_pairs (size m_num_colors + 1)
+   ArrayT<IndexT, 1, MemorySpace::Host> m_color_offsets;
+};
+
+/**
+ * @brief Colors face-pairs by shared nodes
+ *
+ * \param [in] mesh1 view of the mesh of the first face of each pair
+ * \param [in] mesh2 view of the mesh of the second face of each pair
+ * \param [in] face_ids1 id of the first face of each pair
+ * \param [in] face_ids2 id of the second face of each pair
+ * \param [in] exec_mode defines where the coloring kernels are executed
+ * \param [in] allocator_id allocator id of the output pair arrays
+ *
+ * \return coloring of the pairs
+ *
+ * The coloring is computed with a parallel greedy (Jones-Plassmann) algorithm.
+ * In each round, every uncolored pair with the largest (hashed) priority among
+ * the uncolored pairs sharing any of its nodes takes the smallest color not
+ * yet used at its nodes. Used colors are tracked with a 64-bit mask per node;
+ * if all 64 are taken, the pair receives a color unique to the round. The
+ * result is independent of the execution mode.
+ *
+ * \pre face ids and mesh connectivity are accessible in exec_mode
+ */
+PairColoring computePairColoring( const MeshData::Viewer& mesh1,
+                                  const MeshData::Viewer& mesh2,
+                                  ArrayViewT<const IndexT> face_ids1,
+                                  ArrayViewT<const IndexT> face_ids2,
+                                  ExecutionMode exec_mode,
+                                  int allocator_id );
+
+} // end namespace tribol
+
+#endif /* SRC_MESH_PAIRCOLORING_HPP_ */
@@ -0,0 +1,259 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#include "tribol/mesh/SurfaceExtraction.hpp"
+#include "tribol/common/LoopExec.hpp"
+
+#include "axom/slic.hpp"
+
+namespace tribol
+{
+
+namespace
+{
+
+constexpr int max_nodes_per_face = 4;
+
+// local node ids of each face of a linear hex, ordered per the TestMesh/MFEM
+// hex node numbering such that face normals point out of the element
+constexpr int hex_faces[6][4] = { {0, 3, 2, 1},
+                                  {4, 5, 6, 7},
+                                  {0, 1, 5, 4},
+                                  {1, 2, 6, 5},
+                                  {2, 3, 7, 6},
+                                  {3, 0, 4, 7} };
+
+// local node ids of each face of a linear tet
+constexpr int tet_faces[4][3] = { {0, 2, 1},
+                                  {0, 1, 3},
+                                  {1, 2, 3},
+                                  {2, 0, 3} };
+
+TRIBOL_HOST_DEVICE inline int localFaceNode( bool is_hex, int face, int node )
+{
+  return is_hex ? hex_faces[face][node] : tet_faces[face][node];
+}
+
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+int getNumFacesPerVolumeElement( InterfaceElementType element_type )
+{
+  switch (element_type)
+  {
+    case LINEAR_HEX:
+      return 6;
+    case LINEAR_TET:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+//------------------------------------------------------------------------------
+InterfaceElementType getVolumeElementFaceType( InterfaceElementType element_type )
+{
+  switch (element_type)
+  {
+    case LINEAR_HEX:
+      return LINEAR_QUAD;
+    case LINEAR_TET:
+      return LINEAR_TRIANGLE;
+    default:
+      return UNDEFINED_ELEMENT;
+  }
+}
+
+//------------------------------------------------------------------------------
+Array2D<IndexT> extractSurfaceFaces( IndexT num_elements,
+                                     const IndexT* connectivity,
+                                     InterfaceElementType element_type,
+                                     const RealT* x,
+                                     const RealT* y,
+                                     const RealT* z,
+                                     const int* face_attributes,
+                                     int attribute,
+                                     ExecutionMode exec_mode )
+{
+  const int faces_per_elem = getNumFacesPerVolumeElement( element_type );
+  SLIC_ERROR_ROOT_IF( faces_per_elem == 0, "tribol::extractSurfaceFaces(): " <<
+                      "only LINEAR_HEX and LINEAR_TET volume elements are supported." );
+  SLIC_ERROR_ROOT_IF( exec_mode != ExecutionMode::Sequential &&
+                      exec_mode != ExecutionMode::OpenMP,
+                      "tribol::extractSurfaceFaces(): a host execution mode is required." );
+
+  const bool is_hex = (element_type == LINEAR_HEX);
+  const int nodes_per_elem = is_hex ? 8 : 4;
+  const int nodes_per_face = is_hex ? 4 : 3;
+
+  if (num_elements <= 0)
+  {
+    return Array2D<IndexT>(0, nodes_per_face);
+  }
+
+  SLIC_ERROR_ROOT_IF( connectivity == nullptr || x == nullptr || y == nullptr || z == nullptr,
+                      "tribol::extractSurfaceFaces(): null connectivity or coordinate array." );
+
+  const IndexT num_faces = num_elements * faces_per_elem;
+
+  ///////////////////////////////////////////////////////
+  // compute a key of sorted node ids for each element //
+  // face                                              //
+  ///////////////////////////////////////////////////////
+  Array2D<IndexT> keys_data(num_faces, nodes_per_face);
+  Array2DView<IndexT> keys = keys_data;
+  forAllExec(exec_mode, num_faces,
+    [keys, connectivity, is_hex, nodes_per_elem, nodes_per_face, faces_per_elem]
+    TRIBOL_HOST_DEVICE (IndexT f) {
+      IndexT e = f / faces_per_elem;
+      int lf = f % faces_per_elem;
+      IndexT key[max_nodes_per_face];
+      for (int a{0}; a < nodes_per_face; ++a)
+      {
+        key[a] = connectivity[nodes_per_elem * e + localFaceNode(is_hex, lf, a)];
+      }
+      // insertion sort of the (at most four) face node ids
+      for (int a{1}; a < nodes_per_face; ++a)
+      {
+        IndexT val = key[a];
+        int b = a - 1;
+        while (b >= 0 && key[b] > val)
+        {
+          key[b+1] = key[b];
+          --b;
+        }
+        key[b+1] = val;
+      }
+      for (int a{0}; a < nodes_per_face; ++a)
+      {
+        keys(f, a) = key[a];
+      }
+    }
+  );
+
+  // sort the faces by key so that shared (interior) faces are adjacent. The 
+  // keys are ordered lexicographically by stable sorts on one key component 
+  // at a time, from the last component to the first, so faces with equal keys 
+  // stay in face id order.
+  Array1D<IndexT> order(num_faces, num_faces);
+  Array1DView<IndexT> sorted = order;
+  Array1D<IndexT> digits_data(num_faces, num_faces);
+  Array1DView<IndexT> digits = digits_data;
+  forAllExec(exec_mode, num_faces,
+    [sorted] TRIBOL_HOST_DEVICE (IndexT f) {
+      sorted[f] = f;
+    }
+  );
+  for (int a{nodes_per_face - 1}; a >= 0; --a)
+  {
+    forAllExec(exec_mode, num_faces,
+      [digits, sorted, keys, a] TRIBOL_HOST_DEVICE (IndexT i) {
+        digits[i] = keys(sorted[i], a);
+      }
+    );
+    stableSortPairsExec(exec_mode, num_faces, digits.data(), sorted.data());
+  }
+
+  ////////////////////////////////////////////////////////////////////
+  // flag faces with a unique key that also pass the attribute filter //
+  ////////////////////////////////////////////////////////////////////
+  Array1D<IndexT> is_surface_data(num_faces, num_faces);
+  Array1DView<IndexT> is_surface = is_surface_data;
+  forAllExec(exec_mode, num_faces,
+    [is_surface, sorted, keys, nodes_per_face, num_faces, face_attributes, attribute]
+    TRIBOL_HOST_DEVICE (IndexT i) {
+      auto same_key = [&](IndexT j) {
+        for (int a{0}; a < nodes_per_face; ++a)
+        {
+          if (keys(sorted[i], a) != keys(sorted[j], a))
+          {
+            return false;
+          }
+        }
+        return true;
+      };
+      bool unique = !(i > 0 && same_key(i-1)) && !(i < num_faces-1 && same_key(i+1));
+      if (unique && face_attributes != nullptr)
+      {
+        unique = (face_attributes[sorted[i]] == attribute);
+      }
+      is_surface[i] = unique ? 1 : 0;
+    }
+  );
+
+  // compute offsets of the surface faces in the output (sorted key order)
+  Array1D<IndexT> offsets(num_faces, num_faces);
+  exclusiveScanExec(exec_mode, num_faces, is_surface_data.data(), offsets.data());
+  const IndexT num_surface_faces = offsets[num_faces-1] + is_surface_data[num_faces-1];
+
+  /////////////////////////////////////////////////
+  // write the surface connectivity, orienting   //
+  // each face away from its element's centroid  //
+  /////////////////////////////////////////////////
+  Array2D<IndexT> surface_conn(num_surface_faces, nodes_per_face);
+  Array2DView<IndexT> surf = surface_conn;
+  Array1DView<IndexT> offsets_view = offsets;
+  forAllExec(exec_mode, num_faces,
+    [surf, is_surface, offsets_view, sorted, connectivity, x, y, z, is_hex,
+     nodes_per_elem, nodes_per_face, faces_per_elem] TRIBOL_HOST_DEVICE (IndexT i) {
+      if (!is_surface[i])
+      {
+        return;
+      }
+      IndexT f = sorted[i];
+      IndexT e = f / faces_per_elem;
+      int lf = f % faces_per_elem;
+
+      IndexT face_nodes[max_nodes_per_face];
+      RealT fc[3] = {0., 0., 0.};
+      for (int a{0}; a < nodes_per_face; ++a)
+      {
+        face_nodes[a] = connectivity[nodes_per_elem * e + localFaceNode(is_hex, lf, a)];
+        fc[0] += x[face_nodes[a]] / nodes_per_face;
+        fc[1] += y[face_nodes[a]] / nodes_per_face;
+        fc[2] += z[face_nodes[a]] / nodes_per_face;
+      }
+
+      RealT ec[3] = {0., 0., 0.};
+      for (int a{0}; a < nodes_per_elem; ++a)
+      {
+        IndexT n = connectivity[nodes_per_elem * e + a];
+        ec[0] += x[n] / nodes_per_elem;
+        ec[1] += y[n] / nodes_per_elem;
+        ec[2] += z[n] / nodes_per_elem;
+      }
+
+      // face normal (unnormalized) from the sum of the fan triangle normals
+      RealT nrml[3] = {0., 0., 0.};
+      for (int a{0}; a < nodes_per_face; ++a)
+      {
+        IndexT n1 = face_nodes[a];
+        IndexT n2 = face_nodes[(a+1) % nodes_per_face];
+        RealT v1[3] = { x[n1] - fc[0], y[n1] - fc[1], z[n1] - fc[2] };
+        RealT v2[3] = { x[n2] - fc[0], y[n2] - fc[1], z[n2] - fc[2] };
+        nrml[0] += v1[1] * v2[2] - v1[2] * v2[1];
+        nrml[1] += v1[2] * v2[0] - v1[0] * v2[2];
+        nrml[2] += v1[0] * v2[1] - v1[1] * v2[0];
+      }
+      RealT outward = nrml[0] * (fc[0] - ec[0])
+                    + nrml[1] * (fc[1] - ec[1])
+                    + nrml[2] * (fc[2] - ec[2]);
+
+      IndexT row = offsets_view[i];
+      for (int a{0}; a < nodes_per_face; ++a)
+      {
+        // reverse the node ordering (keeping the first node) if the face
+        // normal points into the element
+        int b = (outward >= 0.) ? a : (nodes_per_face - a) % nodes_per_face;
+        surf(row, a) = face_nodes[b];
+      }
+    }
+  );
+
+  return surface_conn;
+
+} // end extractSurfaceFaces()
+
+} // end namespace tribol
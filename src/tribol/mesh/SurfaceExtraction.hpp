@@ -0,0 +1,75 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_MESH_SURFACEEXTRACTION_HPP_
+#define SRC_MESH_SURFACEEXTRACTION_HPP_
+
+#include "tribol/common/ArrayTypes.hpp"
+#include "tribol/common/ExecModel.hpp"
+#include "tribol/common/Parameters.hpp"
+
+namespace tribol
+{
+
+/*!
+ * \brief Returns the number of faces of a linear volume element
+ *
+ * \param [in] element_type volume element type (LINEAR_HEX or LINEAR_TET)
+ *
+ * \return number of faces per element; 0 for unsupported element types
+ */
+int getNumFacesPerVolumeElement( InterfaceElementType element_type );
+
+/*!
+ * \brief Returns the surface element type of the faces of a linear volume element
+ *
+ * \param [in] element_type volume element type (LINEAR_HEX or LINEAR_TET)
+ *
+ * \return LINEAR_QUAD for hexes, LINEAR_TRIANGLE for tets, and
+ *         UNDEFINED_ELEMENT otherwise
+ */
+InterfaceElementType getVolumeElementFaceType( InterfaceElementType element_type );
+
+/*!
+ * \brief Extracts the oriented boundary faces of a linear volume mesh
+ *
+ * \param [in] num_elements number of volume elements
+ * \param [in] connectivity volume element connectivity (row-major, num_elements rows)
+ * \param [in] element_type volume element type (LINEAR_HEX or LINEAR_TET)
+ * \param [in] x array of x-components of the nodal coordinates
+ * \param [in] y array of y-components of the nodal coordinates
+ * \param [in] z array of z-components of the nodal coordinates
+ * \param [in] face_attributes optional attribute for each local element face
+ *             (row-major, num_elements rows); nullptr keeps all boundary faces
+ * \param [in] attribute boundary faces with this attribute are kept when
+ *             face_attributes is given
+ * \param [in] exec_mode defines where the face key loops, key sort and offset
+ *             scan are executed
+ *
+ * \return surface connectivity with one row per extracted face
+ *
+ * Each element face is assigned a key consisting of its sorted node ids. The
+ * faces are sorted by key, with one parallel stable sort per key component, and
+ * a face whose key is unique lies on the boundary.
+ * Extracted faces are oriented such that the face normal points away from the
+ * owning element's centroid, which is the orientation required of contact
+ * surfaces.
+ *
+ * \pre connectivity and nodal coordinates are in host accessible memory
+ * \pre exec_mode is a host execution mode
+ */
+Array2D<IndexT> extractSurfaceFaces( IndexT num_elements,
+                                     const IndexT* connectivity,
+                                     InterfaceElementType element_type,
+                                     const RealT* x,
+                                     const RealT* y,
+                                     const RealT* z,
+                                     const int* face_attributes = nullptr,
+                                     int attribute = 0,
+                                     ExecutionMode exec_mode = ExecutionMode::Sequential );
+
+} // end namespace tribol
+
+#endif /* SRC_MESH_SURFACEEXTRACTION_HPP_ */
@@ -184,16 +184,6 @@ void ComputeAlignedMortarGaps( CouplingScheme* cs )
 
    const IndexT numNodesPerFace = mortarMesh.numberOfNodesPerElement();
 
-   RealT const * const x1 = mortarMesh.getPosition()[0].data();
-   RealT const * const y1 = mortarMesh.getPosition()[1].data();
-   RealT const * const z1 = mortarMesh.getPosition()[2].data();
-   const IndexT * const mortarConn= mortarMesh.getConnectivity().data();
-
-   RealT const * const x2 = nonmortarMesh.getPosition()[0].data();
-   RealT const * const y2 = nonmortarMesh.getPosition()[1].data();
-   RealT const * const z2 = nonmortarMesh.getPosition()[2].data();
-   const IndexT * nonmortarConn = nonmortarMesh.getConnectivity().data();
-
  
    // declare local variables to hold face nodal coordinates
    // and overlap vertex coordinates
@@ -224,16 +214,8 @@ void ComputeAlignedMortarGaps( CouplingScheme* cs )
       // onto the common plane, since the aligned mortar gap 
       // calculation uses the current configuration nodal coordinates 
       // themselves
-      for (int i=0; i<numNodesPerFace; ++i)
-      {
-         int id = dim * i;
-         mortarX[ id ]   = x1[ mortarConn[ numNodesPerFace * index1 + i ] ];
-         mortarX[ id+1 ] = y1[ mortarConn[ numNodesPerFace * index1 + i ] ];
-         mortarX[ id+2 ] = z1[ mortarConn[ numNodesPerFace * index1 + i ] ];
-         nonmortarX[ id ]   = x2[ nonmortarConn[ numNodesPerFace * index2 + i ] ];
-         nonmortarX[ id+1 ] = y2[ nonmortarConn[ numNodesPerFace * index2 + i ] ];
-         nonmortarX[ id+2 ] = z2[ nonmortarConn[ numNodesPerFace * index2 + i ] ];
-      }
+      mortarMesh.getFaceCoords( index1, mortarX );
+      nonmortarMesh.getFaceCoords( index2, nonmortarX );
 
       // construct array of polygon overlap vertex coordinates
       ArrayT<RealT, 2> overlapX(plane.m_numPolyVert, dim);
@@ -298,14 +280,14 @@ int ApplyNormal< ALIGNED_MORTAR, LAGRANGE_MULTIPLIER >( CouplingScheme* cs )
 
    const IndexT numNodesPerFace = mortarMesh.numberOfNodesPerElement();
 
-   RealT * const fx1 = mortarMesh.getResponse()[0].data();
-   RealT * const fy1 = mortarMesh.getResponse()[1].data();
-   RealT * const fz1 = mortarMesh.getResponse()[2].data();
+   const auto& fx1 = mortarMesh.getResponse()[0];
+   const auto& fy1 = mortarMesh.getResponse()[1];
+   const auto& fz1 = mortarMesh.getResponse()[2];
    const IndexT * const mortarConn= mortarMesh.getConnectivity().data();
 
-   RealT * const fx2 = nonmortarMesh.getResponse()[0].data();
-   RealT * const fy2 = nonmortarMesh.getResponse()[1].data();
-   RealT * const fz2 = nonmortarMesh.getResponse()[2].data();
+   const auto& fx2 = nonmortarMesh.getResponse()[0];
+   const auto& fy2 = nonmortarMesh.getResponse()[1];
+   const auto& fz2 = nonmortarMesh.getResponse()[2];
    const IndexT * nonmortarConn = nonmortarMesh.getConnectivity().data();
 
    int numTotalNodes;
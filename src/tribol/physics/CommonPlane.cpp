@@ -8,6 +8,7 @@
 #include "tribol/mesh/MethodCouplingData.hpp"
 #include "tribol/mesh/InterfacePairs.hpp"
 #include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/CouplingSchemeBatch.hpp"
 #include "tribol/geom/ContactPlane.hpp"
 #include "tribol/geom/GeomUtilities.hpp"
 #include "tribol/common/Parameters.hpp"
@@ -53,31 +54,18 @@ TRIBOL_HOST_DEVICE RealT ComputeGapRatePressure( ContactPlane& plane,
 
    const auto dim = plane.m_dim;
 
-   // compute the correct rate_penalty
-   RealT rate_penalty = 0.;
-   switch (rate_calc)
+   // compute the correct rate_penalty from the per-face rate coefficients 
+   // precomputed in MeshData::computePenaltyData()
+   if (rate_calc == NO_RATE_PENALTY)
    {
-      case NO_RATE_PENALTY:
-      {
-         return 0.;
-      }
-      case RATE_CONSTANT:
-      {
-         rate_penalty = 0.5 * (m1.getElementData().m_rate_penalty_stiffness + 
-                               m2.getElementData().m_rate_penalty_stiffness);
-         break;
-      }
-      case RATE_PERCENT:
-      {
-         rate_penalty = element_penalty * 0.5 * 
-                        (m1.getElementData().m_rate_percent_stiffness + 
-                         m2.getElementData().m_rate_percent_stiffness);
-         break;
-      }
-      default:
-         // no-op, quiet compiler
-         break;
-   } // end switch on rate_calc
+      return 0.;
+   }
+   RealT rate_penalty = 0.5 * (m1.getFaceRatePenalty()[ fId1 ] + 
+                               m2.getFaceRatePenalty()[ fId2 ]);
+   if (rate_calc == RATE_PERCENT)
+   {
+      rate_penalty *= element_penalty;
+   }
 
    // compute the velocity gap and pressure contribution
    constexpr int max_dim = 3;
@@ -154,10 +142,431 @@ TRIBOL_HOST_DEVICE RealT ComputeGapRatePressure( ContactPlane& plane,
 
 } // end ComputeGapRatePressure()
 
+//------------------------------------------------------------------------------
+int ApplyRigidSurfacePenalty( CouplingScheme* cs )
+{
+   ArrayT<int> err_data({0}, cs->getAllocatorId());
+   ArrayViewT<int> err = err_data;
+   auto mesh1 = cs->getMesh1().getView();
+   const RigidSurface surf = cs->getMesh2().getRigidSurface();
+   const PenaltyEnforcementOptions& pen_enfrc_options = 
+      cs->getEnforcementOptions().penalty_options;
+   const bool use_rate = pen_enfrc_options.constraint_type == KINEMATIC_AND_RATE &&
+                         pen_enfrc_options.rate_calculation != NO_RATE_PENALTY && 
+                         mesh1.hasVelocity();
+   const bool rate_percent = pen_enfrc_options.rate_calculation == RATE_PERCENT;
+
+   forAllExec(cs->getExecutionMode(), mesh1.numberOfElements(),
+      [mesh1, surf, err, use_rate, rate_percent] TRIBOL_HOST_DEVICE (IndexT i)
+      {
+         constexpr int max_dim = 3;
+         constexpr int max_nodes_per_face = 4;
+         const int dim = mesh1.spatialDimension();
+         const int num_nodes_per_face = mesh1.numberOfNodesPerElement();
+
+         RealT xf[ max_dim * max_nodes_per_face ];
+         RealT vf[ max_dim * max_nodes_per_face ];
+         mesh1.getFaceCoords( i, xf );
+         if (use_rate)
+         {
+            mesh1.getFaceVelocities( i, vf );
+         }
+
+         // the rigid surface is infinitely stiff, so the springs in series 
+         // reduce to the stiffness of the deformable face
+         const RealT stiffness = mesh1.getFacePenaltyStiffness()[ i ];
+         if (stiffness < 0.)
+         {
+            err[0] = 1;
+            return;
+         }
+         RealT rate_penalty = 0.;
+         if (use_rate)
+         {
+            rate_penalty = mesh1.getFaceRatePenalty()[ i ];
+            if (rate_percent)
+            {
+               rate_penalty *= stiffness;
+            }
+         }
+
+         // each face node carries an equal share of the face area
+         const RealT share = mesh1.getElementAreas()[ i ] / num_nodes_per_face;
+
+         for (IndexT a{0}; a < num_nodes_per_face; ++a)
+         {
+            RealT nrml[max_dim];
+            const RealT gap = surf.signedDistance( &xf[dim*a], nrml );
+            if (gap >= 0.)
+            {
+               continue;
+            }
+
+            RealT pressure = gap * stiffness;
+            if (use_rate)
+            {
+               // only velocities leading to more interpenetration contribute
+               RealT vel_gap = 0.;
+               for (int d{0}; d < dim; ++d)
+               {
+                  vel_gap += (vf[dim*a + d] - surf.m_vel[d]) * nrml[d];
+               }
+               if (vel_gap <= 0.)
+               {
+                  pressure += vel_gap * rate_penalty;
+               }
+            }
+
+            const RealT contact_force = pressure * share;
+            const IndexT node_id = mesh1.getGlobalNodeId( i, a );
+            for (int d{0}; d < dim; ++d)
+            {
+#ifdef TRIBOL_USE_RAJA
+               RAJA::atomicAdd<RAJA::auto_atomic>(&mesh1.getResponse()[d][node_id], 
+                                                  -contact_force * nrml[d]);
+#else
+               mesh1.getResponse()[d][node_id] -= contact_force * nrml[d];
+#endif
+            }
+         }
+      }
+   );
+
+   ArrayT<int, 1, MemorySpace::Host> err_host(err_data);
+   SLIC_DEBUG_IF(err_host[0] != 0, "ApplyRigidSurfacePenalty: negative element thicknesses encountered.");
+   return err_host[0];
+
+} // end ApplyRigidSurfacePenalty()
+
+namespace
+{
+
+/*!
+ * \brief Applies the common plane penalty force of a penetrating contact plane
+ *
+ * \tparam DIM spatial dimension
+ * \tparam NUM_NODES number of nodes per face
+ * \tparam USE_RATE true if the gap-rate pressure is added (KINEMATIC_AND_RATE)
+ *
+ * \param [in] cs_view view of the coupling scheme
+ * \param [in] plane_id id of the contact plane
+ * \param [in] colored true if the planes processed together share no nodes (no atomics needed)
+ * \param [in] rate_calc gap-rate penalty calculation (used if USE_RATE)
+ * \param [in,out] err set to 1 if a negative element thickness is encountered
+ * \param [in,out] neg_thickness set to true if a negative element thickness is encountered
+ *
+ * \note The basis is evaluated at the overlap centroid as in 
+ * EvalWeakFormIntegral<COMMON_PLANE, SINGLE_POINT>(), but the face type and 
+ * constraint type are fixed at compile time, so every loop has a constant trip
+ * count and the per-pair dimension and enforcement branches are removed.
+ */
+template <int DIM, int NUM_NODES, bool USE_RATE>
+TRIBOL_HOST_DEVICE void ApplyCommonPlanePenaltyPlane( const CouplingScheme::Viewer& cs_view,
+                                                      IndexT plane_id,
+                                                      bool colored,
+                                                      RatePenaltyCalculation rate_calc,
+                                                      int& err,
+                                                      bool& neg_thickness )
+{
+   auto& plane = cs_view.getContactPlane(plane_id);
+   auto& mesh1 = cs_view.getMesh1View();
+   auto& mesh2 = cs_view.getMesh2View();
+
+   const IndexT index1 = plane.getCpElementId1();
+   const IndexT index2 = plane.getCpElementId2();
+
+   // gather each face's scaled spring stiffness, precomputed in 
+   // MeshData::computePenaltyData(). A negative stiffness results 
+   // from a negative element thickness.
+   const RealT stiffness1 = mesh1.getFacePenaltyStiffness()[ index1 ];
+   const RealT stiffness2 = mesh2.getFacePenaltyStiffness()[ index2 ];
+   if (stiffness1 < 0. || stiffness2 < 0.)
+   {
+      neg_thickness = true;
+      err = 1;
+   }
+
+   // compute the equivalent contact penalty spring stiffness per area
+   const RealT penalty_stiff_per_area = ComputePenaltyStiffnessPerArea( stiffness1, stiffness2 );
+
+   // kinematic contribution, plus the gap-rate contribution if requested
+   plane.m_pressure = plane.m_gap * penalty_stiff_per_area;
+   RealT totalPressure = plane.m_pressure;
+   if (USE_RATE)
+   {
+      totalPressure += ComputeGapRatePressure( plane, mesh1, mesh2, 
+                                               penalty_stiff_per_area, rate_calc );
+   }
+
+   // the single integration point is the area centroid of the overlap 
+   // polygon, or the vertex averaged centroid of the overlap segment
+   const RealT nrml[3] = { plane.m_nX, plane.m_nY, (DIM == 3) ? plane.m_nZ : 0. };
+   RealT cx[3] = { 0., 0., 0. };
+   if (DIM == 2)
+   {
+      auto& cp2 = static_cast<ContactPlane2D&>(plane);
+      const RealT xVert[4] = { cp2.m_segX[0], cp2.m_segY[0], 
+                               cp2.m_segX[1], cp2.m_segY[1] };
+      VertexAvgCentroid( xVert, 2, 2, cx[0], cx[1], cx[2] );
+   }
+   else
+   {
+      auto& cp3 = static_cast<ContactPlane3D&>(plane);
+      RealT xVert[3 * ContactPlane::max_nodes_per_overlap];
+      for (int j{0}; j < cp3.m_numPolyVert; ++j)
+      {
+         xVert[3*j]     = cp3.m_polyX[j];
+         xVert[3*j + 1] = cp3.m_polyY[j];
+         xVert[3*j + 2] = cp3.m_polyZ[j];
+      }
+      PolyAreaCentroid( xVert, 3, cp3.m_numPolyVert, cx[0], cx[1], cx[2] );
+   }
+
+   // project each face to the common plane through the integration 
+   // point and evaluate the face basis there
+   IndexT nodes1[NUM_NODES];
+   IndexT nodes2[NUM_NODES];
+   RealT xf1[DIM * NUM_NODES];
+   RealT xf2[DIM * NUM_NODES];
+   mesh1.getFaceCoords( index1, xf1 );
+   mesh2.getFaceCoords( index2, xf2 );
+   RealT projX1[3 * NUM_NODES];
+   RealT projX2[3 * NUM_NODES];
+   for (int a{0}; a < NUM_NODES; ++a)
+   {
+      nodes1[a] = mesh1.getGlobalNodeId(index1, a);
+      nodes2[a] = mesh2.getGlobalNodeId(index2, a);
+      if (DIM == 3)
+      {
+         ProjectPointToPlane( xf1[DIM*a], xf1[DIM*a+1], xf1[DIM*a+2],
+                              nrml[0], nrml[1], nrml[2], cx[0], cx[1], cx[2],
+                              projX1[3*a], projX1[3*a+1], projX1[3*a+2] );
+         ProjectPointToPlane( xf2[DIM*a], xf2[DIM*a+1], xf2[DIM*a+2],
+                              nrml[0], nrml[1], nrml[2], cx[0], cx[1], cx[2],
+                              projX2[3*a], projX2[3*a+1], projX2[3*a+2] );
+      }
+      else
+      {
+         ProjectPointToSegment( xf1[DIM*a], xf1[DIM*a+1], nrml[0], nrml[1],
+                                cx[0], cx[1], projX1[2*a], projX1[2*a+1] );
+         ProjectPointToSegment( xf2[DIM*a], xf2[DIM*a+1], nrml[0], nrml[1],
+                                cx[0], cx[1], projX2[2*a], projX2[2*a+1] );
+      }
+   }
+
+   RealT phi1[NUM_NODES];
+   RealT phi2[NUM_NODES];
+   for (int a{0}; a < NUM_NODES; ++a)
+   {
+      EvalBasis( projX1, cx[0], cx[1], cx[2], NUM_NODES, a, phi1[a] );
+      EvalBasis( projX2, cx[0], cx[1], cx[2], NUM_NODES, a, phi2[a] );
+   }
+
+   // compute contact force (spring force)
+   const RealT contact_force = totalPressure * plane.m_area;
+   RealT force[DIM];
+   for (int d{0}; d < DIM; ++d)
+   {
+      force[d] = nrml[d] * contact_force;
+   }
+
+   // accumulate contributions in host code's registered nodal force arrays.
+   // pairs of the same color share no nodes, so no atomics are needed.
+   TRIBOL_UNUSED_VAR(colored); // only read with RAJA atomics
+   for (int a{0}; a < NUM_NODES; ++a)
+   {
+      for (int d{0}; d < DIM; ++d)
+      {
+#ifdef TRIBOL_USE_RAJA
+         if (!colored)
+         {
+            RAJA::atomicAdd<RAJA::auto_atomic>(&mesh1.getResponse()[d][nodes1[a]], 
+                                               -force[d] * phi1[a]);
+            RAJA::atomicAdd<RAJA::auto_atomic>(&mesh2.getResponse()[d][nodes2[a]], 
+                                               force[d] * phi2[a]);
+         }
+         else
+#endif
+         {
+            mesh1.getResponse()[d][nodes1[a]] -= force[d] * phi1[a];
+            mesh2.getResponse()[d][nodes2[a]] += force[d] * phi2[a];
+         }
+      }
+   }
+
+} // end ApplyCommonPlanePenaltyPlane()
+
+/*!
+ * \brief Applies the common plane penalty forces of a bin of penetrating 
+ *        contact planes
+ *
+ * \tparam DIM spatial dimension
+ * \tparam NUM_NODES number of nodes per face
+ * \tparam USE_RATE true if the gap-rate pressure is added (KINEMATIC_AND_RATE)
+ *
+ * \param [in] cs pointer to the coupling scheme
+ * \param [in] plane_ids ids of the penetrating contact planes
+ * \param [in] colored true if the planes share no nodes (no atomics needed)
+ * \param [in,out] err set to 1 if a negative element thickness is encountered
+ * \param [in,out] neg_thickness set to true if a negative element thickness is encountered
+ */
+template <int DIM, int NUM_NODES, bool USE_RATE>
+void ApplyCommonPlanePenaltyBin( CouplingScheme* cs,
+                                 ArrayViewT<const IndexT> plane_ids,
+                                 bool colored,
+                                 ArrayViewT<int> err,
+                                 ArrayViewT<bool> neg_thickness )
+{
+   auto cs_view = cs->getView();
+   const RatePenaltyCalculation rate_calc = 
+      cs->getEnforcementOptions().penalty_options.rate_calculation;
+
+   forAllExec(cs->getExecutionMode(), plane_ids.size(),
+      [cs_view, plane_ids, colored, err, neg_thickness, rate_calc] TRIBOL_HOST_DEVICE (IndexT k)
+      {
+         ApplyCommonPlanePenaltyPlane<DIM, NUM_NODES, USE_RATE>( cs_view, plane_ids[k], colored, 
+                                                                 rate_calc, err[0], neg_thickness[0] );
+      }
+   );
+
+} // end ApplyCommonPlanePenaltyBin()
+
+/*!
+ * \brief Dispatches a bin of penetrating contact planes to the kernel for the
+ *        coupling scheme's face type and penalty constraint type
+ */
+void ApplyCommonPlanePenaltyBin( CouplingScheme* cs,
+                                 ArrayViewT<const IndexT> plane_ids,
+                                 bool colored,
+                                 ArrayViewT<int> err,
+                                 ArrayViewT<bool> neg_thickness )
+{
+   const int dim = cs->spatialDimension();
+   const int num_nodes_per_face = cs->getMesh1().numberOfNodesPerElement();
+   const bool use_rate = cs->getEnforcementOptions().penalty_options.constraint_type 
+                         == KINEMATIC_AND_RATE;
+
+   if (dim == 2 && num_nodes_per_face == 2)
+   {
+      use_rate ? ApplyCommonPlanePenaltyBin<2, 2, true>( cs, plane_ids, colored, err, neg_thickness )
+               : ApplyCommonPlanePenaltyBin<2, 2, false>( cs, plane_ids, colored, err, neg_thickness );
+   }
+   else if (dim == 3 && num_nodes_per_face == 3)
+   {
+      use_rate ? ApplyCommonPlanePenaltyBin<3, 3, true>( cs, plane_ids, colored, err, neg_thickness )
+               : ApplyCommonPlanePenaltyBin<3, 3, false>( cs, plane_ids, colored, err, neg_thickness );
+   }
+   else if (dim == 3 && num_nodes_per_face == 4)
+   {
+      use_rate ? ApplyCommonPlanePenaltyBin<3, 4, true>( cs, plane_ids, colored, err, neg_thickness )
+               : ApplyCommonPlanePenaltyBin<3, 4, false>( cs, plane_ids, colored, err, neg_thickness );
+   }
+   else
+   {
+      SLIC_ERROR("ApplyNormal<COMMON_PLANE, PENALTY>: unsupported face type with " <<
+                 num_nodes_per_face << " nodes in " << dim << "D.");
+   }
+
+} // end ApplyCommonPlanePenaltyBin()
+
+/// Data of a coupling scheme in a batch needed to apply its penalty forces
+struct BatchedPenaltyScheme
+{
+   CouplingScheme::Viewer cs;
+   RatePenaltyCalculation rate_calc;
+};
+
+/*!
+ * \brief Applies the common plane penalty forces of the penetrating contact 
+ *        planes of a batch of coupling schemes
+ *
+ * \tparam DIM spatial dimension
+ * \tparam NUM_NODES number of nodes per face
+ * \tparam USE_RATE true if the gap-rate pressure is added (KINEMATIC_AND_RATE)
+ *
+ * \param [in] exec_mode execution mode of the batch
+ * \param [in] batch per-scheme data in the memory space of the batch
+ * \param [in] plane_offsets per-scheme offsets into the contact planes of the batch
+ * \param [in] plane_ids batch indices of the penetrating contact planes
+ * \param [in,out] err per-scheme flags set to 1 if a negative element thickness is encountered
+ * \param [in,out] neg_thickness per-scheme flags set to true if a negative element thickness is encountered
+ */
+template <int DIM, int NUM_NODES, bool USE_RATE>
+void ApplyCommonPlanePenaltyBatch( ExecutionMode exec_mode,
+                                   const BatchedPenaltyScheme* batch,
+                                   ArrayViewT<const IndexT> plane_offsets,
+                                   ArrayViewT<const IndexT> plane_ids,
+                                   ArrayViewT<int> err,
+                                   ArrayViewT<bool> neg_thickness )
+{
+   const IndexT num_schemes = plane_offsets.size() - 1;
+
+   forAllExec(exec_mode, plane_ids.size(),
+      [batch, plane_offsets, num_schemes, plane_ids, err, neg_thickness] TRIBOL_HOST_DEVICE (IndexT k)
+      {
+         const IndexT i = plane_ids[k];
+         const IndexT s = findBatchScheme( plane_offsets, num_schemes, i );
+         // planes of different coupling schemes may share nodes, so the batch
+         // always scatters with atomics
+         ApplyCommonPlanePenaltyPlane<DIM, NUM_NODES, USE_RATE>( batch[s].cs, i - plane_offsets[s], false, 
+                                                                 batch[s].rate_calc, err[s], neg_thickness[s] );
+      }
+   );
+
+} // end ApplyCommonPlanePenaltyBatch()
+
+/*!
+ * \brief Dispatches the penetrating contact planes of a batch to the kernel 
+ *        for the batch's face type and penalty constraint type
+ */
+void ApplyCommonPlanePenaltyBatch( const CouplingScheme& cs,
+                                   const BatchedPenaltyScheme* batch,
+                                   ArrayViewT<const IndexT> plane_offsets,
+                                   ArrayViewT<const IndexT> plane_ids,
+                                   ArrayViewT<int> err,
+                                   ArrayViewT<bool> neg_thickness )
+{
+   const ExecutionMode exec_mode = cs.getExecutionMode();
+   const int dim = cs.spatialDimension();
+   const int num_nodes_per_face = cs.getMesh1().numberOfNodesPerElement();
+   const bool use_rate = cs.getEnforcementOptions().penalty_options.constraint_type 
+                         == KINEMATIC_AND_RATE;
+
+   if (dim == 2 && num_nodes_per_face == 2)
+   {
+      use_rate ? ApplyCommonPlanePenaltyBatch<2, 2, true>( exec_mode, batch, plane_offsets, plane_ids, err, neg_thickness )
+               : ApplyCommonPlanePenaltyBatch<2, 2, false>( exec_mode, batch, plane_offsets, plane_ids, err, neg_thickness );
+   }
+   else if (dim == 3 && num_nodes_per_face == 3)
+   {
+      use_rate ? ApplyCommonPlanePenaltyBatch<3, 3, true>( exec_mode, batch, plane_offsets, plane_ids, err, neg_thickness )
+               : ApplyCommonPlanePenaltyBatch<3, 3, false>( exec_mode, batch, plane_offsets, plane_ids, err, neg_thickness );
+   }
+   else if (dim == 3 && num_nodes_per_face == 4)
+   {
+      use_rate ? ApplyCommonPlanePenaltyBatch<3, 4, true>( exec_mode, batch, plane_offsets, plane_ids, err, neg_thickness )
+               : ApplyCommonPlanePenaltyBatch<3, 4, false>( exec_mode, batch, plane_offsets, plane_ids, err, neg_thickness );
+   }
+   else
+   {
+      SLIC_ERROR("ApplyCommonPlanePenaltyBatched: unsupported face type with " <<
+                 num_nodes_per_face << " nodes in " << dim << "D.");
+   }
+
+} // end ApplyCommonPlanePenaltyBatch()
+
+} // end anonymous namespace
+
 //------------------------------------------------------------------------------
 template< >
 int ApplyNormal< COMMON_PLANE, PENALTY >( CouplingScheme* cs )
 {
+   // contact with an analytic rigid surface does not use contact planes
+   if (cs->hasRigidSurface())
+   {
+      return ApplyRigidSurfacePenalty( cs );
+   }
+
    ///////////////////////////////
    // loop over interface pairs //
    ///////////////////////////////
@@ -167,302 +576,80 @@ int ApplyNormal< COMMON_PLANE, PENALTY >( CouplingScheme* cs )
    ArrayViewT<bool> neg_thickness = neg_thickness_data;
    auto cs_view = cs->getView();
    const auto num_pairs = cs->getNumActivePairs();
-   forAllExec(cs->getExecutionMode(), num_pairs,
-      [cs_view, err, neg_thickness] TRIBOL_HOST_DEVICE (IndexT i)
+   // process the pairs one color at a time if the active pairs have been 
+   // colored; otherwise, process all pairs at once and scatter with atomics
+   const auto& coloring = cs->getPairColoring();
+   const bool colored = cs->getParameters().enable_pair_coloring &&
+                        coloring.m_pair_color.size() == num_pairs;
+   const IndexT num_classes = colored ? coloring.m_num_colors : 1;
+   auto color_pairs = coloring.m_color_pairs.view();
+
+   // flag the planes that violate the gap constraint, in color order. The 
+   // other planes pass all geometric filter checks, but are not in contact. 
+   // This check allows for numerically zero interpenetration.
+   ArrayT<IndexT> in_contact_data(num_pairs + 1, num_pairs + 1, cs->getAllocatorId());
+   ArrayViewT<IndexT> in_contact = in_contact_data;
+   forAllExec(cs->getExecutionMode(), num_pairs + 1,
+      [cs_view, colored, color_pairs, num_pairs, in_contact] TRIBOL_HOST_DEVICE (IndexT k)
       {
+         in_contact[k] = 0;
+         if (k == num_pairs)
+         {
+            return;
+         }
+         IndexT i = colored ? color_pairs[k] : k;
          auto& plane = cs_view.getContactPlane(i);
+         if ( plane.m_gap > cs_view.getGapTol( plane.getCpElementId1(), plane.getCpElementId2() ) )
+         {
+            plane.m_inContact = false;
+            return;
+         }
+         in_contact[k] = 1;
+      }
+   );
 
-         auto& mesh1 = cs_view.getMesh1View();
-         auto& mesh2 = cs_view.getMesh2View();
-
-         // get pair indices
-         IndexT index1 = plane.getCpElementId1();
-         IndexT index2 = plane.getCpElementId2();
-        
-         RealT gap = plane.m_gap;
-         RealT A = plane.m_area; // face-pair overlap area
-
-        //  don't proceed for gaps that don't violate the constraints. This check 
-        //  allows for numerically zero interpenetration.
-         RealT gap_tol = cs_view.getGapTol( index1, index2 );
-
-        if ( gap > gap_tol )
-        {
-          // We are here if we have a pair that passes ALL geometric 
-          // filter checks, BUT does not actually violate this method's 
-          // gap constraint.
-          plane.m_inContact = false;
-          return;
-        }
-
-        // debug force sums
-        // RealT dbg_sum_force1 {0.};
-        // RealT dbg_sum_force2 {0.};
-        /////////////////////////////////////////////
-        // kinematic penalty stiffness calculation //
-        /////////////////////////////////////////////
-        RealT penalty_stiff_per_area {0.};
-        auto& enforcement_options = cs_view.getEnforcementOptions();
-        const PenaltyEnforcementOptions& pen_enfrc_options = enforcement_options.penalty_options;
-        RealT pen_scale1 = mesh1.getElementData().m_penalty_scale;
-        RealT pen_scale2 = mesh2.getElementData().m_penalty_scale;
-        switch (pen_enfrc_options.kinematic_calculation)
-        {
-          case KINEMATIC_CONSTANT: 
-          {
-              // pre-multiply each spring stiffness by each mesh's penalty scale
-              auto stiffness1 = pen_scale1 * mesh1.getElementData().m_penalty_stiffness;
-              auto stiffness2 = pen_scale2 * mesh2.getElementData().m_penalty_stiffness;
-              // compute the equivalent contact penalty spring stiffness per area
-              penalty_stiff_per_area  = ComputePenaltyStiffnessPerArea( stiffness1, stiffness2 );
-              break;
-          }
-          case KINEMATIC_ELEMENT:
-          {
-              // add tiny_length to element thickness to avoid division by zero
-              auto t1 = mesh1.getElementData().m_thickness[ index1 ] + pen_enfrc_options.tiny_length;
-              auto t2 = mesh2.getElementData().m_thickness[ index2 ] + pen_enfrc_options.tiny_length;
-
-              if (t1 < 0. || t2 < 0.)
-              {
-                neg_thickness[0] = true;
-                err[0] = 1;
-              }
-
-              // compute each element spring stiffness. Pre-multiply the material modulus 
-              // (i.e. material stiffness) by each mesh's penalty scale
-              auto stiffness1 = pen_scale1 * mesh1.getElementData().m_mat_mod[ index1 ] / t1;
-              auto stiffness2 = pen_scale2 * mesh2.getElementData().m_mat_mod[ index2 ] / t2;
-              // compute the equivalent contact penalty spring stiffness per area
-              penalty_stiff_per_area = ComputePenaltyStiffnessPerArea( stiffness1, stiffness2 );
-              break;
-          }
-          default:
-              // no-op, quiet compiler
-              break;
-        } // end switch on kinematic penalty calculation option
-
-        ////////////////////////////////////////////////////
-        // Compute contact pressure(s) on current overlap // 
-        ////////////////////////////////////////////////////
-
-        // compute total pressure based on constraint type
-        RealT totalPressure = 0.;
-        plane.m_pressure = gap * penalty_stiff_per_area; // kinematic contribution
-        switch(pen_enfrc_options.constraint_type)
-        {
-          case KINEMATIC_AND_RATE:
-          {
-              // kinematic contribution
-              totalPressure += plane.m_pressure;
-              // add gap-rate contribution
-              totalPressure += 
-                ComputeGapRatePressure( plane, mesh1, mesh2, penalty_stiff_per_area,
-                                        pen_enfrc_options.rate_calculation );
-              break;
-          }
-          case KINEMATIC:
-              // kinematic gap pressure contribution  only
-              totalPressure += plane.m_pressure;
-              break;
-          default:
-              // no-op
-              break;
-        } // end switch on registered penalty enforcement option
-
-        // debug prints. Comment out for now, but keep for future common plane 
-        // debugging
-  //         SLIC_DEBUG("gap: " << gap);
-  //         SLIC_DEBUG("area: " << A);
-  //         SLIC_DEBUG("penalty stiffness: " << penalty_stiff_per_area);
-  //         SLIC_DEBUG("pressure: " << cpManager.m_pressure[ cpID ]);
-
-        ///////////////////////////////////////////
-        // create surface contact element struct //
-        ///////////////////////////////////////////
-
-        // construct array of nodal coordinates
-        constexpr int max_dim = 3;
-        constexpr int max_nodes_per_face = 4;
-        constexpr int max_nodes_per_overlap = 8;
-        RealT xf1[ max_dim * max_nodes_per_face ];
-        RealT xf2[ max_dim * max_nodes_per_face ];
-        RealT xVert[ max_dim * max_nodes_per_overlap ];  
-        int dim = cs_view.spatialDimension();
-        int num_nodes_per_face = mesh1.numberOfNodesPerElement();
-        initRealArray( xf1, dim * num_nodes_per_face, 0. );
-        initRealArray( xf2, dim * num_nodes_per_face, 0. );
-        // initialize assuming 2d
-        auto xVert_size = 4;
-        auto numPolyVert = 2;
-        // update if we are in 3d
-        if (dim == 3)
-        {
-          auto& cp3 = static_cast<ContactPlane3D&>(plane);
-          numPolyVert = cp3.m_numPolyVert;
-          xVert_size = 3 * numPolyVert;
-        }
-        initRealArray( xVert, xVert_size, 0. );
-
-  //      // get projected face coordinates
-  //      cpManager.getProjectedFaceCoords( cpID, 0, &xf1[0] ); // face 0 = first face
-  //      cpManager.getProjectedFaceCoords( cpID, 1, &xf2[0] ); // face 1 = second face
-
-        // get current configuration, physical coordinates of each face
-        mesh1.getFaceCoords( index1, &xf1[0] );
-        mesh2.getFaceCoords( index2, &xf2[0] );
-
-        // construct array of polygon overlap vertex coordinates
-        if (dim == 2)
-        {
-          auto& cp2 = static_cast<ContactPlane2D&>(plane);
-          for (IndexT j{0}; j < numPolyVert; ++j)
-          {
-            xVert[dim*j] = cp2.m_segX[j];
-            xVert[dim*j + 1] = cp2.m_segY[j];
-          }
-        }
-        else
-        {
-          auto& cp3 = static_cast<ContactPlane3D&>(plane);
-          for (IndexT j{0}; j < numPolyVert; ++j)
-          {
-            xVert[dim*j] = cp3.m_polyX[j];
-            xVert[dim*j + 1] = cp3.m_polyY[j];
-            xVert[dim*j + 2] = cp3.m_polyZ[j];
-          }
-        }
-
-        // instantiate surface contact element struct. Note, this is done with current 
-        // configuration face coordinates (i.e. NOT on the contact plane) and overlap 
-        // coordinates ON the contact plane. The surface contact element does not need 
-        // to be used this way, but the developer should do the book-keeping.
-        SurfaceContactElem cntctElem( dim, xf1, xf2, xVert,
-                                      num_nodes_per_face, numPolyVert,
-                                      &mesh1, &mesh2, index1, index2 );
-
-        // set SurfaceContactElem face normals and overlap normal
-        RealT faceNormal1[max_dim];
-        RealT faceNormal2[max_dim];
-        RealT overlapNormal[max_dim];
-
-        mesh1.getFaceNormal( index1, faceNormal1 );
-        mesh2.getFaceNormal( index2, faceNormal2 );
-        overlapNormal[0] = plane.m_nX;
-        overlapNormal[1] = plane.m_nY;
-        if (dim == 3)
-        {
-          overlapNormal[2] = plane.m_nZ;
-        }
-
-        cntctElem.faceNormal1 = faceNormal1;
-        cntctElem.faceNormal2 = faceNormal2;
-        cntctElem.overlapNormal = overlapNormal;
-        cntctElem.overlapArea   = plane.m_area;
-
-        // create arrays to hold nodal residual weak form integral evaluations
-        RealT phi1[max_nodes_per_face];
-        RealT phi2[max_nodes_per_face];
-        initRealArray( phi1, num_nodes_per_face, 0. );
-        initRealArray( phi2, num_nodes_per_face, 0. );
-
-        ////////////////////////////////////////////////////////////////////////
-        // Integration of contact integrals: integral of shape functions over //
-        // contact overlap patch                                              //
-        ////////////////////////////////////////////////////////////////////////
-        EvalWeakFormIntegral< COMMON_PLANE, SINGLE_POINT >
-                            ( cntctElem, phi1, phi2 );
-
-        ///////////////////////////////////////////////////////////////////////
-        // Computation of full contact nodal force contributions             //
-        // (i.e. premultiplication of contact integrals by normal component, //
-        //  contact pressure, and overlap area)                              //
-        ///////////////////////////////////////////////////////////////////////
-
-        // RealT phi_sum_1 = 0.;
-        // RealT phi_sum_2 = 0.;
-
-        // compute contact force (spring force)
-        RealT contact_force = totalPressure * A;
-        RealT force_x = overlapNormal[0] * contact_force;
-        RealT force_y = overlapNormal[1] * contact_force;
-        RealT force_z = 0.;
-        if (dim == 3)
-        {
-          force_z = overlapNormal[2] * contact_force;
-        }
-
-        //////////////////////////////////////////////////////
-        // loop over nodes and compute contact nodal forces //
-        //////////////////////////////////////////////////////
-        for( IndexT a=0 ; a < num_nodes_per_face ; ++a )
-        {
-
-          IndexT node0 = mesh1.getGlobalNodeId(index1, a);
-          IndexT node1 = mesh2.getGlobalNodeId(index2, a);
-
-          // if (logLevel == TRIBOL_DEBUG)
-          // {
-          //   phi_sum_1 += phi1[a];
-          //   phi_sum_2 += phi2[a];
-          // }
-  
-          const RealT nodal_force_x1 = force_x * phi1[a];
-          const RealT nodal_force_y1 = force_y * phi1[a];
-          const RealT nodal_force_z1 = force_z * phi1[a];
-
-          const RealT nodal_force_x2 = force_x * phi2[a];
-          const RealT nodal_force_y2 = force_y * phi2[a];
-          const RealT nodal_force_z2 = force_z * phi2[a];
-
-          // if (logLevel == TRIBOL_DEBUG)
-          // {
-          //   dbg_sum_force1 += magnitude( nodal_force_x1, 
-          //                                 nodal_force_y1, 
-          //                                 nodal_force_z1 );
-          //   dbg_sum_force2 += magnitude( nodal_force_x2,
-          //                                 nodal_force_y2,
-          //                                 nodal_force_z2 );
-          // }
-
-          // accumulate contributions in host code's registered nodal force arrays
-#ifdef TRIBOL_USE_RAJA
-          RAJA::atomicAdd<RAJA::auto_atomic>(&mesh1.getResponse()[0][node0], -nodal_force_x1);
-          RAJA::atomicAdd<RAJA::auto_atomic>(&mesh2.getResponse()[0][node1],  nodal_force_x2);
-
-          RAJA::atomicAdd<RAJA::auto_atomic>(&mesh1.getResponse()[1][node0], -nodal_force_y1);
-          RAJA::atomicAdd<RAJA::auto_atomic>(&mesh2.getResponse()[1][node1],  nodal_force_y2);
-
-          // there is no z component for 2D
-          if (dim == 3)
-          {
-            RAJA::atomicAdd<RAJA::auto_atomic>(&mesh1.getResponse()[2][node0], -nodal_force_z1);
-            RAJA::atomicAdd<RAJA::auto_atomic>(&mesh2.getResponse()[2][node1],  nodal_force_z2);
-          }
-#else
-          mesh1.getResponse()[0][node0] -= nodal_force_x1;
-          mesh2.getResponse()[0][node1] += nodal_force_x2;
-
-          mesh1.getResponse()[1][node0] -= nodal_force_y1;
-          mesh2.getResponse()[1][node1] += nodal_force_y2;
-
-          // there is no z component for 2D
-          if (dim == 3)
-          {
-            mesh1.getResponse()[2][node0] -= nodal_force_z1;
-            mesh2.getResponse()[2][node1] += nodal_force_z2;
-          }
-#endif
-        } // end for loop over face nodes
-
-        // comment out debug logs; too much output during tests. Keep for easy 
-        // debugging if needed
-        //SLIC_DEBUG("force sum, side 1, pair " << kp << ": " << -dbg_sum_force1 );
-        //SLIC_DEBUG("force sum, side 2, pair " << kp << ": " << dbg_sum_force2 );
-        //SLIC_DEBUG("phi 1 sum: " << phi_sum_1 );
-        //SLIC_DEBUG("phi 2 sum: " << phi_sum_2 );
+   // compact the penetrating planes of all classes into one array. The planes
+   // of each class stay contiguous, so the scanned flag at the start of a 
+   // class is the class's offset in the compacted array.
+   ArrayT<IndexT> offsets_data(num_pairs + 1, num_pairs + 1, cs->getAllocatorId());
+   ArrayViewT<IndexT> offsets = offsets_data;
+   exclusiveScanExec(cs->getExecutionMode(), num_pairs + 1, in_contact_data.data(), offsets_data.data());
+   ArrayT<IndexT> plane_ids_data(num_pairs, num_pairs, cs->getAllocatorId());
+   ArrayViewT<IndexT> plane_ids = plane_ids_data;
+   forAllExec(cs->getExecutionMode(), num_pairs,
+      [colored, color_pairs, in_contact, offsets, plane_ids] TRIBOL_HOST_DEVICE (IndexT k)
+      {
+         if (in_contact[k])
+         {
+            plane_ids[offsets[k]] = colored ? color_pairs[k] : k;
+         }
       }
    );
+
+   // gather the class offsets and read them back once
+   ArrayT<IndexT, 1, MemorySpace::Host> pair_offsets_host(num_classes + 1, num_classes + 1);
+   for (IndexT c{0}; c <= num_classes; ++c)
+   {
+      pair_offsets_host[c] = colored ? coloring.m_color_offsets[c] : c * num_pairs;
+   }
+   ArrayT<IndexT> class_offsets_data(num_classes + 1, num_classes + 1, cs->getAllocatorId());
+   axom::copy(class_offsets_data.data(), pair_offsets_host.data(), (num_classes + 1) * sizeof(IndexT));
+   ArrayViewT<IndexT> class_offsets = class_offsets_data;
+   forAllExec(cs->getExecutionMode(), num_classes + 1,
+      [offsets, class_offsets] TRIBOL_HOST_DEVICE (IndexT c)
+      {
+         class_offsets[c] = offsets[class_offsets[c]];
+      }
+   );
+   ArrayT<IndexT, 1, MemorySpace::Host> class_offsets_host(class_offsets_data);
+
+   for (IndexT c{0}; c < num_classes; ++c)
+   {
+      const IndexT class_begin = class_offsets_host[c];
+      ApplyCommonPlanePenaltyBin( cs, ArrayViewT<const IndexT>(plane_ids_data.data() + class_begin, 
+                                                               class_offsets_host[c+1] - class_begin),
+                                  colored, err, neg_thickness );
+   }
   
    ArrayT<bool, 1, MemorySpace::Host> neg_thickness_host(neg_thickness_data);
    SLIC_DEBUG_IF(neg_thickness_host[0], "ApplyNormal<COMMON_PLANE, PENALTY>: negative element thicknesses encountered.");
@@ -472,4 +659,97 @@ int ApplyNormal< COMMON_PLANE, PENALTY >( CouplingScheme* cs )
 
 } // end ApplyNormal<COMMON_PLANE, PENALTY>()
 
+//------------------------------------------------------------------------------
+std::vector<int> ApplyCommonPlanePenaltyBatched( const std::vector<CouplingScheme*>& schemes,
+                                                 ArrayViewT<const IndexT> plane_offsets,
+                                                 IndexT num_planes )
+{
+   const IndexT num_schemes = static_cast<IndexT>(schemes.size());
+   if (num_schemes == 0)
+   {
+      return {};
+   }
+
+   const auto& cs0 = *schemes[0];
+   const ExecutionMode exec_mode = cs0.getExecutionMode();
+   const int allocator_id = cs0.getAllocatorId();
+
+   ArrayT<BatchedPenaltyScheme, 1, MemorySpace::Host> schemes_host(0, num_schemes);
+   for (auto cs : schemes)
+   {
+      schemes_host.push_back( BatchedPenaltyScheme{ cs->getView(), 
+         cs->getEnforcementOptions().penalty_options.rate_calculation } );
+   }
+   BatchedPenaltyScheme* batch = axom::allocate<BatchedPenaltyScheme>(num_schemes, allocator_id);
+   axom::copy(batch, schemes_host.data(), num_schemes * sizeof(BatchedPenaltyScheme));
+
+   ArrayT<int> err_data(num_schemes, num_schemes, allocator_id);
+   err_data.fill(0);
+   ArrayViewT<int> err = err_data;
+   ArrayT<bool> neg_thickness_data(num_schemes, num_schemes, allocator_id);
+   neg_thickness_data.fill(false);
+   ArrayViewT<bool> neg_thickness = neg_thickness_data;
+
+   // flag the planes of the batch that violate the gap constraint, as in 
+   // ApplyNormal<COMMON_PLANE, PENALTY>()
+   ArrayT<IndexT> in_contact_data(num_planes + 1, num_planes + 1, allocator_id);
+   ArrayViewT<IndexT> in_contact = in_contact_data;
+   forAllExec(exec_mode, num_planes + 1,
+      [batch, plane_offsets, num_schemes, num_planes, in_contact] TRIBOL_HOST_DEVICE (IndexT k)
+      {
+         in_contact[k] = 0;
+         if (k == num_planes)
+         {
+            return;
+         }
+         const IndexT s = findBatchScheme( plane_offsets, num_schemes, k );
+         const auto& cs_view = batch[s].cs;
+         auto& plane = cs_view.getContactPlane(k - plane_offsets[s]);
+         if ( plane.m_gap > cs_view.getGapTol( plane.getCpElementId1(), plane.getCpElementId2() ) )
+         {
+            plane.m_inContact = false;
+            return;
+         }
+         in_contact[k] = 1;
+      }
+   );
+
+   // compact the penetrating planes of the batch
+   ArrayT<IndexT> offsets_data(num_planes + 1, num_planes + 1, allocator_id);
+   ArrayViewT<IndexT> offsets = offsets_data;
+   exclusiveScanExec(exec_mode, num_planes + 1, in_contact_data.data(), offsets_data.data());
+   IndexT num_in_contact = 0;
+   axom::copy(&num_in_contact, offsets_data.data() + num_planes, sizeof(IndexT));
+   ArrayT<IndexT> plane_ids_data(num_in_contact, num_in_contact, allocator_id);
+   ArrayViewT<IndexT> plane_ids = plane_ids_data;
+   forAllExec(exec_mode, num_planes,
+      [in_contact, offsets, plane_ids] TRIBOL_HOST_DEVICE (IndexT k)
+      {
+         if (in_contact[k])
+         {
+            plane_ids[offsets[k]] = k;
+         }
+      }
+   );
+
+   ApplyCommonPlanePenaltyBatch( cs0, batch, plane_offsets, 
+                                 ArrayViewT<const IndexT>(plane_ids_data.data(), num_in_contact),
+                                 err, neg_thickness );
+
+   axom::deallocate(batch);
+
+   // a single read back for the whole batch
+   ArrayT<int, 1, MemorySpace::Host> err_host(err_data);
+   ArrayT<bool, 1, MemorySpace::Host> neg_thickness_host(neg_thickness_data);
+   std::vector<int> scheme_err(num_schemes);
+   for (IndexT s{0}; s < num_schemes; ++s)
+   {
+      SLIC_DEBUG_IF(neg_thickness_host[s], "ApplyCommonPlanePenaltyBatched: negative element " <<
+                    "thicknesses encountered in coupling scheme " << schemes[s]->getId() << ".");
+      scheme_err[s] = err_host[s];
+   }
+   return scheme_err;
+
+} // end ApplyCommonPlanePenaltyBatched()
+
 }
@@ -8,6 +8,10 @@
 
 #include "Physics.hpp"
 
+#include "tribol/common/ArrayTypes.hpp"
+
+#include <vector>
+
 namespace tribol
 {
 /*!
@@ -26,6 +30,23 @@ namespace tribol
 TRIBOL_HOST_DEVICE RealT ComputePenaltyStiffnessPerArea( const RealT K1_over_t1,
                                                          const RealT K2_over_t2 );
 
+/*!
+ *
+ * \brief applies penalty contact between the first mesh and an analytic rigid 
+ *        surface registered as the second mesh
+ *
+ * \param [in] cs pointer to the coupling scheme
+ *
+ * \return 0 if no error
+ *
+ * \note Each face node of the first mesh is tested against the rigid surface 
+ *       with a signed distance query and carries an equal share of its face 
+ *       area. The rigid surface is treated as infinitely stiff, so the penalty 
+ *       stiffness is that of the deformable face.
+ *
+ */
+int ApplyRigidSurfacePenalty( CouplingScheme* cs );
+
 /*!
  *
  * \brief routine to apply interface physics in the direction normal to the interface
@@ -38,6 +59,29 @@ TRIBOL_HOST_DEVICE RealT ComputePenaltyStiffnessPerArea( const RealT K1_over_t1,
 template< >
 int ApplyNormal< COMMON_PLANE, PENALTY >( CouplingScheme* cs );
 
+/*!
+ *
+ * \brief applies the common plane penalty enforcement of a batch of coupling 
+ *        schemes in one pass over the contact planes of the batch
+ *
+ * \param [in] schemes coupling schemes in the batch
+ * \param [in] plane_offsets per-scheme offsets into the contact planes of the 
+ *             batch (size schemes.size() + 1, in the memory space of the batch)
+ * \param [in] num_planes total number of contact planes in the batch
+ *
+ * \return error code of each coupling scheme (0 if no error)
+ *
+ * \pre the coupling schemes pass canBatchPhysics()
+ *
+ * \note Equivalent to ApplyNormal<COMMON_PLANE, PENALTY>() on each coupling 
+ *       scheme without pair coloring. The nodal forces are scattered with 
+ *       atomics, since the planes of different coupling schemes may share nodes.
+ *
+ */
+std::vector<int> ApplyCommonPlanePenaltyBatched( const std::vector<CouplingScheme*>& schemes,
+                                                 ArrayViewT<const IndexT> plane_offsets,
+                                                 IndexT num_planes );
+
 } // end namespace tribol
 
 #endif /* SRC_PHYSICS_COMMONPLANE_HPP_ */
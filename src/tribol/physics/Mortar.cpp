@@ -173,7 +173,7 @@ void ComputeNodalGap< SINGLE_MORTAR >( SurfaceContactElem & elem )
 } // end ComputeNodalGap<>()
 
 //------------------------------------------------------------------------------
-void ComputeSingleMortarGaps( CouplingScheme* cs )
+void ComputeSingleMortarGaps( CouplingScheme* cs, ArrayT<RealT>* mortar_wts )
 {
    MeshManager& meshManager = MeshManager::getInstance();
    MeshData& nonmortarMeshData = meshManager.at( cs->getMeshId2() );
@@ -196,22 +196,19 @@ void ComputeSingleMortarGaps( CouplingScheme* cs )
 
    IndexT const numNodesPerFace = mortarMesh.numberOfNodesPerElement();
 
-   RealT const * const x1 = mortarMesh.getPosition()[0].data();
-   RealT const * const y1 = mortarMesh.getPosition()[1].data(); 
-   RealT const * const z1 = mortarMesh.getPosition()[2].data(); 
-   IndexT const * const mortarConn= mortarMesh.getConnectivity().data();
-
-   RealT const * const x2 = nonmortarMesh.getPosition()[0].data(); 
-   RealT const * const y2 = nonmortarMesh.getPosition()[1].data();
-   RealT const * const z2 = nonmortarMesh.getPosition()[2].data();
-   IndexT const * nonmortarConn = nonmortarMesh.getConnectivity().data();
-
    // declare local variables to hold face nodal coordinates
    // and overlap vertex coordinates
    IndexT size = dim * numNodesPerFace;
    RealT mortarX[ size ];
    RealT nonmortarX[ size ];
 
+   // stacked nonmortar-nonmortar and mortar-nonmortar weights of each plane
+   IndexT const numWts = 2 * numNodesPerFace * numNodesPerFace;
+   if (mortar_wts != nullptr)
+   {
+      mortar_wts->resize( cs->getNumActivePairs() * numWts );
+   }
+
    ////////////////////////////////////////////////////////////////////
    // compute nonmortar gaps to determine active set of contact dofs //
    ////////////////////////////////////////////////////////////////////
@@ -233,19 +230,8 @@ void ComputeSingleMortarGaps( CouplingScheme* cs )
 
       // populate the current configuration nodal coordinates for the 
       // two faces
-      for (int i=0; i<numNodesPerFace; ++i)
-      {
-         int id = dim * i;
-         IndexT mortar_id = mortarConn[ numNodesPerFace * index1 + i ];
-         IndexT nonmortar_id  = nonmortarConn[ numNodesPerFace * index2 + i ];
-
-         mortarX[ id ]   = x1[ mortar_id ];
-         mortarX[ id+1 ] = y1[ mortar_id ];
-         mortarX[ id+2 ] = z1[ mortar_id ];
-         nonmortarX[ id ]   = x2[ nonmortar_id ];
-         nonmortarX[ id+1 ] = y2[ nonmortar_id ];
-         nonmortarX[ id+2 ] = z2[ nonmortar_id ];
-      }
+      mortarMesh.getFaceCoords( index1, mortarX );
+      nonmortarMesh.getFaceCoords( index2, nonmortarX );
 
       // get projected face coordinates
       // stores projected coordinates in row-major format
@@ -300,6 +286,14 @@ void ComputeSingleMortarGaps( CouplingScheme* cs )
 
       ComputeNodalGap< SINGLE_MORTAR >( elem );
 
+      if (mortar_wts != nullptr)
+      {
+         for (IndexT i{0}; i < numWts; ++i)
+         {
+            (*mortar_wts)[ cpID * numWts + i ] = elem.mortarWts[i];
+         }
+      }
+
       // TODO: fix this to register the actual number of active nonmortar gaps.
       // This is not the appropriate data structure to put this information in 
       // as the SurfaceContactElem goes out of scope when we exit the loop.
@@ -313,6 +307,80 @@ void ComputeSingleMortarGaps( CouplingScheme* cs )
 
 } // end ComputeSingleMortarGaps()
 
+//------------------------------------------------------------------------------
+void ComputeSingleMortarResidual( CouplingScheme* cs, const ArrayT<RealT>& mortar_wts )
+{
+   auto pairs = cs->getInterfacePairs();
+   const IndexT numPairs = pairs.size();
+
+   auto mortarMesh = cs->getMesh1().getView();
+   auto nonmortarMesh = cs->getMesh2().getView();
+
+   IndexT const numNodesPerFace = mortarMesh.numberOfNodesPerElement();
+   IndexT const numWts = 2 * numNodesPerFace * numNodesPerFace;
+
+   const auto& fx1 = mortarMesh.getResponse()[0];
+   const auto& fy1 = mortarMesh.getResponse()[1]; 
+   const auto& fz1 = mortarMesh.getResponse()[2]; 
+   IndexT const * const mortarConn= mortarMesh.getConnectivity().data();
+
+   const auto& fx2 = nonmortarMesh.getResponse()[0]; 
+   const auto& fy2 = nonmortarMesh.getResponse()[1];
+   const auto& fz2 = nonmortarMesh.getResponse()[2];
+   IndexT const * nonmortarConn = nonmortarMesh.getConnectivity().data();
+
+   int cpID = 0;
+   for (IndexT kp = 0; kp < numPairs; ++kp)
+   {
+      auto& pair = pairs[kp];
+
+      if (!pair.m_is_contact_candidate)
+      {
+         continue;
+      }
+
+      IndexT index1 = pair.m_element_id1;
+      IndexT index2 = pair.m_element_id2;
+
+      // stacked weights: nonmortar-nonmortar followed by mortar-nonmortar
+      const RealT* nonmortarWts = &mortar_wts[ cpID * numWts ];
+      const RealT* mortarWts = nonmortarWts + numNodesPerFace * numNodesPerFace;
+
+      // same force assembly as ApplyNormal<SINGLE_MORTAR, LAGRANGE_MULTIPLIER>
+      for (int a=0; a<numNodesPerFace; ++a)
+      {
+         int mortarIdA = mortarConn[ index1 * numNodesPerFace + a];
+         int nonmortarIdA = nonmortarConn[ index2 * numNodesPerFace + a ];
+
+         for (int b=0; b<numNodesPerFace; ++b)
+         {
+            int nonmortarIdB = nonmortarConn[ index2 * numNodesPerFace + b ];
+
+            RealT forceX = nonmortarMesh.getNodalFields().m_node_pressure[ nonmortarIdB ] * 
+                          nonmortarMesh.getNodalNormals()[0][ nonmortarIdB ];
+            RealT forceY = nonmortarMesh.getNodalFields().m_node_pressure[ nonmortarIdB ] * 
+                          nonmortarMesh.getNodalNormals()[1][ nonmortarIdB ];
+            RealT forceZ = nonmortarMesh.getNodalFields().m_node_pressure[ nonmortarIdB ] * 
+                          nonmortarMesh.getNodalNormals()[2][ nonmortarIdB ];
+
+            RealT n_ab_mortar = mortarWts[ numNodesPerFace * a + b ];
+            RealT n_ab_nonmortar = nonmortarWts[ numNodesPerFace * a + b ];
+
+            fx1[ mortarIdA ] += forceX * n_ab_mortar;
+            fy1[ mortarIdA ] += forceY * n_ab_mortar; 
+            fz1[ mortarIdA ] += forceZ * n_ab_mortar; 
+
+            fx2[ nonmortarIdA ]  -= forceX * n_ab_nonmortar;
+            fy2[ nonmortarIdA ]  -= forceY * n_ab_nonmortar;
+            fz2[ nonmortarIdA ]  -= forceZ * n_ab_nonmortar;
+         }
+      }
+
+      ++cpID;
+   }
+
+} // end ComputeSingleMortarResidual()
+
 //------------------------------------------------------------------------------
 template< >
 int ApplyNormal< SINGLE_MORTAR, LAGRANGE_MULTIPLIER >( CouplingScheme* cs )
@@ -323,6 +391,24 @@ int ApplyNormal< SINGLE_MORTAR, LAGRANGE_MULTIPLIER >( CouplingScheme* cs )
    //                                                   //
    // Note, this routine is guarded against null meshes //
    ///////////////////////////////////////////////////////
+   const LagrangeMultiplierImplicitOptions& lm_options = 
+      cs->getEnforcementOptions().lm_implicit_options;
+
+   // gap and residual evaluations skip the Jacobian storage and the contact 
+   // element construction, reusing the mortar weights computed with the gaps
+   if ( lm_options.eval_mode == ImplicitEvalMode::MORTAR_GAP )
+   {
+      ComputeSingleMortarGaps( cs );
+      return 0;
+   }
+   if ( lm_options.eval_mode == ImplicitEvalMode::MORTAR_RESIDUAL )
+   {
+      ArrayT<RealT> mortar_wts;
+      ComputeSingleMortarGaps( cs, &mortar_wts );
+      ComputeSingleMortarResidual( cs, mortar_wts );
+      return 0;
+   }
+
    ComputeSingleMortarGaps( cs );
 
    auto pairs = cs->getInterfacePairs();
@@ -341,20 +427,18 @@ int ApplyNormal< SINGLE_MORTAR, LAGRANGE_MULTIPLIER >( CouplingScheme* cs )
 
    IndexT const numNodesPerFace = mortarMesh.numberOfNodesPerElement();
 
-   RealT * const fx1 = mortarMesh.getResponse()[0].data();
-   RealT * const fy1 = mortarMesh.getResponse()[1].data(); 
-   RealT * const fz1 = mortarMesh.getResponse()[2].data(); 
+   const auto& fx1 = mortarMesh.getResponse()[0];
+   const auto& fy1 = mortarMesh.getResponse()[1]; 
+   const auto& fz1 = mortarMesh.getResponse()[2]; 
    IndexT const * const mortarConn= mortarMesh.getConnectivity().data();
 
-   RealT * const fx2 = nonmortarMesh.getResponse()[0].data(); 
-   RealT * const fy2 = nonmortarMesh.getResponse()[1].data();
-   RealT * const fz2 = nonmortarMesh.getResponse()[2].data();
+   const auto& fx2 = nonmortarMesh.getResponse()[0]; 
+   const auto& fy2 = nonmortarMesh.getResponse()[1];
+   const auto& fz2 = nonmortarMesh.getResponse()[2];
    IndexT const * nonmortarConn = nonmortarMesh.getConnectivity().data();
 
    int numTotalNodes = cs->getNumTotalNodes();
    int numRows = dim * numTotalNodes + numTotalNodes;
-   const EnforcementOptions& enforcement_options = const_cast<EnforcementOptions&>(cs->getEnforcementOptions());
-   const LagrangeMultiplierImplicitOptions& lm_options  = enforcement_options.lm_implicit_options;
    if (!cs->nullMeshes())
    {
       if ( lm_options.sparse_mode == SparseMode::MFEM_ELEMENT_DENSE )
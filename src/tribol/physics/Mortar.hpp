@@ -41,9 +41,24 @@ void ComputeMortarWeights( SurfaceContactElem & elem );
  * \brief computes all of the nonmortar gaps to determine active set of contact constraints
  *
  * \param [in] cs pointer to coupling scheme
+ * \param [out] mortar_wts optional array storing the mortar weights of each active 
+ *              contact plane, in SurfaceContactElem order
  *
  */
-void ComputeSingleMortarGaps( CouplingScheme* cs );
+void ComputeSingleMortarGaps( CouplingScheme* cs, ArrayT<RealT>* mortar_wts = nullptr );
+
+/*!
+ *
+ * \brief computes the single mortar contact forces from stored mortar weights
+ *
+ * \param [in] cs pointer to coupling scheme
+ * \param [in] mortar_wts mortar weights of each active contact plane, as stored 
+ *             by ComputeSingleMortarGaps()
+ *
+ * \note No contact elements or Jacobian contributions are constructed.
+ *
+ */
+void ComputeSingleMortarResidual( CouplingScheme* cs, const ArrayT<RealT>& mortar_wts );
 
 /*!
  *
@@ -0,0 +1,259 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#include "NodeToSurface.hpp"
+#include "CommonPlane.hpp"
+
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/geom/ContactPlane.hpp"
+#include "tribol/common/Parameters.hpp"
+#include "tribol/integ/FE.hpp"
+#include "tribol/utils/Math.hpp"
+
+#include <limits>
+
+namespace tribol
+{
+
+//------------------------------------------------------------------------------
+template< >
+int ApplyNormal< NODE_TO_SURFACE, PENALTY >( CouplingScheme* cs )
+{
+   // A mesh 2 node may project into several mesh 1 faces and belongs to 
+   // several mesh 2 faces, so it may appear in many contact planes. To apply 
+   // its force exactly once, the planes are processed in passes:
+   //  1. find the smallest violating gap of each mesh 2 node,
+   //  2. find the lowest plane index attaining that gap for each node,
+   //  3. apply the force of each node from its owning plane.
+   auto cs_view = cs->getView();
+   const auto num_pairs = cs->getNumActivePairs();
+   const auto exec_mode = cs->getExecutionMode();
+   const IndexT num_nodes2 = cs->getMesh2().numberOfNodes();
+
+   ArrayT<int> err_data({0}, cs->getAllocatorId());
+   ArrayViewT<int> err = err_data;
+   ArrayT<bool> neg_thickness_data({false}, cs->getAllocatorId());
+   ArrayViewT<bool> neg_thickness = neg_thickness_data;
+
+   ArrayT<RealT> node_area_data(num_nodes2, num_nodes2, cs->getAllocatorId());
+   node_area_data.fill(0.0);
+   ArrayViewT<RealT> node_area = node_area_data;
+   ArrayT<RealT> node_gap_data(num_nodes2, num_nodes2, cs->getAllocatorId());
+   node_gap_data.fill(std::numeric_limits<RealT>::max());
+   ArrayViewT<RealT> node_gap = node_gap_data;
+   ArrayT<IndexT> node_plane_data(num_nodes2, num_nodes2, cs->getAllocatorId());
+   node_plane_data.fill(num_pairs);
+   ArrayViewT<IndexT> node_plane = node_plane_data;
+
+   /////////////////////////////////////////////////////////
+   // tributary area of each mesh 2 node (lumped equally) //
+   /////////////////////////////////////////////////////////
+   forAllExec(exec_mode, cs->getMesh2().numberOfElements(),
+      [cs_view, node_area] TRIBOL_HOST_DEVICE (IndexT f)
+      {
+         auto& mesh2 = cs_view.getMesh2View();
+         const IndexT num_nodes_per_face = mesh2.numberOfNodesPerElement();
+         const RealT A = mesh2.getElementAreas()[f] / num_nodes_per_face;
+         for (IndexT a{0}; a < num_nodes_per_face; ++a)
+         {
+#ifdef TRIBOL_USE_RAJA
+            RAJA::atomicAdd<RAJA::auto_atomic>(&node_area[mesh2.getGlobalNodeId(f, a)], A);
+#else
+            node_area[mesh2.getGlobalNodeId(f, a)] += A;
+#endif
+         }
+      }
+   );
+
+   ////////////////////////////////////////////
+   // pass 1: smallest violating nodal gaps  //
+   ////////////////////////////////////////////
+   forAllExec(exec_mode, num_pairs,
+      [cs_view, node_gap] TRIBOL_HOST_DEVICE (IndexT i)
+      {
+         auto& plane = cs_view.getContactPlane(i);
+         auto& mesh1 = cs_view.getMesh1View();
+         auto& mesh2 = cs_view.getMesh2View();
+
+         IndexT index1 = plane.getCpElementId1();
+         IndexT index2 = plane.getCpElementId2();
+         const int dim = mesh1.spatialDimension();
+
+         //  don't proceed for gaps that don't violate the constraints. This check 
+         //  allows for numerically zero interpenetration.
+         RealT gap_tol = cs_view.getGapTol( index1, index2 );
+
+         bool violated = false;
+         for (IndexT a{0}; a < mesh2.numberOfNodesPerElement(); ++a)
+         {
+            IndexT node_id = mesh2.getGlobalNodeId( index2, a );
+            RealT x[3];
+            RealT xp[3];
+            RealT gap {0.};
+            for (int d{0}; d < dim; ++d)
+            {
+               x[d] = mesh2.getPosition()[d][node_id];
+            }
+            if (ProjectNodeToFace( mesh1, index1, x, xp, gap ) && gap <= gap_tol)
+            {
+               violated = true;
+#ifdef TRIBOL_USE_RAJA
+               RAJA::atomicMin<RAJA::auto_atomic>(&node_gap[node_id], gap);
+#else
+               node_gap[node_id] = axom::utilities::min(node_gap[node_id], gap);
+#endif
+            }
+         }
+
+         // We are here if we have a pair that passes ALL geometric filter 
+         // checks, BUT does not actually violate this method's gap constraint.
+         plane.m_inContact = violated;
+      }
+   );
+
+   ///////////////////////////////////////////
+   // pass 2: owning plane of each node     //
+   ///////////////////////////////////////////
+   forAllExec(exec_mode, num_pairs,
+      [cs_view, node_gap, node_plane] TRIBOL_HOST_DEVICE (IndexT i)
+      {
+         auto& plane = cs_view.getContactPlane(i);
+         if (!plane.m_inContact)
+         {
+            return;
+         }
+         auto& mesh1 = cs_view.getMesh1View();
+         auto& mesh2 = cs_view.getMesh2View();
+
+         IndexT index1 = plane.getCpElementId1();
+         IndexT index2 = plane.getCpElementId2();
+         const int dim = mesh1.spatialDimension();
+
+         for (IndexT a{0}; a < mesh2.numberOfNodesPerElement(); ++a)
+         {
+            IndexT node_id = mesh2.getGlobalNodeId( index2, a );
+            RealT x[3];
+            RealT xp[3];
+            RealT gap {0.};
+            for (int d{0}; d < dim; ++d)
+            {
+               x[d] = mesh2.getPosition()[d][node_id];
+            }
+            // the gap is recomputed identically, so exact comparison is safe
+            if (ProjectNodeToFace( mesh1, index1, x, xp, gap ) && gap == node_gap[node_id])
+            {
+#ifdef TRIBOL_USE_RAJA
+               RAJA::atomicMin<RAJA::auto_atomic>(&node_plane[node_id], i);
+#else
+               node_plane[node_id] = axom::utilities::min(node_plane[node_id], i);
+#endif
+            }
+         }
+      }
+   );
+
+   ///////////////////////////////////////////
+   // pass 3: nodal penalty forces          //
+   ///////////////////////////////////////////
+   forAllExec(exec_mode, num_pairs,
+      [cs_view, node_plane, node_area, err, neg_thickness] TRIBOL_HOST_DEVICE (IndexT i)
+      {
+         auto& plane = cs_view.getContactPlane(i);
+         if (!plane.m_inContact)
+         {
+            return;
+         }
+         auto& mesh1 = cs_view.getMesh1View();
+         auto& mesh2 = cs_view.getMesh2View();
+
+         IndexT index1 = plane.getCpElementId1();
+         IndexT index2 = plane.getCpElementId2();
+         const int dim = mesh1.spatialDimension();
+         const IndexT num_nodes_per_face1 = mesh1.numberOfNodesPerElement();
+
+         // gather each face's scaled spring stiffness, precomputed in 
+         // MeshData::computePenaltyData(). A negative stiffness results 
+         // from a negative element thickness.
+         RealT stiffness1 = mesh1.getFacePenaltyStiffness()[ index1 ];
+         RealT stiffness2 = mesh2.getFacePenaltyStiffness()[ index2 ];
+         if (stiffness1 < 0. || stiffness2 < 0.)
+         {
+            neg_thickness[0] = true;
+            err[0] = 1;
+         }
+         RealT penalty_stiff_per_area = ComputePenaltyStiffnessPerArea( stiffness1, stiffness2 );
+         plane.m_pressure = plane.m_gap * penalty_stiff_per_area;
+
+         constexpr int max_dim = 3;
+         constexpr int max_nodes_per_face = 4;
+         RealT xf1[ max_dim * max_nodes_per_face ];
+         mesh1.getFaceCoords( index1, xf1 );
+
+         // the force acts opposite the face 1 normal on face 1 (plane normal)
+         RealT nrml[max_dim];
+         nrml[0] = plane.m_nX;
+         nrml[1] = plane.m_nY;
+         nrml[2] = (dim == 3) ? plane.m_nZ : 0.;
+
+         for (IndexT a{0}; a < mesh2.numberOfNodesPerElement(); ++a)
+         {
+            IndexT node_id = mesh2.getGlobalNodeId( index2, a );
+            if (node_plane[node_id] != i)
+            {
+               continue;
+            }
+
+            RealT x[max_dim];
+            RealT xp[max_dim];
+            RealT gap {0.};
+            for (int d{0}; d < dim; ++d)
+            {
+               x[d] = mesh2.getPosition()[d][node_id];
+            }
+            ProjectNodeToFace( mesh1, index1, x, xp, gap );
+
+            // compute contact force (spring force)
+            RealT contact_force = gap * penalty_stiff_per_area * node_area[node_id];
+
+            // mesh 2 node
+            for (int d{0}; d < dim; ++d)
+            {
+#ifdef TRIBOL_USE_RAJA
+               RAJA::atomicAdd<RAJA::auto_atomic>(&mesh2.getResponse()[d][node_id], nrml[d] * contact_force);
+#else
+               mesh2.getResponse()[d][node_id] += nrml[d] * contact_force;
+#endif
+            }
+
+            // mesh 1 face nodes, weighted by the face 1 shape functions at the 
+            // projected node
+            for (IndexT b{0}; b < num_nodes_per_face1; ++b)
+            {
+               RealT phi {0.};
+               EvalBasis( xf1, xp[0], xp[1], (dim == 3) ? xp[2] : 0., 
+                          num_nodes_per_face1, b, phi );
+               IndexT node1 = mesh1.getGlobalNodeId( index1, b );
+               for (int d{0}; d < dim; ++d)
+               {
+#ifdef TRIBOL_USE_RAJA
+                  RAJA::atomicAdd<RAJA::auto_atomic>(&mesh1.getResponse()[d][node1], -nrml[d] * contact_force * phi);
+#else
+                  mesh1.getResponse()[d][node1] -= nrml[d] * contact_force * phi;
+#endif
+               }
+            }
+         } // end loop over face 2 nodes
+      }
+   );
+
+   ArrayT<bool, 1, MemorySpace::Host> neg_thickness_host(neg_thickness_data);
+   SLIC_DEBUG_IF(neg_thickness_host[0], "ApplyNormal<NODE_TO_SURFACE, PENALTY>: negative element thicknesses encountered.");
+
+   ArrayT<int, 1, MemorySpace::Host> err_host(err_data);
+   return err_host[0];
+
+} // end ApplyNormal<NODE_TO_SURFACE, PENALTY>()
+
+} // end namespace tribol
@@ -0,0 +1,36 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_PHYSICS_NODETOSURFACE_HPP_
+#define SRC_PHYSICS_NODETOSURFACE_HPP_
+
+#include "Physics.hpp"
+
+namespace tribol
+{
+
+/*!
+ *
+ * \brief routine to apply node-to-surface penalty contact in the direction 
+ *        normal to the interface
+ *
+ * \param [in] cs pointer to the coupling scheme
+ *
+ * \return 0 if no error
+ *
+ * \note Each mesh 2 node is penalized against the single mesh 1 face it 
+ *       penetrates deepest, with a force equal to the penalty stiffness per 
+ *       area times the gap times the node's tributary area. The reaction is 
+ *       distributed to the mesh 1 face nodes with the face shape functions 
+ *       evaluated at the projected node. Only the kinematic penalty is applied; 
+ *       gap-rate penalty options are ignored.
+ *
+ */
+template< >
+int ApplyNormal< NODE_TO_SURFACE, PENALTY >( CouplingScheme* cs );
+
+} // end namespace tribol
+
+#endif /* SRC_PHYSICS_NODETOSURFACE_HPP_ */
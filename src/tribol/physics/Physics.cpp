@@ -63,6 +63,18 @@ int ApplyInterfacePhysics( CouplingScheme* cs,
       } // end switch over enforcement method
       break; // end case COMMON_PLANE
 
+   case NODE_TO_SURFACE:
+      switch ( cs->getEnforcementMethod() )
+      {
+         case PENALTY:
+            err_nrml = ApplyNormal< NODE_TO_SURFACE, PENALTY >( cs );
+            // no tangential physics implemented yet
+            break;
+         default: 
+            break;
+      } // end switch over enforcement method
+      break; // end case NODE_TO_SURFACE
+
    case SINGLE_MORTAR :
       switch ( cs->getEnforcementMethod() )
       {
@@ -0,0 +1,231 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#include "AutoBinning.hpp"
+
+#include "tribol/common/ArrayTypes.hpp"
+#include "tribol/common/ExecModel.hpp"
+#include "tribol/common/LoopExec.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/MeshData.hpp"
+
+#include "axom/slic.hpp"
+
+namespace tribol
+{
+
+namespace
+{
+
+/// a trial method must be faster than this fraction of the current method's time
+constexpr RealT switch_ratio = 0.8;
+
+/// number of consecutive winning trials required to switch methods
+constexpr int switch_wins = 2;
+
+/// mesh 1 face count above which the grid's per-query bitsets become costly
+constexpr IndexT large_mesh_faces = 65536;
+
+/// ratio of largest to mean face radius above which the grid resolution is poor
+constexpr RealT size_spread_ratio = 4.;
+
+/*!
+ * \brief Fills the methods applicable to the coupling scheme and returns their 
+ *        count
+ *
+ * \note BINNING_CARTESIAN_PRODUCT is never selected since it fixes the binning 
+ *       after the first search.
+ */
+int getAutoBinningCandidates( const CouplingScheme& cs, BinningMethod* methods )
+{
+   if (isOnDevice(cs.getExecutionMode()))
+   {
+      methods[0] = BINNING_BVH;
+      methods[1] = BINNING_HASH_GRID;
+      return 2;
+   }
+
+   int num_methods = 0;
+   if (cs.spatialDimension() == 2 && 
+       cs.getMesh1().getElementType() == LINEAR_EDGE &&
+       cs.getMesh2().getElementType() == LINEAR_EDGE)
+   {
+      methods[num_methods++] = BINNING_SWEEP_AND_PRUNE;
+   }
+   methods[num_methods++] = BINNING_GRID;
+   methods[num_methods++] = BINNING_BVH;
+   methods[num_methods++] = BINNING_HASH_GRID;
+   return num_methods;
+}
+
+/*!
+ * \brief Chooses the binning method of the first search from mesh statistics
+ */
+BinningMethod getInitialBinningMethod( CouplingScheme& cs )
+{
+   if (isOnDevice(cs.getExecutionMode()))
+   {
+      return BINNING_BVH;
+   }
+
+   if (cs.spatialDimension() == 2 && 
+       cs.getMesh1().getElementType() == LINEAR_EDGE &&
+       cs.getMesh2().getElementType() == LINEAR_EDGE)
+   {
+      return BINNING_SWEEP_AND_PRUNE;
+   }
+
+   const IndexT num_faces1 = cs.getMesh1().numberOfElements();
+   if (num_faces1 == 0 || cs.getMesh2().numberOfElements() == 0)
+   {
+      return BINNING_GRID;
+   }
+
+   // only occupied cells are stored in the hashed grid
+   if (num_faces1 > large_mesh_faces)
+   {
+      return BINNING_HASH_GRID;
+   }
+
+   // the grid resolution is set from the mean face size of mesh 1, which 
+   // works poorly when face sizes vary widely
+   auto mesh1 = cs.getMesh1().getView();
+   ArrayT<RealT> radius_stats_data({0., 0.}, cs.getAllocatorId());
+   ArrayViewT<RealT> radius_stats = radius_stats_data;
+   forAllExec(cs.getExecutionMode(), num_faces1,
+      [mesh1, radius_stats] TRIBOL_HOST_DEVICE (IndexT i)
+      {
+         RealT r = mesh1.getFaceRadius()[i];
+#ifdef TRIBOL_USE_RAJA
+         RAJA::atomicAdd<RAJA::auto_atomic>(&radius_stats[0], r);
+         RAJA::atomicMax<RAJA::auto_atomic>(&radius_stats[1], r);
+#else
+         radius_stats[0] += r;
+         radius_stats[1] = axom::utilities::max(radius_stats[1], r);
+#endif
+      }
+   );
+   ArrayT<RealT, 1, MemorySpace::Host> radius_stats_host(radius_stats_data);
+   const RealT mean_radius = radius_stats_host[0] / num_faces1;
+
+   if (radius_stats_host[1] > size_spread_ratio * mean_radius)
+   {
+      return BINNING_BVH;
+   }
+
+   return BINNING_GRID;
+}
+
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+const char* getBinningMethodName( BinningMethod method )
+{
+   switch (method)
+   {
+      case BINNING_GRID:
+         return "BINNING_GRID";
+      case BINNING_CARTESIAN_PRODUCT:
+         return "BINNING_CARTESIAN_PRODUCT";
+      case BINNING_BVH:
+         return "BINNING_BVH";
+      case BINNING_SWEEP_AND_PRUNE:
+         return "BINNING_SWEEP_AND_PRUNE";
+      case BINNING_HASH_GRID:
+         return "BINNING_HASH_GRID";
+      case BINNING_AUTO:
+         return "BINNING_AUTO";
+      default:
+         return "UNKNOWN";
+   }
+} // end getBinningMethodName()
+
+//------------------------------------------------------------------------------
+BinningMethod selectAutoBinningMethod( CouplingScheme& cs )
+{
+   auto& data = cs.getAutoBinningData();
+   data.m_trial = BINNING_AUTO;
+
+   if (data.m_method == BINNING_AUTO)
+   {
+      data.m_method = getInitialBinningMethod( cs );
+      data.m_num_searches = 0;
+      SLIC_INFO("Coupling scheme " << cs.getId() << ": BINNING_AUTO selected " <<
+                getBinningMethodName( data.m_method ) << " (" << 
+                cs.getMesh1().numberOfElements() << " and " << 
+                cs.getMesh2().numberOfElements() << " faces).");
+      return data.m_method;
+   }
+
+   const int interval = cs.getParameters().auto_binning_interval;
+   ++data.m_num_searches;
+   if (interval <= 0 || data.m_num_searches < interval)
+   {
+      return data.m_method;
+   }
+   data.m_num_searches = 0;
+
+   // try the next alternative method in round-robin order
+   BinningMethod candidates[NUM_BINNING_METHODS];
+   const int num_candidates = getAutoBinningCandidates( cs, candidates );
+   for (int k{0}; k < num_candidates; ++k)
+   {
+      BinningMethod method = candidates[ data.m_next_trial++ % num_candidates ];
+      if (method != data.m_method)
+      {
+         data.m_trial = method;
+         return method;
+      }
+   }
+
+   return data.m_method;
+
+} // end selectAutoBinningMethod()
+
+//------------------------------------------------------------------------------
+void recordAutoBinningTime( CouplingScheme& cs, BinningMethod method, RealT seconds )
+{
+   auto& data = cs.getAutoBinningData();
+
+   // smooth the timings of each method to filter out noise
+   RealT& cost = data.m_cost[method];
+   cost = (cost < 0.) ? seconds : 0.5 * (cost + seconds);
+
+   if (data.m_trial != method || method == data.m_method)
+   {
+      return;
+   }
+   data.m_trial = BINNING_AUTO;
+
+   const RealT current_cost = data.m_cost[data.m_method];
+   if (current_cost > 0. && seconds < switch_ratio * current_cost)
+   {
+      ++data.m_wins[method];
+   }
+   else
+   {
+      data.m_wins[method] = 0;
+   }
+
+   SLIC_DEBUG("Coupling scheme " << cs.getId() << ": BINNING_AUTO trial of " <<
+              getBinningMethodName( method ) << " took " << seconds << " s (" <<
+              getBinningMethodName( data.m_method ) << ": " << current_cost << " s).");
+
+   if (data.m_wins[method] >= switch_wins)
+   {
+      SLIC_INFO("Coupling scheme " << cs.getId() << ": BINNING_AUTO switching from " <<
+                getBinningMethodName( data.m_method ) << " (" << current_cost << " s) to " <<
+                getBinningMethodName( method ) << " (" << cost << " s).");
+      data.m_method = method;
+      ++data.m_num_switches;
+      for (int i{0}; i < NUM_BINNING_METHODS; ++i)
+      {
+         data.m_wins[i] = 0;
+      }
+   }
+
+} // end recordAutoBinningTime()
+
+} // end namespace tribol
@@ -0,0 +1,77 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_SEARCH_AUTOBINNING_HPP_
+#define SRC_SEARCH_AUTOBINNING_HPP_
+
+#include "tribol/common/BasicTypes.hpp"
+#include "tribol/common/Parameters.hpp"
+
+namespace tribol
+{
+
+// Forward Declarations
+class CouplingScheme;
+
+/**
+ * @brief State of the binning method selection for BINNING_AUTO
+ *
+ * The first search uses a method chosen from mesh statistics. Every 
+ * auto_binning_interval searches, one of the other applicable methods is used 
+ * for a single (timed) search instead. The scheme switches to a method that is
+ * faster than the current method by a margin in two consecutive trials.
+ */
+struct AutoBinningData
+{
+public:
+
+   AutoBinningData()
+   {
+      for (int i{0}; i < NUM_BINNING_METHODS; ++i)
+      {
+         m_cost[i] = -1.;
+         m_wins[i] = 0;
+      }
+   }
+
+   BinningMethod m_method {BINNING_AUTO}; ///< Current method (BINNING_AUTO before the first search)
+   BinningMethod m_trial {BINNING_AUTO};  ///< Method tried in the current search (BINNING_AUTO if none)
+
+   RealT m_cost[NUM_BINNING_METHODS]; ///< Smoothed search time (seconds) of each method; negative if not yet timed
+   int m_wins[NUM_BINNING_METHODS];   ///< Consecutive trials in which a method beat the current method
+
+   int m_num_searches {0};  ///< Number of searches since the last trial
+   int m_next_trial {0};    ///< Round-robin counter over the alternative methods
+   int m_num_switches {0};  ///< Number of times the current method changed after the first search
+};
+
+/**
+ * @brief Returns the binning method to use for the next search of a coupling 
+ *        scheme registered with BINNING_AUTO
+ *
+ * @param [in,out] cs coupling scheme
+ *
+ * @return a concrete binning method (never BINNING_AUTO)
+ */
+BinningMethod selectAutoBinningMethod( CouplingScheme& cs );
+
+/**
+ * @brief Records the time of a search performed with the method returned by 
+ *        selectAutoBinningMethod() and switches methods if warranted
+ *
+ * @param [in,out] cs coupling scheme
+ * @param [in] method binning method used for the search
+ * @param [in] seconds wall time of the search (initialization and pair finding)
+ */
+void recordAutoBinningTime( CouplingScheme& cs, BinningMethod method, RealT seconds );
+
+/**
+ * @brief Returns the name of a binning method, e.g. "BINNING_GRID"
+ */
+const char* getBinningMethodName( BinningMethod method );
+
+} // end namespace tribol
+
+#endif /* SRC_SEARCH_AUTOBINNING_HPP_ */
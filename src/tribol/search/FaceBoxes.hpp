@@ -0,0 +1,85 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_SEARCH_FACEBOXES_HPP_
+#define SRC_SEARCH_FACEBOXES_HPP_
+
+#include "tribol/common/ArrayTypes.hpp"
+#include "tribol/common/BasicTypes.hpp"
+#include "tribol/common/ExecModel.hpp"
+#include "tribol/common/LoopExec.hpp"
+#include "tribol/mesh/MeshData.hpp"
+
+// Axom includes
+#include "axom/primal.hpp"
+
+namespace tribol
+{
+
+/*!
+ * \brief Computes the bounding box of a face, expanded by the effective face
+ * radius along the face normal
+ *
+ * \param [in] mesh mesh viewer; face data must be computed
+ * \param [in] face_id id of the face
+ *
+ * \return bounding box of the face
+ */
+template <int D>
+TRIBOL_HOST_DEVICE inline axom::primal::BoundingBox<RealT, D>
+computeFaceBBox( const MeshData::Viewer& mesh, IndexT face_id )
+{
+  using PointT = axom::primal::Point<RealT, D>;
+  using RayT = axom::primal::Ray<RealT, D>;
+  using VectorT = axom::primal::Vector<RealT, D>;
+
+  axom::primal::BoundingBox<RealT, D> box;
+  constexpr int max_nodes_per_elem = 4;
+  RealT xf[D * max_nodes_per_elem];
+  mesh.getFaceCoords(face_id, xf);
+  for (IndexT j{0}; j < mesh.numberOfNodesPerElement(); ++j)
+  {
+    box.addPoint( PointT(&xf[D*j]) );
+  }
+
+  // expand the box by the face radius in the +/- face normal directions
+  RealT vnorm[3];
+  mesh.getFaceNormal(face_id, vnorm);
+  VectorT outward_normal(vnorm);
+  VectorT inward_normal(vnorm);
+  inward_normal *= -1.0;  // this operation is available on device
+  RealT face_radius = mesh.getFaceRadius()[face_id];
+  PointT p0 = box.getCentroid();
+  box.addPoint( RayT(p0, outward_normal).at(face_radius) );
+  box.addPoint( RayT(p0, inward_normal).at(face_radius) );
+  return box;
+}
+
+/*!
+ * \brief Fills an array with the bounding box of each face of a mesh (see
+ * computeFaceBBox())
+ *
+ * \param [in] exec_mode execution mode of the loop over faces
+ * \param [out] boxes array of face bounding boxes
+ * \param [in] mesh mesh viewer; face data must be computed
+ *
+ * \pre boxes.size() == mesh.numberOfElements()
+ */
+template <int D>
+void buildMeshBBoxes( ExecutionMode exec_mode,
+                      ArrayT<axom::primal::BoundingBox<RealT, D>>& boxes,
+                      const MeshData::Viewer& mesh )
+{
+  auto boxes_view = boxes.view();
+  forAllExec(exec_mode, mesh.numberOfElements(),
+    [mesh, boxes_view] TRIBOL_HOST_DEVICE (IndexT i) {
+      boxes_view[i] = computeFaceBBox<D>(mesh, i);
+    }
+  );
+}
+
+} // end namespace tribol
+
+#endif /* SRC_SEARCH_FACEBOXES_HPP_ */
@@ -10,6 +10,8 @@
 #include "tribol/mesh/CouplingScheme.hpp"
 #include "tribol/mesh/MeshData.hpp"
 #include "tribol/mesh/InterfacePairs.hpp"
+#include "tribol/search/FaceBoxes.hpp"
+#include "tribol/search/SleepingFaces.hpp"
 #include "tribol/utils/Algorithm.hpp"
 #include "tribol/utils/Math.hpp"
 
@@ -17,6 +19,11 @@
 #include "axom/primal.hpp"
 #include "axom/spin.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 // Define some namespace aliases to help with axom usage
 namespace primal = axom::primal;
 namespace spin = axom::spin;
@@ -502,15 +509,12 @@ private:
   {
     BBox box;
 
+    constexpr int max_nodes_per_elem = 4;
+    RealT xf[D * max_nodes_per_elem];
+    mesh.getFaceCoords(eId, xf);
     for (int i{0}; i < mesh.numberOfNodesPerElement(); ++i)
     {
-      axom::primal::NumericArray<RealT, D> vert_array;
-      auto vert_id = mesh.getGlobalNodeId(eId, i);
-      for (int d{0}; d < D; ++d)
-      {
-        vert_array[d] = mesh.getPosition()[d][vert_id];
-      }
-      box.addPoint( PointT(vert_array) );
+      box.addPoint( PointT(&xf[D*i]) );
     }
 
     return box;
@@ -538,6 +542,789 @@ private:
 }; // End of GridSearch class definition
 
 
+///////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Sweep-and-prune helper class to compute the candidate pairs for a 2D
+ *        coupling scheme
+ *
+ * A SweepAndPruneSearch reduces each edge of both meshes to an interval along
+ * the coordinate axis in which the contact surfaces are most extended. The 
+ * intervals are sorted by their lower bound and swept in order, keeping a list
+ * of open intervals for each mesh. Each edge is paired with the open edges of 
+ * the other mesh and the pair is passed to the geometry filter. Since 2D 
+ * contact surfaces are curves, only a few intervals are open at once and the 
+ * search cost is dominated by the sort.
+ *
+ * \pre Both meshes are LINEAR_EDGE meshes
+ */
+class SweepAndPruneSearch : public SearchBase
+{
+public:
+  /*!
+   * Constructs a SweepAndPruneSearch instance over CouplingScheme \a couplingScheme
+   * \pre couplingScheme is not null
+   */
+  SweepAndPruneSearch( CouplingScheme* couplingScheme )
+    : m_coupling_scheme( couplingScheme )
+  {}
+
+  void initialize() override
+  {
+    m_coupling_scheme->getInterfacePairs().clear();
+  }
+
+  void findInterfacePairs() override
+  {
+    const auto mesh1 = m_coupling_scheme->getMesh1().getView();
+    const auto mesh2 = m_coupling_scheme->getMesh2().getView();
+    auto& contactPairs = m_coupling_scheme->getInterfacePairs();
+
+    // the meshes are swept as one if the coupling scheme is symmetric
+    const bool is_symm = (mesh1.meshId() == mesh2.meshId());
+    const IndexT num_elems1 = mesh1.numberOfElements();
+    const IndexT num_elems2 = is_symm ? 0 : mesh2.numberOfElements();
+    if (num_elems1 == 0 || (!is_symm && num_elems2 == 0))
+    {
+      return;
+    }
+
+    // sweep along the axis of largest extent of the edge centroids
+    RealT c_min[2] = { std::numeric_limits<RealT>::max(), std::numeric_limits<RealT>::max() };
+    RealT c_max[2] = { std::numeric_limits<RealT>::lowest(), std::numeric_limits<RealT>::lowest() };
+    auto add_centroids = [&c_min, &c_max](const MeshData::Viewer& mesh, IndexT num_elems)
+    {
+      for (IndexT e{0}; e < num_elems; ++e)
+      {
+        for (int d{0}; d < 2; ++d)
+        {
+          c_min[d] = axom::utilities::min(c_min[d], mesh.getElementCentroids()[d][e]);
+          c_max[d] = axom::utilities::max(c_max[d], mesh.getElementCentroids()[d][e]);
+        }
+      }
+    };
+    add_centroids(mesh1, num_elems1);
+    add_centroids(mesh2, num_elems2);
+    const int axis = (c_max[1] - c_min[1] > c_max[0] - c_min[0]) ? 1 : 0;
+
+    // geomFilter() rejects edge pairs with centroid distances beyond 1.01 times
+    // the sum of the edge half-lengths. intervals centered on the edge centroid
+    // with a (slightly larger) half-width of 0.51 times the edge length 
+    // therefore overlap for every pair that can pass the filter.
+    const IndexT num_intervals = num_elems1 + num_elems2;
+    ArrayT<Interval, 1, MemorySpace::Host> intervals(0, num_intervals);
+    auto add_intervals = [&intervals, axis](const MeshData::Viewer& mesh, IndexT num_elems, int side)
+    {
+      for (IndexT e{0}; e < num_elems; ++e)
+      {
+        RealT c = mesh.getElementCentroids()[axis][e];
+        RealT half_width = 0.51 * mesh.getElementAreas()[e];
+        intervals.push_back( Interval{ c - half_width, c + half_width, e, side } );
+      }
+    };
+    add_intervals(mesh1, num_elems1, 0);
+    add_intervals(mesh2, num_elems2, 1);
+
+    std::sort(intervals.data(), intervals.data() + num_intervals,
+      [](const Interval& a, const Interval& b)
+      {
+        if (a.lo != b.lo) { return a.lo < b.lo; }
+        if (a.side != b.side) { return a.side < b.side; }
+        return a.elem < b.elem;
+      }
+    );
+
+    // sweep, keeping the open intervals of each mesh
+    ArrayT<IndexT, 1, MemorySpace::Host> open[2] = { ArrayT<IndexT, 1, MemorySpace::Host>(0, 16),
+                                                     ArrayT<IndexT, 1, MemorySpace::Host>(0, 16) };
+    const ContactMode cmode = m_coupling_scheme->getContactMode();
+    const bool auto_contact_check = m_coupling_scheme->getParameters().auto_contact_check;
+    for (IndexT k{0}; k < num_intervals; ++k)
+    {
+      const Interval& cur = intervals[k];
+      const int other = is_symm ? 0 : 1 - cur.side;
+
+      // prune intervals that close before the current interval opens
+      IndexT num_open = 0;
+      for (IndexT i{0}; i < open[other].size(); ++i)
+      {
+        if (intervals[open[other][i]].hi >= cur.lo)
+        {
+          open[other][num_open++] = open[other][i];
+        }
+      }
+      open[other].resize(num_open);
+
+      for (IndexT i{0}; i < num_open; ++i)
+      {
+        const Interval& prev = intervals[open[other][i]];
+        IndexT fromIdx = (cur.side == 0) ? cur.elem : prev.elem;
+        IndexT toIdx = (cur.side == 0) ? prev.elem : cur.elem;
+        if (is_symm)
+        {
+          // match the pair ordering of the other symmetric searches
+          fromIdx = axom::utilities::max(cur.elem, prev.elem);
+          toIdx = axom::utilities::min(cur.elem, prev.elem);
+        }
+
+        if (geomFilter( fromIdx, toIdx, mesh1, mesh2, cmode, auto_contact_check ))
+        {
+          contactPairs.emplace_back( fromIdx, toIdx, true );
+        }
+      }
+
+      open[cur.side].push_back(k);
+    }
+
+    SLIC_INFO("Sweep and prune found " << contactPairs.size() << " pairs sweeping along axis "
+              << axis << ".");
+
+  } // end findInterfacePairs()
+
+private:
+  /// Extent of an edge along the sweep axis
+  struct Interval
+  {
+    RealT lo;
+    RealT hi;
+    IndexT elem;
+    int side;
+  };
+
+  CouplingScheme* m_coupling_scheme;
+
+}; // End of SweepAndPruneSearch class definition
+
+///////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Spatial hash grid helper class to compute the candidate pairs for a 
+ *        coupling scheme
+ *
+ * A HashGridSearch bins the bounding boxes of the elements of the first mesh
+ * in a uniform grid whose cell size is the (approximate) median box extent. 
+ * Only occupied cells are stored: cells are hashed into a table of buckets and
+ * the (element, cell) entries of each bucket are stored contiguously (CSR), 
+ * ordered with a counting sort. For each element of the second mesh, the 
+ * buckets of the cells overlapped by its bounding box are visited and the 
+ * elements whose boxes overlap are passed to the geometry filter. A pair is 
+ * reported from the lowest cell shared by both boxes only, so each pair is 
+ * found once.
+ *
+ * Boxes with an extent above large_box_ratio cells would cover many cells. 
+ * Such boxes of the first mesh are not binned and are checked against every
+ * query; such boxes of the second mesh are checked against every element of 
+ * the first mesh.
+ *
+ * Unlike GridSearch, the memory and query cost do not depend on the number of
+ * elements in a slab of the grid, and all kernels run in the coupling scheme's
+ * execution mode.
+ *
+ * \tparam D The spatial dimension of the coupling scheme mesh vertices.
+ */
+template<int D>
+class HashGridSearch : public SearchBase
+{
+public:
+  /*!
+   * Constructs a HashGridSearch instance over CouplingScheme \a couplingScheme
+   * \pre couplingScheme is not null
+   */
+  HashGridSearch( CouplingScheme* couplingScheme )
+    : m_coupling_scheme( couplingScheme )
+    , m_mesh1( couplingScheme->getMesh1().getView() )
+    , m_mesh2( couplingScheme->getMesh2().getView() )
+  {}
+
+  /*!
+   * Computes the element bounding boxes and builds the hashed grid over the 
+   * elements of the first mesh
+   */
+  void initialize() override
+  {
+    m_coupling_scheme->getInterfacePairs().clear();
+    m_grid.num_buckets = 0;
+
+    // if either mesh is empty, there won't be any pairs
+    const IndexT num_elems1 = m_mesh1.numberOfElements();
+    const IndexT num_elems2 = m_mesh2.numberOfElements();
+    if (num_elems1 == 0 || num_elems2 == 0)
+    {
+      return;
+    }
+
+    const auto exec_mode = m_coupling_scheme->getExecutionMode();
+    const int allocator_id = m_coupling_scheme->getAllocatorId();
+
+    m_boxes1 = ArrayT<RealT>(2 * D * num_elems1, 2 * D * num_elems1, allocator_id);
+    m_boxes2 = ArrayT<RealT>(2 * D * num_elems2, 2 * D * num_elems2, allocator_id);
+    buildMeshBoxes( m_boxes1, m_mesh1 );
+    buildMeshBoxes( m_boxes2, m_mesh2 );
+
+    setGridSize();
+
+    // count the (element, cell) entries to size the hash table and gather the
+    // elements with boxes too large to bin
+    auto boxes1 = m_boxes1.view();
+    auto grid = m_grid;
+    ArrayT<IndexT> num_entries_data({0, 0}, allocator_id);
+    auto num_entries = num_entries_data.view();
+    m_large_elems1 = ArrayT<IndexT>(num_elems1, num_elems1, allocator_id);
+    auto large_elems1 = m_large_elems1.view();
+    forAllExec(exec_mode, num_elems1,
+      [boxes1, grid, num_entries, large_elems1] TRIBOL_HOST_DEVICE (IndexT i)
+      {
+        if (isLargeBox( &boxes1[2*D*i], grid ))
+        {
+#ifdef TRIBOL_USE_RAJA
+          auto idx = RAJA::atomicInc<RAJA::auto_atomic>(&num_entries[1]);
+#else
+          auto idx = num_entries[1]++;
+#endif
+          large_elems1[idx] = i;
+          return;
+        }
+        IndexT lo[D];
+        IndexT hi[D];
+        cellRange( &boxes1[2*D*i], grid, lo, hi );
+        IndexT num_cells = 1;
+        for (int d{0}; d < D; ++d)
+        {
+          num_cells *= hi[d] - lo[d] + 1;
+        }
+#ifdef TRIBOL_USE_RAJA
+        RAJA::atomicAdd<RAJA::auto_atomic>(&num_entries[0], num_cells);
+#else
+        num_entries[0] += num_cells;
+#endif
+      }
+    );
+    ArrayT<IndexT, 1, MemorySpace::Host> num_entries_host(num_entries_data);
+    const IndexT total_entries = num_entries_host[0];
+    m_large_elems1.resize(num_entries_host[1]);
+
+    // use a power of two number of buckets, at least twice the number of entries
+    IndexT num_buckets = 1;
+    while (num_buckets < 2 * total_entries)
+    {
+      num_buckets *= 2;
+    }
+    m_grid.num_buckets = num_buckets;
+    grid = m_grid;
+
+    // counting sort of the entries by bucket: count...
+    ArrayT<IndexT> bucket_counts_data(num_buckets + 1, num_buckets + 1, allocator_id);
+    bucket_counts_data.fill(0);
+    auto bucket_counts = bucket_counts_data.view();
+    forAllExec(exec_mode, num_elems1,
+      [boxes1, grid, bucket_counts] TRIBOL_HOST_DEVICE (IndexT i)
+      {
+        if (isLargeBox( &boxes1[2*D*i], grid ))
+        {
+          return;
+        }
+        IndexT lo[D];
+        IndexT hi[D];
+        cellRange( &boxes1[2*D*i], grid, lo, hi );
+        IndexT cell[D];
+        const IndexT num_cells = firstCell( lo, hi, cell );
+        for (IndexT k{0}; k < num_cells; ++k)
+        {
+#ifdef TRIBOL_USE_RAJA
+          RAJA::atomicAdd<RAJA::auto_atomic>(&bucket_counts[hashCell( cell, grid )], IndexT{1});
+#else
+          ++bucket_counts[hashCell( cell, grid )];
+#endif
+          nextCell( lo, hi, cell );
+        }
+      }
+    );
+
+    // ...scan (the extra zero count gives the total as the last offset)...
+    m_bucket_offsets = ArrayT<IndexT>(num_buckets + 1, num_buckets + 1, allocator_id);
+    exclusiveScanExec(exec_mode, num_buckets + 1, bucket_counts_data.data(), 
+                      m_bucket_offsets.data());
+
+    // ...and scatter. Each entry stores its element and cell so that elements 
+    // of other cells hashed to the same bucket can be skipped in the queries.
+    axom::copy(bucket_counts_data.data(), m_bucket_offsets.data(), num_buckets * sizeof(IndexT));
+    auto bucket_cursor = bucket_counts;
+    m_entry_elems = ArrayT<IndexT>(total_entries, total_entries, allocator_id);
+    m_entry_cells = ArrayT<IndexT>(D * total_entries, D * total_entries, allocator_id);
+    auto entry_elems = m_entry_elems.view();
+    auto entry_cells = m_entry_cells.view();
+    forAllExec(exec_mode, num_elems1,
+      [boxes1, grid, bucket_cursor, entry_elems, entry_cells] TRIBOL_HOST_DEVICE (IndexT i)
+      {
+        if (isLargeBox( &boxes1[2*D*i], grid ))
+        {
+          return;
+        }
+        IndexT lo[D];
+        IndexT hi[D];
+        cellRange( &boxes1[2*D*i], grid, lo, hi );
+        IndexT cell[D];
+        const IndexT num_cells = firstCell( lo, hi, cell );
+        for (IndexT k{0}; k < num_cells; ++k)
+        {
+#ifdef TRIBOL_USE_RAJA
+          auto idx = RAJA::atomicAdd<RAJA::auto_atomic>(&bucket_cursor[hashCell( cell, grid )], IndexT{1});
+#else
+          auto idx = bucket_cursor[hashCell( cell, grid )]++;
+#endif
+          entry_elems[idx] = i;
+          for (int d{0}; d < D; ++d)
+          {
+            entry_cells[D*idx + d] = cell[d];
+          }
+          nextCell( lo, hi, cell );
+        }
+      }
+    );
+  } // end initialize()
+
+  /*!
+   * Use the hashed grid to find candidates in first mesh for each
+   * element in second mesh of coupling scheme.
+   */
+  void findInterfacePairs() override
+  {
+    if (m_grid.num_buckets == 0)
+    {
+      return;
+    }
+
+    const auto exec_mode = m_coupling_scheme->getExecutionMode();
+    const int allocator_id = m_coupling_scheme->getAllocatorId();
+    const auto mesh1 = m_mesh1;
+    const auto mesh2 = m_mesh2;
+    const auto cmode = m_coupling_scheme->getContactMode();
+    const bool auto_contact_check = m_coupling_scheme->getParameters().auto_contact_check;
+    const bool same_mesh = (mesh1.meshId() == mesh2.meshId());
+    const auto grid = m_grid;
+    const auto boxes1 = m_boxes1.view();
+    const auto boxes2 = m_boxes2.view();
+    const auto bucket_offsets = m_bucket_offsets.view();
+    const auto entry_elems = m_entry_elems.view();
+    const auto entry_cells = m_entry_cells.view();
+    const auto large_elems1 = m_large_elems1.view();
+
+    // count the filtered pairs
+    ArrayT<IndexT> num_pairs_data({0}, allocator_id);
+    auto num_pairs = num_pairs_data.view();
+    forAllExec(exec_mode, mesh2.numberOfElements(),
+      [=] TRIBOL_HOST_DEVICE (IndexT j)
+      {
+        visitCandidates( j, grid, boxes1, boxes2, bucket_offsets, entry_elems, entry_cells,
+                         large_elems1,
+          [=] (IndexT i)
+          {
+            // if meshId1 = meshId2, then check to make sure i >= j 
+            // so we don't double count
+            if (same_mesh && i < j)
+            {
+              return;
+            }
+            if (geomFilter( i, j, mesh1, mesh2, cmode, auto_contact_check ))
+            {
+#ifdef TRIBOL_USE_RAJA
+              RAJA::atomicInc<RAJA::auto_atomic>(num_pairs.data());
+#else
+              ++num_pairs[0];
+#endif
+            }
+          }
+        );
+      }
+    );
+
+    ArrayT<IndexT, 1, MemorySpace::Host> num_pairs_host(num_pairs_data);
+    m_coupling_scheme->getInterfacePairs().resize(num_pairs_host[0]);
+    num_pairs_data.fill(0);
+
+    // add filtered pairs to interface pairs array
+    auto pairs_view = m_coupling_scheme->getInterfacePairs().view();
+    forAllExec(exec_mode, mesh2.numberOfElements(),
+      [=] TRIBOL_HOST_DEVICE (IndexT j)
+      {
+        visitCandidates( j, grid, boxes1, boxes2, bucket_offsets, entry_elems, entry_cells,
+                         large_elems1,
+          [=] (IndexT i)
+          {
+            if (same_mesh && i < j)
+            {
+              return;
+            }
+            if (geomFilter( i, j, mesh1, mesh2, cmode, auto_contact_check ))
+            {
+#ifdef TRIBOL_USE_RAJA
+              auto idx = RAJA::atomicInc<RAJA::auto_atomic>(num_pairs.data());
+#else
+              auto idx = num_pairs[0];
+              ++num_pairs[0];
+#endif
+              pairs_view[idx] = InterfacePair(i, j, true);
+            }
+          }
+        );
+      }
+    );
+  } // end findInterfacePairs()
+
+private:
+  /// Uniform grid parameters
+  struct GridSpec
+  {
+    RealT origin[D];    ///< Lower corner of the grid
+    RealT inv_h;        ///< Inverse of the cell size
+    RealT large_extent; ///< Boxes with a larger extent are not binned
+    IndexT num_buckets; ///< Number of hash buckets (a power of two)
+  };
+
+  /// Ratio of the extent of a box too large to bin to the cell size
+  static constexpr RealT large_box_ratio = 8.;
+
+  /// Number of logarithmic bins of the box extent histogram
+  static constexpr int num_extent_bins = 64;
+
+  /*!
+   * Computes the bounding box of each element, expanded in the element 
+   * normal direction by the element radius (as in BvhSearch). Boxes are 
+   * stored as [lo_0, ..., lo_D-1, hi_0, ..., hi_D-1].
+   */
+  void buildMeshBoxes( ArrayT<RealT>& boxes, const MeshData::Viewer& mesh )
+  {
+    auto boxes_view = boxes.view();
+    forAllExec(m_coupling_scheme->getExecutionMode(), mesh.numberOfElements(),
+      [mesh, boxes_view] TRIBOL_HOST_DEVICE (IndexT i)
+      {
+        RealT* box = &boxes_view[2*D*i];
+        constexpr int max_nodes_per_elem = 4;
+        RealT xf[D * max_nodes_per_elem];
+        mesh.getFaceCoords(i, xf);
+        for (int d{0}; d < D; ++d)
+        {
+          box[d] = xf[d];
+          box[D+d] = box[d];
+        }
+        for (IndexT a{1}; a < mesh.numberOfNodesPerElement(); ++a)
+        {
+          for (int d{0}; d < D; ++d)
+          {
+            box[d] = axom::utilities::min(box[d], xf[D*a + d]);
+            box[D+d] = axom::utilities::max(box[D+d], xf[D*a + d]);
+          }
+        }
+        // add the box center offset by the radius along +/- the normal
+        RealT nrml[3];
+        mesh.getFaceNormal(i, nrml);
+        const RealT radius = mesh.getFaceRadius()[i];
+        for (int d{0}; d < D; ++d)
+        {
+          const RealT center = 0.5 * (box[d] + box[D+d]);
+          const RealT offset = axom::utilities::abs(radius * nrml[d]);
+          box[d] = axom::utilities::min(box[d], center - offset);
+          box[D+d] = axom::utilities::max(box[D+d], center + offset);
+        }
+      }
+    );
+  }
+
+  /*!
+   * Sets the cell size to the median of the largest box extents of the first
+   * mesh and the grid origin to the lower corner of all boxes. The median is 
+   * approximated by the upper edge of its bin in a histogram of the extents 
+   * over logarithmic bins, so only the reductions and the histogram are 
+   * copied to the host.
+   */
+  void setGridSize()
+  {
+    const IndexT num_elems1 = m_mesh1.numberOfElements();
+    const IndexT num_elems2 = m_mesh2.numberOfElements();
+    const auto exec_mode = m_coupling_scheme->getExecutionMode();
+    const int allocator_id = m_coupling_scheme->getAllocatorId();
+    auto boxes1 = m_boxes1.view();
+    auto boxes2 = m_boxes2.view();
+
+    // lower corner of all boxes and smallest positive extent...
+    ArrayT<RealT> mins_data(D + 1, D + 1, allocator_id);
+    mins_data.fill(std::numeric_limits<RealT>::max());
+    auto mins = mins_data.view();
+    // ...and largest extent
+    ArrayT<RealT> max_extent_data({0.}, allocator_id);
+    auto max_extent = max_extent_data.view();
+    forAllExec(exec_mode, num_elems1,
+      [boxes1, mins, max_extent] TRIBOL_HOST_DEVICE (IndexT i)
+      {
+        const RealT* box = &boxes1[2*D*i];
+        const RealT extent = boxExtent( box );
+#ifdef TRIBOL_USE_RAJA
+        for (int d{0}; d < D; ++d)
+        {
+          RAJA::atomicMin<RAJA::auto_atomic>(&mins[d], box[d]);
+        }
+        if (extent > 0.)
+        {
+          RAJA::atomicMin<RAJA::auto_atomic>(&mins[D], extent);
+        }
+        RAJA::atomicMax<RAJA::auto_atomic>(max_extent.data(), extent);
+#else
+        for (int d{0}; d < D; ++d)
+        {
+          mins[d] = axom::utilities::min(mins[d], box[d]);
+        }
+        if (extent > 0.)
+        {
+          mins[D] = axom::utilities::min(mins[D], extent);
+        }
+        max_extent[0] = axom::utilities::max(max_extent[0], extent);
+#endif
+      }
+    );
+    forAllExec(exec_mode, num_elems2,
+      [boxes2, mins] TRIBOL_HOST_DEVICE (IndexT j)
+      {
+        for (int d{0}; d < D; ++d)
+        {
+#ifdef TRIBOL_USE_RAJA
+          RAJA::atomicMin<RAJA::auto_atomic>(&mins[d], boxes2[2*D*j + d]);
+#else
+          mins[d] = axom::utilities::min(mins[d], boxes2[2*D*j + d]);
+#endif
+        }
+      }
+    );
+    ArrayT<RealT, 1, MemorySpace::Host> mins_host(mins_data);
+    ArrayT<RealT, 1, MemorySpace::Host> max_extent_host(max_extent_data);
+
+    // cell indices are computed relative to the lower corner of all boxes
+    for (int d{0}; d < D; ++d)
+    {
+      m_grid.origin[d] = mins_host[d];
+    }
+
+    // degenerate boxes (a median extent of zero) use the largest extent
+    const RealT min_extent = mins_host[D];
+    RealT h = max_extent_host[0];
+    if (h > 0. && min_extent < h)
+    {
+      // bin 0 holds the zero extents, bins 1 to num_extent_bins the positive
+      // extents on a logarithmic scale between min_extent and h
+      const RealT log_ratio = std::log(h / min_extent);
+      ArrayT<IndexT> bin_counts_data(num_extent_bins + 1, num_extent_bins + 1, allocator_id);
+      bin_counts_data.fill(0);
+      auto bin_counts = bin_counts_data.view();
+      forAllExec(exec_mode, num_elems1,
+        [boxes1, bin_counts, min_extent, log_ratio] TRIBOL_HOST_DEVICE (IndexT i)
+        {
+          const RealT extent = boxExtent( &boxes1[2*D*i] );
+          IndexT bin = 0;
+          if (extent > 0.)
+          {
+            bin = 1 + static_cast<IndexT>(num_extent_bins * std::log(extent / min_extent) / log_ratio);
+            bin = axom::utilities::min(bin, static_cast<IndexT>(num_extent_bins));
+          }
+#ifdef TRIBOL_USE_RAJA
+          RAJA::atomicAdd<RAJA::auto_atomic>(&bin_counts[bin], IndexT{1});
+#else
+          ++bin_counts[bin];
+#endif
+        }
+      );
+      ArrayT<IndexT, 1, MemorySpace::Host> bin_counts_host(bin_counts_data);
+      IndexT count = 0;
+      for (IndexT bin{0}; bin <= num_extent_bins; ++bin)
+      {
+        count += bin_counts_host[bin];
+        if (count > num_elems1 / 2)
+        {
+          if (bin > 0)
+          {
+            h = min_extent * std::exp(log_ratio * bin / num_extent_bins);
+          }
+          break;
+        }
+      }
+    }
+    m_grid.inv_h = (h > 0.) ? 1. / h : 1.;
+    m_grid.large_extent = (h > 0.) ? large_box_ratio * h : std::numeric_limits<RealT>::max();
+  }
+
+  /// Returns the largest extent of a box
+  static TRIBOL_HOST_DEVICE RealT boxExtent( const RealT* box )
+  {
+    RealT extent = 0.;
+    for (int d{0}; d < D; ++d)
+    {
+      extent = axom::utilities::max(extent, box[D+d] - box[d]);
+    }
+    return extent;
+  }
+
+  /// Returns true if a box is too large to bin
+  static TRIBOL_HOST_DEVICE bool isLargeBox( const RealT* box, const GridSpec& grid )
+  {
+    return boxExtent( box ) > grid.large_extent;
+  }
+
+  /// Returns true if two boxes overlap
+  static TRIBOL_HOST_DEVICE bool boxesOverlap( const RealT* box1, const RealT* box2 )
+  {
+    bool overlap = true;
+    for (int d{0}; d < D; ++d)
+    {
+      overlap = overlap && box1[d] <= box2[D+d] && box2[d] <= box1[D+d];
+    }
+    return overlap;
+  }
+
+  /// Computes the range of cells overlapped by a box
+  static TRIBOL_HOST_DEVICE void cellRange( const RealT* box, const GridSpec& grid, 
+                                            IndexT* lo, IndexT* hi )
+  {
+    for (int d{0}; d < D; ++d)
+    {
+      lo[d] = static_cast<IndexT>(std::floor((box[d] - grid.origin[d]) * grid.inv_h));
+      hi[d] = static_cast<IndexT>(std::floor((box[D+d] - grid.origin[d]) * grid.inv_h));
+    }
+  }
+
+  /// Sets cell to the first cell of a cell range and returns the number of cells
+  static TRIBOL_HOST_DEVICE IndexT firstCell( const IndexT* lo, const IndexT* hi, IndexT* cell )
+  {
+    IndexT num_cells = 1;
+    for (int d{0}; d < D; ++d)
+    {
+      cell[d] = lo[d];
+      num_cells *= hi[d] - lo[d] + 1;
+    }
+    return num_cells;
+  }
+
+  /// Advances cell to the next cell of a cell range
+  static TRIBOL_HOST_DEVICE void nextCell( const IndexT* lo, const IndexT* hi, IndexT* cell )
+  {
+    for (int d{0}; d < D; ++d)
+    {
+      if (cell[d] < hi[d])
+      {
+        ++cell[d];
+        return;
+      }
+      cell[d] = lo[d];
+    }
+  }
+
+  /// Hashes cell coordinates to a bucket
+  static TRIBOL_HOST_DEVICE IndexT hashCell( const IndexT* cell, const GridSpec& grid )
+  {
+    const unsigned long long primes[3] = { 73856093ULL, 19349663ULL, 83492791ULL };
+    unsigned long long h = 0;
+    for (int d{0}; d < D; ++d)
+    {
+      h ^= static_cast<unsigned long long>(cell[d]) * primes[d];
+    }
+    return static_cast<IndexT>(h & static_cast<unsigned long long>(grid.num_buckets - 1));
+  }
+
+  /*!
+   * Calls func(i) once for each element i of the first mesh whose box 
+   * overlaps the box of element j of the second mesh
+   */
+  template <typename FUNC>
+  static TRIBOL_HOST_DEVICE void visitCandidates( IndexT j,
+                                                  const GridSpec& grid,
+                                                  const ArrayViewT<RealT>& boxes1,
+                                                  const ArrayViewT<RealT>& boxes2,
+                                                  const ArrayViewT<IndexT>& bucket_offsets,
+                                                  const ArrayViewT<IndexT>& entry_elems,
+                                                  const ArrayViewT<IndexT>& entry_cells,
+                                                  const ArrayViewT<IndexT>& large_elems1,
+                                                  FUNC&& func )
+  {
+    const RealT* box2 = &boxes2[2*D*j];
+
+    // a large box of the second mesh is checked against every element
+    if (isLargeBox( box2, grid ))
+    {
+      const IndexT num_elems1 = boxes1.size() / (2*D);
+      for (IndexT i{0}; i < num_elems1; ++i)
+      {
+        if (boxesOverlap( &boxes1[2*D*i], box2 ))
+        {
+          func(i);
+        }
+      }
+      return;
+    }
+
+    // the large boxes of the first mesh are not binned
+    for (IndexT k{0}; k < large_elems1.size(); ++k)
+    {
+      const IndexT i = large_elems1[k];
+      if (boxesOverlap( &boxes1[2*D*i], box2 ))
+      {
+        func(i);
+      }
+    }
+
+    IndexT lo2[D];
+    IndexT hi2[D];
+    cellRange( box2, grid, lo2, hi2 );
+
+    IndexT cell[D];
+    const IndexT num_cells = firstCell( lo2, hi2, cell );
+    for (IndexT k{0}; k < num_cells; ++k)
+    {
+      const IndexT b = hashCell( cell, grid );
+      for (IndexT e = bucket_offsets[b]; e < bucket_offsets[b+1]; ++e)
+      {
+        // skip entries of other cells hashed to this bucket
+        bool same_cell = true;
+        for (int d{0}; d < D; ++d)
+        {
+          same_cell = same_cell && (entry_cells[D*e + d] == cell[d]);
+        }
+        if (!same_cell)
+        {
+          continue;
+        }
+
+        const IndexT i = entry_elems[e];
+        const RealT* box1 = &boxes1[2*D*i];
+
+        // report the pair from the lowest cell shared by both boxes only
+        IndexT lo1[D];
+        IndexT hi1[D];
+        cellRange( box1, grid, lo1, hi1 );
+        bool first_cell = true;
+        for (int d{0}; d < D; ++d)
+        {
+          first_cell = first_cell && (cell[d] == axom::utilities::max(lo1[d], lo2[d]));
+        }
+        if (first_cell && boxesOverlap( box1, box2 ))
+        {
+          func(i);
+        }
+      }
+      nextCell( lo2, hi2, cell );
+    }
+  }
+
+  CouplingScheme* m_coupling_scheme;
+  const MeshData::Viewer m_mesh1;
+  const MeshData::Viewer m_mesh2;
+
+  GridSpec m_grid;
+  ArrayT<RealT> m_boxes1;          ///< Element boxes of the first mesh
+  ArrayT<RealT> m_boxes2;          ///< Element boxes of the second mesh
+  ArrayT<IndexT> m_bucket_offsets; ///< Offsets of the entries of each bucket
+  ArrayT<IndexT> m_entry_elems;    ///< Element of each entry, sorted by bucket
+  ArrayT<IndexT> m_entry_cells;    ///< Cell coordinates of each entry, sorted by bucket
+  ArrayT<IndexT> m_large_elems1;   ///< Elements of the first mesh with boxes too large to bin
+
+}; // End of HashGridSearch class definition
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /*!
@@ -558,9 +1345,6 @@ class BvhSearch : public SearchBase
 public:
   using BVHT = axom::spin::BVH<D, ExecSpace, RealT>;
   using BoxT = typename BVHT::BoxType;
-  using PointT = primal::Point<RealT, D>;
-  using RayT = primal::Ray<RealT, D>;
-  using VectorT = primal::Vector<RealT, D>;
   using AtomicPolicy = typename axom::execution_space<ExecSpace>::atomic_policy;
 
   /*!
@@ -598,14 +1382,22 @@ public:
   */
   void initialize() override
   {
-    buildMeshBBoxes(m_boxes1, m_coupling_scheme->getMesh1().getView());
-    buildMeshBBoxes(m_boxes2, m_coupling_scheme->getMesh2().getView());
+    auto exec_mode = m_coupling_scheme->getExecutionMode();
+    buildMeshBBoxes(exec_mode, m_boxes1, m_coupling_scheme->getMesh1().getView());
+    buildMeshBBoxes(exec_mode, m_boxes2, m_coupling_scheme->getMesh2().getView());
   } // end initialize()
    
 
   /*!
   * Use the BVH to find candidates in first mesh for each
   * element in second mesh of coupling scheme.
+  *
+  * With a candidate budget, the mesh 2 faces are queried in chunks. The first
+  * chunk holds at most 1/first_chunk_divisor of the faces (fewer if the 
+  * candidate density of the previous search asks for it), and each later chunk
+  * is sized from the candidate density of the chunks already queried, so the
+  * unfiltered candidate array of a chunk stays near the budget when the 
+  * density is stable.
   */
   void findInterfacePairs() override
   {
@@ -614,18 +1406,154 @@ public:
     bvh.setAllocatorID(m_coupling_scheme->getAllocatorId());
     bvh.initialize(m_boxes1.view(), m_boxes1.size());
 
-    // Search for intersecting bounding boxes
+    // Only the awake mesh 2 faces are queried when sleeping faces are enabled.
+    // Their boxes are inflated by the margin so isolated faces can be put to 
+    // sleep; the candidates are then checked against the un-inflated boxes.
+    const bool use_sleeping = useSleepingFaces(*m_coupling_scheme);
+    ArrayT<IndexT> query_faces_data(0, 0, m_coupling_scheme->getAllocatorId());
+    if (use_sleeping)
+    {
+      query_faces_data = wakeSleepingFaces(*m_coupling_scheme);
+    }
+    const IndexT num_queries = use_sleeping ? query_faces_data.size() 
+                                            : m_mesh2.numberOfElements();
+    ArrayViewT<const IndexT> query_faces(query_faces_data.data(), query_faces_data.size());
+
+    auto& budget_data = m_coupling_scheme->getPairBudgetData();
+    const IndexT budget = m_coupling_scheme->getParameters().candidate_budget;
+    IndexT chunk_size = num_queries;
+    if (budget > 0)
+    {
+      // the density of the previous search may not hold (and is unknown in
+      // the first search), so the first chunk is capped at a fixed fraction of
+      // the faces
+      if (budget_data.m_candidates_per_face > 0.)
+      {
+        chunk_size = chunkSize(budget, budget_data.m_candidates_per_face, num_queries);
+      }
+      const IndexT max_first_chunk = 
+        (num_queries + first_chunk_divisor - 1) / first_chunk_divisor;
+      chunk_size = axom::utilities::max(
+        axom::utilities::min(chunk_size, max_first_chunk), IndexT{1});
+    }
+
+    budget_data.m_num_query_chunks = 0;
+    budget_data.m_peak_candidates = 0;
+    IndexT num_candidates = 0;
+    m_coupling_scheme->getInterfacePairs().clear();
+    for (IndexT first{0}; first < num_queries; )
+    {
+      // chunk_size is resized below for the next chunk, so the loop advances
+      // by the size of the chunk just queried
+      const IndexT num_chunk = axom::utilities::min(chunk_size, num_queries - first);
+      queryChunk(bvh, query_faces, use_sleeping, first, num_chunk);
+      appendFilteredPairs(query_faces, use_sleeping, first);
+
+      num_candidates += m_candidates.size();
+      budget_data.m_peak_candidates = 
+        axom::utilities::max(budget_data.m_peak_candidates, m_candidates.size());
+      ++budget_data.m_num_query_chunks;
+
+      // size the next chunk from the candidate density of the queried chunks.
+      // without candidates so far, the chunk size is doubled.
+      if (budget > 0)
+      {
+        const IndexT num_queried = first + num_chunk;
+        chunk_size = (num_candidates > 0) ?
+          chunkSize(budget, static_cast<RealT>(num_candidates) / num_queried, num_queries) :
+          axom::utilities::min(2 * chunk_size, num_queries);
+      }
+      first += num_chunk;
+    }
+
+    if (num_queries > 0)
+    {
+      budget_data.m_candidates_per_face = static_cast<RealT>(num_candidates) / num_queries;
+    }
+  } // end findInterfacePairs()
+
+  /// The first query chunk holds at most 1/first_chunk_divisor of the faces
+  static constexpr IndexT first_chunk_divisor = 8;
+
+  /*!
+  * Returns the number of faces to query at once so the unfiltered candidates
+  * of a chunk stay near the budget if the given density holds
+  */
+  static IndexT chunkSize(IndexT budget, RealT candidates_per_face, IndexT num_queries)
+  {
+    const RealT chunk = static_cast<RealT>(budget) / candidates_per_face;
+    if (chunk >= static_cast<RealT>(num_queries))
+    {
+      return axom::utilities::max(num_queries, IndexT{1});
+    }
+    return axom::utilities::max(static_cast<IndexT>(chunk), IndexT{1});
+  }
+
+  /*!
+  * Queries the BVH with the boxes of entries [first, first + num_chunk) of 
+  * the query list (the awake faces with sleeping faces, otherwise all mesh 2
+  * faces) and fills m_offsets, m_counts, and m_candidates
+  */
+  void queryChunk(BVHT& bvh, ArrayViewT<const IndexT> query_faces, bool use_sleeping,
+                  IndexT first, IndexT num_chunk)
+  {
+    m_offsets.resize(num_chunk);
+    m_counts.resize(num_chunk);
+
+    // a single query over all faces uses the mesh 2 boxes directly
+    if (!use_sleeping && num_chunk == m_boxes2.size())
+    {
+      bvh.findBoundingBoxes(m_offsets.view(),
+                            m_counts.view(),
+                            m_candidates,
+                            num_chunk,
+                            m_boxes2.view());
+      return;
+    }
+
+    ArrayT<BoxT> query_boxes(num_chunk, num_chunk, m_coupling_scheme->getAllocatorId());
+    auto query_boxes_view = query_boxes.view();
+    auto boxes2_view = m_boxes2.view();
+    const RealT margin = m_coupling_scheme->getParameters().sleeping_face_margin;
+    forAllExec(m_coupling_scheme->getExecutionMode(), num_chunk,
+      [query_boxes_view, query_faces, boxes2_view, use_sleeping, first, margin] 
+      TRIBOL_HOST_DEVICE (IndexT q)
+      {
+        BoxT box = boxes2_view[use_sleeping ? query_faces[first + q] : first + q];
+        if (use_sleeping)
+        {
+          box.expand(margin);
+        }
+        query_boxes_view[q] = box;
+      }
+    );
     bvh.findBoundingBoxes(m_offsets.view(),
                           m_counts.view(),
                           m_candidates,
-                          m_mesh2.numberOfElements(),
-                          m_boxes2.view());
+                          num_chunk,
+                          query_boxes.view());
+
+    if (use_sleeping)
+    {
+      sleepIsolatedFaces(*m_coupling_scheme, query_faces, first,
+                         ArrayViewT<const IndexT>(m_counts.data(), num_chunk));
+    }
+  }
 
+  /*!
+  * Applies the geom filter to the candidates of a query chunk and appends the
+  * proximate pairs to the coupling scheme's interface pairs
+  */
+  void appendFilteredPairs(ArrayViewT<const IndexT> query_faces, bool use_sleeping, 
+                           IndexT first)
+  {
     // Apply geom filter to check if intersecting bounding boxes are proximate
     // Change candidate value to -1 if geom filter checks are failed
     auto counts_view = m_counts.view();
     auto offsets_view = m_offsets.view();
     auto candidates_view = m_candidates.view();
+    auto boxes1_view = m_boxes1.view();
+    auto boxes2_view = m_boxes2.view();
     // array of size 1 to track the number of candidates in a way compatible
     // with device kernels
     ArrayT<IndexT> filtered_candidates_data(1, 1, m_coupling_scheme->getAllocatorId());
@@ -637,11 +1565,17 @@ public:
     // count the number of filtered proximate pairs
     forAllExec(m_coupling_scheme->getExecutionMode(), m_candidates.size(),
       [mesh1, mesh2, offsets_view, counts_view, candidates_view, 
-        filtered_candidates, cmode, auto_contact_check] TRIBOL_HOST_DEVICE (IndexT i) 
+        filtered_candidates, cmode, auto_contact_check, use_sleeping,
+        query_faces, first, boxes1_view, boxes2_view] TRIBOL_HOST_DEVICE (IndexT i) 
       {
-        auto mesh1_elem = algorithm::binarySearch(offsets_view, counts_view, i);
+        auto query = algorithm::binarySearch(offsets_view, counts_view, i);
+        auto mesh1_elem = use_sleeping ? query_faces[first + query] : first + query;
         auto mesh2_elem = candidates_view[i];
-        if (geomFilter(mesh1_elem, mesh2_elem, mesh1, mesh2, cmode, auto_contact_check))
+        // candidates of the inflated query boxes must overlap the actual box
+        bool in_box = !use_sleeping || 
+                      boxes2_view[mesh1_elem].intersectsWith(boxes1_view[mesh2_elem]);
+        if (in_box && 
+            geomFilter(mesh1_elem, mesh2_elem, mesh1, mesh2, cmode, auto_contact_check))
         {
 #ifdef TRIBOL_USE_RAJA
           RAJA::atomicInc<AtomicPolicy>(filtered_candidates.data());
@@ -657,14 +1591,16 @@ public:
     );
 
     ArrayT<IndexT, 1, MemorySpace::Host> filtered_candidates_host( filtered_candidates_data );
-    m_coupling_scheme->getInterfacePairs().resize(filtered_candidates_host[0]);
+    auto& pairs = m_coupling_scheme->getInterfacePairs();
+    const IndexT num_prior_pairs = pairs.size();
+    pairs.resize(num_prior_pairs + filtered_candidates_host[0]);
     filtered_candidates_data.fill(0);
 
-    auto pairs_view = m_coupling_scheme->getInterfacePairs().view();
+    auto pairs_view = pairs.view();
     // add filtered pairs to interface pairs array
     forAllExec(m_coupling_scheme->getExecutionMode(), m_candidates.size(),
       [candidates_view, offsets_view, counts_view, filtered_candidates, 
-        pairs_view] TRIBOL_HOST_DEVICE (IndexT i)
+        pairs_view, num_prior_pairs, use_sleeping, query_faces, first] TRIBOL_HOST_DEVICE (IndexT i)
       {
         // Filtering removed this case
         if (candidates_view[i] == -1)
@@ -672,7 +1608,8 @@ public:
           return;
         }
         
-        auto mesh1_elem = algorithm::binarySearch(offsets_view, counts_view, i);
+        auto query = algorithm::binarySearch(offsets_view, counts_view, i);
+        auto mesh1_elem = use_sleeping ? query_faces[first + query] : first + query;
         auto mesh2_elem = candidates_view[i];
 
         // get unique index for the array
@@ -683,67 +1620,12 @@ public:
         ++filtered_candidates[0];
 #endif
 
-        pairs_view[idx] = InterfacePair(mesh1_elem, mesh2_elem, true);
-      }
-    );
-  } // end findInterfacePairs()
-
-  void buildMeshBBoxes(ArrayT<BoxT>& boxes, const MeshData::Viewer& mesh)
-  {
-    auto boxes1_view = boxes.view();
-    forAllExec(m_coupling_scheme->getExecutionMode(), mesh.numberOfElements(),
-      [this, mesh, boxes1_view] TRIBOL_HOST_DEVICE (IndexT i) {
-        BoxT box;
-        auto num_nodes_per_elem = mesh.numberOfNodesPerElement();
-        for(IndexT j{0}; j < num_nodes_per_elem; ++j)
-        {
-          IndexT node_id = mesh.getGlobalNodeId(i, j);
-          RealT pos[3];
-          pos[0] = mesh.getPosition()[0][node_id];
-          pos[1] = mesh.getPosition()[1][node_id];
-          pos[2] = mesh.getPosition()[2][node_id];  // unused if D==2
-          box.addPoint( PointT(pos) );
-        }
-        // Expand the bounding box in the face normal direction
-        RealT vnorm[3];
-        mesh.getFaceNormal(i, vnorm);
-        VectorT faceNormal(vnorm);
-        RealT faceRadius = mesh.getFaceRadius()[i];
-        expandBBoxNormal(box, faceNormal, faceRadius);
-        boxes1_view[i] = std::move(box);
+        pairs_view[num_prior_pairs + idx] = InterfacePair(mesh1_elem, mesh2_elem, true);
       }
     );
   }
 
 private:
-  /*!
-  * Expands bounding box by projecting the face normal by a distance 
-  * equal to the effective face radius
-  */
-  TRIBOL_HOST_DEVICE void expandBBoxNormal(BoxT& bbox, 
-                                          const VectorT& faceNormal, 
-                                          const RealT faceRadius)
-  {
-    PointT p0 = bbox.getCentroid();
-    RayT outwardRay(p0, faceNormal);
-    VectorT inwardNormal(faceNormal);
-    inwardNormal *= -1.0;  // this operation is available on device
-    RayT inwardRay(p0, inwardNormal);
-    PointT pout = outwardRay.at(faceRadius);
-    PointT pin = inwardRay.at(faceRadius);
-    bbox.addPoint(pout);
-    bbox.addPoint(pin);
-  }
-
-   /*!
-    * Isotropically expands bounding box by the effective face radius.
-    */
-   TRIBOL_HOST_DEVICE void inflateBBox(BoxT& bbox, 
-                                       const RealT faceRadius)
-   {
-      bbox.expand(faceRadius);
-   }
-
   CouplingScheme* m_coupling_scheme;
   const MeshData::Viewer m_mesh1;
   const MeshData::Viewer m_mesh2;
@@ -757,19 +1639,48 @@ private:
 ///////////////////////////////////////////////////////////////////////////////
 
 InterfacePairFinder::InterfacePairFinder(CouplingScheme* cs)
+   : InterfacePairFinder(cs, cs->getBinningMethod())
+{ }
+
+InterfacePairFinder::InterfacePairFinder(CouplingScheme* cs, BinningMethod method)
    : m_coupling_scheme(cs)
 {
    SLIC_ASSERT_MSG(cs != nullptr, "Coupling scheme was invalid (null pointer)");
    const int dim = m_coupling_scheme->spatialDimension();
    m_search = nullptr;
 
-   if (isOnDevice(cs->getExecutionMode()) && cs->getBinningMethod() == BINNING_GRID)
+   // fallbacks are stored on the coupling scheme unless the method is chosen 
+   // automatically
+   const bool store_fallback = (method == cs->getBinningMethod());
+
+   if (isOnDevice(cs->getExecutionMode()) && method == BINNING_GRID)
    {
       SLIC_WARNING_ROOT("BINNING_GRID is not supported on GPU. Switching to BINNING_BVH.");
-      cs->setBinningMethod(BINNING_BVH);
+      method = BINNING_BVH;
+   }
+
+   if (method == BINNING_SWEEP_AND_PRUNE)
+   {
+      if (isOnDevice(cs->getExecutionMode()))
+      {
+         SLIC_WARNING_ROOT("BINNING_SWEEP_AND_PRUNE is not supported on GPU. Switching to BINNING_BVH.");
+         method = BINNING_BVH;
+      }
+      else if (dim != 2 || cs->getMesh1().getElementType() != LINEAR_EDGE ||
+               cs->getMesh2().getElementType() != LINEAR_EDGE)
+      {
+         SLIC_WARNING_ROOT("BINNING_SWEEP_AND_PRUNE requires LINEAR_EDGE meshes. " <<
+                           "Switching to BINNING_GRID.");
+         method = BINNING_GRID;
+      }
+   }
+
+   if (store_fallback)
+   {
+      cs->setBinningMethod(method);
    }
 
-   switch(cs->getBinningMethod() )
+   switch( method )
    {
    case BINNING_CARTESIAN_PRODUCT:
       switch( dim )
@@ -861,8 +1772,26 @@ InterfacePairFinder::InterfacePairFinder(CouplingScheme* cs)
          break;
       } // end of BINNING_BVH dimension switch
       break;
+   case BINNING_SWEEP_AND_PRUNE:
+      m_search = new SweepAndPruneSearch(m_coupling_scheme);
+      break;
+   case BINNING_HASH_GRID:
+      // The hashed grid is templated on the dimension
+      switch( dim )
+      {
+      case 2:
+         m_search = new HashGridSearch<2>(m_coupling_scheme);
+         break;
+      case 3:
+         m_search = new HashGridSearch<3>(m_coupling_scheme);
+         break;
+      default:
+         SLIC_ERROR_ROOT("Invalid dimension: " << dim );
+         break;
+      } // end of BINNING_HASH_GRID dimension switch
+      break;
    default:
-      SLIC_ERROR_ROOT("Invalid binning method: " << cs->getBinningMethod() );
+      SLIC_ERROR_ROOT("Invalid binning method: " << method );
       break;
    }  // end of binning method switch
 }
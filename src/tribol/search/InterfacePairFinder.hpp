@@ -45,6 +45,12 @@ class InterfacePairFinder
 public:
    InterfacePairFinder(CouplingScheme* cs);
 
+   /*!
+    * Constructs a pair finder using the given binning method instead of the 
+    * coupling scheme's method (e.g. when the scheme uses BINNING_AUTO)
+    */
+   InterfacePairFinder(CouplingScheme* cs, BinningMethod method);
+
    ~InterfacePairFinder();
 
    /*!
@@ -0,0 +1,340 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#include "tribol/search/ProximityQuery.hpp"
+
+#include "tribol/common/LoopExec.hpp"
+#include "tribol/mesh/MeshData.hpp"
+#include "tribol/search/FaceBoxes.hpp"
+
+// Axom includes
+#include "axom/core.hpp"
+#include "axom/primal.hpp"
+#include "axom/slic.hpp"
+#include "axom/spin.hpp"
+
+// C/C++ includes
+#include <cmath>
+
+namespace primal = axom::primal;
+namespace spin = axom::spin;
+
+namespace tribol
+{
+
+/*!
+ * \brief Interface of the hierarchy over the faces of a mesh, independent of 
+ * dimension and execution space
+ */
+class ProximityQueryImpl
+{
+public:
+  virtual ~ProximityQueryImpl() = default;
+
+  virtual void build( const MeshData::Viewer& mesh ) = 0;
+
+  virtual void findFacesInBoxes( IndexT num_boxes,
+                                 const RealT* box_bounds,
+                                 ArrayT<IndexT>& offsets,
+                                 ArrayT<IndexT>& counts,
+                                 ArrayT<IndexT>& face_ids ) const = 0;
+
+  virtual void findClosestPoints( IndexT num_points,
+                                  const RealT* points,
+                                  RealT max_distance,
+                                  IndexT* face_ids,
+                                  RealT* closest_points,
+                                  RealT* distances ) const = 0;
+};
+
+namespace
+{
+
+/*!
+ * \brief Hierarchy over the face bounding boxes of a mesh
+ *
+ * \tparam D spatial dimension
+ * \tparam ExecSpace axom execution space of the BVH
+ */
+template <int D, typename ExecSpace>
+class BvhProximityQuery : public ProximityQueryImpl
+{
+public:
+  using BVHT = spin::BVH<D, ExecSpace, RealT>;
+  using BoxT = typename BVHT::BoxType;
+  using PointT = primal::Point<RealT, D>;
+  using TriangleT = primal::Triangle<RealT, D>;
+
+  BvhProximityQuery( ExecutionMode exec_mode, int allocator_id, const MeshData::Viewer& mesh )
+    : m_exec_mode( exec_mode )
+    , m_allocator_id( allocator_id )
+    , m_mesh( mesh )
+  {
+    m_bvh.setAllocatorID( allocator_id );
+  }
+
+  void build( const MeshData::Viewer& mesh ) override
+  {
+    m_mesh = mesh;
+    const IndexT num_faces = mesh.numberOfElements();
+    m_boxes = ArrayT<BoxT>(num_faces, num_faces, m_allocator_id);
+    buildMeshBBoxes(m_exec_mode, m_boxes, mesh);
+    m_bvh.initialize(m_boxes.view(), num_faces);
+  }
+
+  void findFacesInBoxes( IndexT num_boxes,
+                         const RealT* box_bounds,
+                         ArrayT<IndexT>& offsets,
+                         ArrayT<IndexT>& counts,
+                         ArrayT<IndexT>& face_ids ) const override
+  {
+    ArrayT<BoxT> query_boxes_data(num_boxes, num_boxes, m_allocator_id);
+    auto query_boxes = query_boxes_data.view();
+    forAllExec(m_exec_mode, num_boxes,
+      [query_boxes, box_bounds] TRIBOL_HOST_DEVICE (IndexT i) {
+        BoxT box;
+        box.addPoint( PointT(&box_bounds[2*D*i]) );
+        box.addPoint( PointT(&box_bounds[2*D*i + D]) );
+        query_boxes[i] = box;
+      }
+    );
+    findCandidates(query_boxes_data, offsets, counts, face_ids);
+  }
+
+  void findClosestPoints( IndexT num_points,
+                          const RealT* points,
+                          RealT max_distance,
+                          IndexT* face_ids,
+                          RealT* closest_points,
+                          RealT* distances ) const override
+  {
+    // the candidate faces of each point are those with bounding boxes 
+    // intersecting a box of half-width max_distance around the point
+    ArrayT<BoxT> query_boxes_data(num_points, num_points, m_allocator_id);
+    auto query_boxes = query_boxes_data.view();
+    forAllExec(m_exec_mode, num_points,
+      [query_boxes, points, max_distance] TRIBOL_HOST_DEVICE (IndexT i) {
+        BoxT box( PointT(&points[D*i]) );
+        box.expand(max_distance);
+        query_boxes[i] = box;
+      }
+    );
+    ArrayT<IndexT> offsets_data;
+    ArrayT<IndexT> counts_data;
+    ArrayT<IndexT> candidates_data;
+    findCandidates(query_boxes_data, offsets_data, counts_data, candidates_data);
+
+    auto offsets = offsets_data.view();
+    auto counts = counts_data.view();
+    auto candidates = candidates_data.view();
+    auto mesh = m_mesh;
+    forAllExec(m_exec_mode, num_points,
+      [mesh, offsets, counts, candidates, points, max_distance, face_ids,
+       closest_points, distances] TRIBOL_HOST_DEVICE (IndexT i) {
+        const PointT p( &points[D*i] );
+        IndexT closest_face = -1;
+        RealT closest_dist_sq = max_distance * max_distance;
+        PointT closest;
+        for (IndexT k{offsets[i]}; k < offsets[i] + counts[i]; ++k)
+        {
+          const IndexT face = candidates[k];
+          PointT face_closest = closestPointOnFace(mesh, face, p);
+          RealT dist_sq = primal::squared_distance(p, face_closest);
+          if (dist_sq <= closest_dist_sq)
+          {
+            closest_face = face;
+            closest_dist_sq = dist_sq;
+            closest = face_closest;
+          }
+        }
+        face_ids[i] = closest_face;
+        if (closest_face >= 0)
+        {
+          for (int d{0}; d < D; ++d)
+          {
+            closest_points[D*i + d] = closest[d];
+          }
+          distances[i] = sqrt(closest_dist_sq);
+        }
+      }
+    );
+  }
+
+private:
+  void findCandidates( const ArrayT<BoxT>& query_boxes,
+                       ArrayT<IndexT>& offsets,
+                       ArrayT<IndexT>& counts,
+                       ArrayT<IndexT>& candidates ) const
+  {
+    const IndexT num_boxes = query_boxes.size();
+    offsets = ArrayT<IndexT>(num_boxes, num_boxes, m_allocator_id);
+    counts = ArrayT<IndexT>(num_boxes, num_boxes, m_allocator_id);
+    candidates = ArrayT<IndexT>(0, 0, m_allocator_id);
+    m_bvh.findBoundingBoxes(offsets.view(), counts.view(), candidates, 
+                            num_boxes, query_boxes.view());
+  }
+
+  /*!
+   * \brief Closest point to p on a face. Edges are treated as segments and 
+   * quadrilaterals as pairs of triangles.
+   */
+  static TRIBOL_HOST_DEVICE PointT closestPointOnFace( const MeshData::Viewer& mesh, 
+                                                       IndexT face, 
+                                                       const PointT& p )
+  {
+    const IndexT num_nodes = mesh.numberOfNodesPerElement();
+    RealT xf[D * 4];
+    mesh.getFaceCoords(face, xf);
+    PointT v[4];
+    for (IndexT a{0}; a < num_nodes; ++a)
+    {
+      v[a] = PointT(&xf[D*a]);
+    }
+
+    if (num_nodes == 2)
+    {
+      // project onto the segment and clamp to its end points
+      RealT len_sq = 0.;
+      RealT proj = 0.;
+      for (int d{0}; d < D; ++d)
+      {
+        len_sq += (v[1][d] - v[0][d]) * (v[1][d] - v[0][d]);
+        proj += (p[d] - v[0][d]) * (v[1][d] - v[0][d]);
+      }
+      RealT t = (len_sq > 0.) ? axom::utilities::clampVal(proj / len_sq, 0., 1.) : 0.;
+      PointT q;
+      for (int d{0}; d < D; ++d)
+      {
+        q[d] = v[0][d] + t * (v[1][d] - v[0][d]);
+      }
+      return q;
+    }
+
+    PointT q = primal::closest_point(p, TriangleT(v[0], v[1], v[2]));
+    if (num_nodes == 4)
+    {
+      PointT q2 = primal::closest_point(p, TriangleT(v[0], v[2], v[3]));
+      if (primal::squared_distance(p, q2) < primal::squared_distance(p, q))
+      {
+        q = q2;
+      }
+    }
+    return q;
+  }
+
+  ExecutionMode m_exec_mode;
+  int m_allocator_id;
+  MeshData::Viewer m_mesh;
+  BVHT m_bvh;
+  ArrayT<BoxT> m_boxes;
+};
+
+/*!
+ * \brief Creates the hierarchy for the given dimension and execution mode
+ */
+template <int D>
+ProximityQueryImpl* newProximityQuery( ExecutionMode exec_mode, int allocator_id, 
+                                       const MeshData::Viewer& mesh )
+{
+  switch (exec_mode)
+  {
+    case ExecutionMode::Sequential:
+      return new BvhProximityQuery<D, axom::SEQ_EXEC>(exec_mode, allocator_id, mesh);
+#ifdef TRIBOL_USE_OPENMP
+    case ExecutionMode::OpenMP:
+      return new BvhProximityQuery<D, axom::OMP_EXEC>(exec_mode, allocator_id, mesh);
+#endif
+#ifdef TRIBOL_USE_CUDA
+    case ExecutionMode::Cuda:
+      return new BvhProximityQuery<D, axom::CUDA_EXEC<TRIBOL_BLOCK_SIZE>>(exec_mode, allocator_id, mesh);
+#endif
+#ifdef TRIBOL_USE_HIP
+    case ExecutionMode::Hip:
+      return new BvhProximityQuery<D, axom::HIP_EXEC<TRIBOL_BLOCK_SIZE>>(exec_mode, allocator_id, mesh);
+#endif
+    default:
+      SLIC_ERROR_ROOT("tribol::ProximityQuery: invalid execution mode.");
+      return nullptr;
+  }
+}
+
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+ProximityQuery::ProximityQuery( IndexT mesh_id, ExecutionMode exec_mode )
+  : m_mesh_id( mesh_id )
+  , m_exec_mode( exec_mode )
+{
+  auto& mesh = MeshManager::getInstance().getData( mesh_id );
+  m_allocator_id = mesh.getAllocatorId();
+
+  // deduce the execution mode from the memory space of the mesh
+  if (m_exec_mode == ExecutionMode::Dynamic)
+  {
+    m_exec_mode = ExecutionMode::Sequential;
+#ifdef TRIBOL_USE_UMPIRE
+    if (mesh.getMemorySpace() == MemorySpace::Device || 
+        mesh.getMemorySpace() == MemorySpace::Unified)
+    {
+  #if defined(TRIBOL_USE_CUDA)
+      m_exec_mode = ExecutionMode::Cuda;
+  #elif defined(TRIBOL_USE_HIP)
+      m_exec_mode = ExecutionMode::Hip;
+  #endif
+    }
+#endif
+  }
+
+  switch (mesh.spatialDimension())
+  {
+    case 2:
+      m_impl.reset( newProximityQuery<2>(m_exec_mode, m_allocator_id, mesh.getView()) );
+      break;
+    case 3:
+      m_impl.reset( newProximityQuery<3>(m_exec_mode, m_allocator_id, mesh.getView()) );
+      break;
+    default:
+      SLIC_ERROR_ROOT("tribol::ProximityQuery: invalid dimension: " << mesh.spatialDimension());
+      break;
+  }
+
+  update();
+}
+
+//------------------------------------------------------------------------------
+ProximityQuery::~ProximityQuery() = default;
+
+//------------------------------------------------------------------------------
+void ProximityQuery::update()
+{
+  auto& mesh = MeshManager::getInstance().getData( m_mesh_id );
+  // the face boxes are expanded along the face normals
+  mesh.computeFaceData( m_exec_mode );
+  m_impl->build( mesh.getView() );
+}
+
+//------------------------------------------------------------------------------
+void ProximityQuery::findFacesInBoxes( IndexT num_boxes,
+                                       const RealT* box_bounds,
+                                       ArrayT<IndexT>& offsets,
+                                       ArrayT<IndexT>& counts,
+                                       ArrayT<IndexT>& face_ids ) const
+{
+  m_impl->findFacesInBoxes( num_boxes, box_bounds, offsets, counts, face_ids );
+}
+
+//------------------------------------------------------------------------------
+void ProximityQuery::findClosestPoints( IndexT num_points,
+                                        const RealT* points,
+                                        RealT max_distance,
+                                        IndexT* face_ids,
+                                        RealT* closest_points,
+                                        RealT* distances ) const
+{
+  m_impl->findClosestPoints( num_points, points, max_distance, face_ids, 
+                             closest_points, distances );
+}
+
+} // end namespace tribol
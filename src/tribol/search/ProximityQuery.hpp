@@ -0,0 +1,119 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_SEARCH_PROXIMITYQUERY_HPP_
+#define SRC_SEARCH_PROXIMITYQUERY_HPP_
+
+#include "tribol/common/ArrayTypes.hpp"
+#include "tribol/common/BasicTypes.hpp"
+#include "tribol/common/ExecModel.hpp"
+
+// C/C++ includes
+#include <memory>
+
+namespace tribol
+{
+
+// forward declarations
+class ProximityQueryImpl;
+
+/*!
+ * \class ProximityQuery
+ *
+ * \brief Batched proximity queries against the faces of a registered mesh
+ *
+ * A ProximityQuery builds a bounding volume hierarchy (axom::spin::BVH) over
+ * the face bounding boxes of a registered mesh. The boxes are those of the 
+ * BINNING_BVH search, i.e. expanded by the face radius along the face normal
+ * (see buildMeshBBoxes()). The hierarchy persists between queries and is 
+ * rebuilt over the current nodal coordinates by update(), which also 
+ * recomputes the face data of the mesh. Queries run under the execution mode of the
+ * ProximityQuery, so query input and output arrays must be accessible in that
+ * execution mode.
+ */
+class ProximityQuery
+{
+public:
+  /*!
+   * \brief Builds the hierarchy over the faces of a registered mesh
+   *
+   * \param [in] mesh_id id of a registered mesh
+   * \param [in] exec_mode execution mode of the queries. If Dynamic, the 
+   * execution mode is deduced from the memory space of the mesh.
+   */
+  ProximityQuery( IndexT mesh_id, ExecutionMode exec_mode = ExecutionMode::Dynamic );
+
+  ~ProximityQuery();
+
+  ProximityQuery(const ProximityQuery& other) = delete;
+  ProximityQuery& operator=(const ProximityQuery& other) = delete;
+
+  /*!
+   * \brief Recomputes the face data of the mesh and rebuilds the hierarchy
+   * over the current nodal coordinates
+   */
+  void update();
+
+  /*!
+   * \brief Get the execution mode of the queries
+   */
+  ExecutionMode getExecutionMode() const { return m_exec_mode; }
+
+  /*!
+   * \brief Get the allocator id of the query output arrays
+   */
+  int getAllocatorId() const { return m_allocator_id; }
+
+  /*!
+   * \brief Finds the faces with bounding boxes intersecting each query box
+   *
+   * \param [in] num_boxes number of query boxes
+   * \param [in] box_bounds lower then upper corner of each box, i.e. 
+   * 2 * dim values per box
+   * \param [out] offsets offset of the face ids of each box in face_ids
+   * \param [out] counts number of face ids of each box
+   * \param [out] face_ids ids of the faces intersecting the boxes
+   */
+  void findFacesInBoxes( IndexT num_boxes,
+                         const RealT* box_bounds,
+                         ArrayT<IndexT>& offsets,
+                         ArrayT<IndexT>& counts,
+                         ArrayT<IndexT>& face_ids ) const;
+
+  /*!
+   * \brief Finds the closest point on the mesh surface to each query point
+   *
+   * \param [in] num_points number of query points
+   * \param [in] points coordinates of each point, i.e. dim values per point
+   * \param [in] max_distance faces further than max_distance from a query 
+   * point are ignored
+   * \param [out] face_ids id of the face containing the closest point; -1 if 
+   * no face lies within max_distance of the query point
+   * \param [out] closest_points coordinates of the closest point (dim values
+   * per point). Not set if the face id is -1.
+   * \param [out] distances distance to the closest point. Not set if the face 
+   * id is -1.
+   *
+   * \note Quadrilateral faces are split into two triangles along the diagonal 
+   * between their first and third nodes.
+   */
+  void findClosestPoints( IndexT num_points,
+                          const RealT* points,
+                          RealT max_distance,
+                          IndexT* face_ids,
+                          RealT* closest_points,
+                          RealT* distances ) const;
+
+private:
+  IndexT m_mesh_id;          ///< Id of the queried mesh
+  ExecutionMode m_exec_mode; ///< Execution mode of the queries
+  int m_allocator_id;        ///< Allocator id of query arrays
+
+  std::unique_ptr<ProximityQueryImpl> m_impl; ///< Hierarchy templated on dimension and execution space
+};
+
+} // end namespace tribol
+
+#endif /* SRC_SEARCH_PROXIMITYQUERY_HPP_ */
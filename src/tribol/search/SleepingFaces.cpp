@@ -0,0 +1,226 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#include "SleepingFaces.hpp"
+
+#include "tribol/common/ExecModel.hpp"
+#include "tribol/common/LoopExec.hpp"
+#include "tribol/mesh/CouplingScheme.hpp"
+#include "tribol/mesh/MeshData.hpp"
+#include "tribol/search/FaceBoxes.hpp"
+
+#include "axom/slic.hpp"
+
+namespace tribol
+{
+
+namespace
+{
+
+/*!
+ * \brief Returns the largest change of a bound of the bounding box of a face
+ *        from its reference box
+ *
+ * The box is the normal-expanded box of the BVH search (see computeFaceBBox()),
+ * so changes in the face normal and radius are accounted for.
+ */
+template <int D>
+TRIBOL_HOST_DEVICE inline RealT faceBoxMotion( const MeshData::Viewer& mesh,
+                                               const RealT* ref,
+                                               IndexT face_id )
+{
+   const auto box = computeFaceBBox<D>(mesh, face_id);
+   const RealT* ref_box = &ref[2 * D * face_id];
+   RealT motion = 0.;
+   for (int d{0}; d < D; ++d)
+   {
+      motion = axom::utilities::max(motion, 
+         axom::utilities::abs(box.getMin()[d] - ref_box[d]));
+      motion = axom::utilities::max(motion, 
+         axom::utilities::abs(box.getMax()[d] - ref_box[D + d]));
+   }
+   return motion;
+}
+
+TRIBOL_HOST_DEVICE inline RealT faceBoxMotion( const MeshData::Viewer& mesh,
+                                               const RealT* ref,
+                                               IndexT face_id )
+{
+   return (mesh.spatialDimension() == 3) ? faceBoxMotion<3>(mesh, ref, face_id)
+                                         : faceBoxMotion<2>(mesh, ref, face_id);
+}
+
+/*!
+ * \brief Copies the current bounding box of each face of a mesh to a 
+ *        face-major reference array ([lo_0, ..., lo_D-1, hi_0, ..., hi_D-1])
+ */
+template <int D>
+void recordBoxes( ExecutionMode exec_mode, int allocator_id,
+                  const MeshData::Viewer& mesh, ArrayT<RealT>& ref )
+{
+   const IndexT num_faces = mesh.numberOfElements();
+   ref = ArrayT<RealT>(2 * D * num_faces, 2 * D * num_faces, allocator_id);
+   ArrayViewT<RealT> ref_view = ref;
+   forAllExec(exec_mode, num_faces,
+      [mesh, ref_view] TRIBOL_HOST_DEVICE (IndexT f)
+      {
+         const auto box = computeFaceBBox<D>(mesh, f);
+         for (int d{0}; d < D; ++d)
+         {
+            ref_view[2 * D * f + d] = box.getMin()[d];
+            ref_view[2 * D * f + D + d] = box.getMax()[d];
+         }
+      }
+   );
+}
+
+void recordBoxes( ExecutionMode exec_mode, int allocator_id,
+                  const MeshData::Viewer& mesh, ArrayT<RealT>& ref )
+{
+   if (mesh.spatialDimension() == 3)
+   {
+      recordBoxes<3>( exec_mode, allocator_id, mesh, ref );
+   }
+   else
+   {
+      recordBoxes<2>( exec_mode, allocator_id, mesh, ref );
+   }
+}
+
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+bool useSleepingFaces( const CouplingScheme& cs )
+{
+   return cs.getParameters().sleeping_face_margin > 0.;
+}
+
+//------------------------------------------------------------------------------
+ArrayT<IndexT> wakeSleepingFaces( CouplingScheme& cs )
+{
+   auto& data = cs.getSleepingFaceData();
+   const auto mesh1 = cs.getMesh1().getView();
+   const auto mesh2 = cs.getMesh2().getView();
+   const auto exec_mode = cs.getExecutionMode();
+   const int allocator_id = cs.getAllocatorId();
+   const RealT margin = cs.getParameters().sleeping_face_margin;
+   const IndexT num_faces1 = mesh1.numberOfElements();
+   const IndexT num_faces2 = mesh2.numberOfElements();
+
+   // start a new epoch once every face is awake (or the meshes changed)
+   if ( !data.m_has_epoch || data.m_num_sleeping == 0 ||
+        data.m_slack.size() != num_faces2 ||
+        data.m_ref_boxes1.size() != 2 * mesh1.spatialDimension() * num_faces1 ||
+        data.m_ref_boxes2.size() != 2 * mesh2.spatialDimension() * num_faces2 )
+   {
+      recordBoxes( exec_mode, allocator_id, mesh1, data.m_ref_boxes1 );
+      recordBoxes( exec_mode, allocator_id, mesh2, data.m_ref_boxes2 );
+      data.m_slack = ArrayT<RealT>(num_faces2, num_faces2, allocator_id);
+      data.m_slack.fill(-1.);
+      data.m_has_epoch = true;
+      data.m_num_sleeping = 0;
+      ++data.m_num_epochs;
+   }
+
+   // largest mesh 1 face box motion in the epoch
+   ArrayT<RealT> max_disp1_data({0.}, allocator_id);
+   ArrayViewT<RealT> max_disp1 = max_disp1_data;
+   const RealT* ref1 = data.m_ref_boxes1.data();
+   forAllExec(exec_mode, num_faces1,
+      [mesh1, ref1, max_disp1] TRIBOL_HOST_DEVICE (IndexT f)
+      {
+         const RealT disp = faceBoxMotion(mesh1, ref1, f);
+#ifdef TRIBOL_USE_RAJA
+         RAJA::atomicMax<RAJA::auto_atomic>(&max_disp1[0], disp);
+#else
+         max_disp1[0] = axom::utilities::max(max_disp1[0], disp);
+#endif
+      }
+   );
+   ArrayT<RealT, 1, MemorySpace::Host> max_disp1_host(max_disp1_data);
+   data.m_max_disp1 = max_disp1_host[0];
+
+   // wake faces whose motion bound reaches the margin and list the awake faces
+   data.m_face_disp2 = ArrayT<RealT>(num_faces2, num_faces2, allocator_id);
+   ArrayViewT<RealT> face_disp2 = data.m_face_disp2;
+   ArrayViewT<RealT> slack = data.m_slack;
+   ArrayT<IndexT> awake_faces(num_faces2, num_faces2, allocator_id);
+   ArrayViewT<IndexT> awake_view = awake_faces;
+   ArrayT<IndexT> num_awake_data({0}, allocator_id);
+   ArrayViewT<IndexT> num_awake = num_awake_data;
+   const RealT* ref2 = data.m_ref_boxes2.data();
+   const RealT disp1 = data.m_max_disp1;
+   forAllExec(exec_mode, num_faces2,
+      [mesh2, ref2, face_disp2, slack, awake_view, num_awake, disp1, margin]
+      TRIBOL_HOST_DEVICE (IndexT f)
+      {
+         const RealT disp2 = faceBoxMotion(mesh2, ref2, f);
+         face_disp2[f] = disp2;
+
+         if (slack[f] >= 0. && slack[f] + disp1 + disp2 >= margin)
+         {
+            slack[f] = -1.;
+         }
+         if (slack[f] < 0.)
+         {
+#ifdef TRIBOL_USE_RAJA
+            auto idx = RAJA::atomicInc<RAJA::auto_atomic>(num_awake.data());
+#else
+            auto idx = num_awake[0];
+            ++num_awake[0];
+#endif
+            awake_view[idx] = f;
+         }
+      }
+   );
+
+   ArrayT<IndexT, 1, MemorySpace::Host> num_awake_host(num_awake_data);
+   awake_faces.resize(num_awake_host[0]);
+   data.m_num_queried = num_awake_host[0];
+   data.m_num_sleeping = num_faces2 - num_awake_host[0];
+
+   return awake_faces;
+
+} // end wakeSleepingFaces()
+
+//------------------------------------------------------------------------------
+void sleepIsolatedFaces( CouplingScheme& cs,
+                         ArrayViewT<const IndexT> awake_faces,
+                         IndexT first,
+                         ArrayViewT<const IndexT> counts )
+{
+   auto& data = cs.getSleepingFaceData();
+   const RealT margin = cs.getParameters().sleeping_face_margin;
+   const RealT disp1 = data.m_max_disp1;
+   ArrayViewT<RealT> slack = data.m_slack;
+   ArrayViewT<const RealT> face_disp2 = data.m_face_disp2;
+
+   ArrayT<IndexT> num_asleep_data({0}, cs.getAllocatorId());
+   ArrayViewT<IndexT> num_asleep = num_asleep_data;
+   forAllExec(cs.getExecutionMode(), counts.size(),
+      [awake_faces, first, counts, slack, face_disp2, num_asleep, disp1, margin]
+      TRIBOL_HOST_DEVICE (IndexT q)
+      {
+         const IndexT f = awake_faces[first + q];
+         const RealT bound = disp1 + face_disp2[f];
+         // faces that already used up most of the margin would wake at once
+         if (counts[q] == 0 && bound < margin)
+         {
+            slack[f] = bound;
+#ifdef TRIBOL_USE_RAJA
+            RAJA::atomicInc<RAJA::auto_atomic>(num_asleep.data());
+#else
+            ++num_asleep[0];
+#endif
+         }
+      }
+   );
+
+   ArrayT<IndexT, 1, MemorySpace::Host> num_asleep_host(num_asleep_data);
+   data.m_num_sleeping += num_asleep_host[0];
+
+} // end sleepIsolatedFaces()
+
+} // end namespace tribol
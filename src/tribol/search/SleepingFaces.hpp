@@ -0,0 +1,82 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_SEARCH_SLEEPINGFACES_HPP_
+#define SRC_SEARCH_SLEEPINGFACES_HPP_
+
+#include "tribol/common/ArrayTypes.hpp"
+#include "tribol/common/BasicTypes.hpp"
+
+namespace tribol
+{
+
+// Forward Declarations
+class CouplingScheme;
+
+/**
+ * @brief State of the mesh 2 faces skipped by the BVH search
+ *
+ * A mesh 2 face whose bounding box, inflated by the sleeping_face_margin
+ * parameter, overlaps no mesh 1 box falls asleep and is not queried by later
+ * searches. The motion of a face is the largest change of a bound of its 
+ * bounding box (expanded along the face normal, as in the search) from the box
+ * recorded at the start of an epoch, so rotation, shear, and changes of the 
+ * face radius are included. When a face falls asleep, its slack is set to the
+ * motion bound at that time (its own motion plus the largest mesh 1 face 
+ * motion). The face stays asleep while its slack plus the current motion bound
+ * is below the margin, i.e. while no mesh 1 box can have reached its 
+ * (un-inflated) box. A new epoch starts when no face is asleep.
+ */
+struct SleepingFaceData
+{
+public:
+   ArrayT<RealT> m_ref_boxes1; ///< Mesh 1 face boxes at the start of the epoch (face-major lower, upper corners)
+   ArrayT<RealT> m_ref_boxes2; ///< Mesh 2 face boxes at the start of the epoch (face-major lower, upper corners)
+   ArrayT<RealT> m_slack;      ///< Motion bound of each mesh 2 face when it fell asleep; negative if awake
+   ArrayT<RealT> m_face_disp2; ///< Box motion of each mesh 2 face in the epoch (current search)
+
+   RealT m_max_disp1 {0.};    ///< Largest mesh 1 face box motion in the epoch (current search)
+
+   bool m_has_epoch {false};  ///< True once reference positions are recorded
+   IndexT m_num_sleeping {0}; ///< Number of mesh 2 faces asleep after the last search
+   IndexT m_num_queried {0};  ///< Number of mesh 2 faces queried by the last search
+   int m_num_epochs {0};      ///< Number of epochs started
+};
+
+/**
+ * @brief Returns true if the coupling scheme skips sleeping faces in the search
+ *
+ * @param [in] cs coupling scheme
+ */
+bool useSleepingFaces( const CouplingScheme& cs );
+
+/**
+ * @brief Wakes the mesh 2 faces that may have come within reach of mesh 1 and
+ *        returns the ids of the faces to query
+ *
+ * Starts a new epoch if no face is asleep or the mesh sizes changed.
+ *
+ * @param [in,out] cs coupling scheme
+ *
+ * @return array of awake mesh 2 face ids in the coupling scheme's memory space
+ */
+ArrayT<IndexT> wakeSleepingFaces( CouplingScheme& cs );
+
+/**
+ * @brief Puts to sleep the queried faces that had no candidates
+ *
+ * @param [in,out] cs coupling scheme
+ * @param [in] awake_faces mesh 2 face ids returned by wakeSleepingFaces()
+ * @param [in] first index in awake_faces of the first queried face
+ * @param [in] counts number of candidates of each queried face (inflated boxes)
+ */
+void sleepIsolatedFaces( CouplingScheme& cs,
+                         ArrayViewT<const IndexT> awake_faces,
+                         IndexT first,
+                         ArrayViewT<const IndexT> counts );
+
+} // end namespace tribol
+
+#endif /* SRC_SEARCH_SLEEPINGFACES_HPP_ */
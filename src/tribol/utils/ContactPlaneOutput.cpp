@@ -143,25 +143,46 @@ void WriteContactPlaneMeshToVtk( const std::string& dir, const VisType v_type,
          {
             auto& cp = couplingScheme->getContactPlane(i);
             // if interpenOverlap, print interpenetrating portions of each face.
-            if (cp.m_interpenOverlap)
+            if (cp.m_interpenOverlap && dim == 3)
             {
-               for (int j=0; j<cp.m_numInterpenPoly1Vert; ++j)
+               auto& cp3 = static_cast<const ContactPlane3D&>(cp);
+               for (int j=0; j<cp3.m_numInterpenPoly1Vert; ++j)
                {
                   axom::fmt::print(faces, "{} {} {}\n",
-                     cp.m_interpenG1X[j],
-                     cp.m_interpenG1Y[j],
-                     dim==3 ? cp.m_interpenG1Z[j] : 0.);
+                     cp3.m_interpenG1X[j],
+                     cp3.m_interpenG1Y[j],
+                     cp3.m_interpenG1Z[j]);
                }
 
-               for (int j=0; j<cp.m_numInterpenPoly2Vert; ++j)
+               for (int j=0; j<cp3.m_numInterpenPoly2Vert; ++j)
                {
                   axom::fmt::print(faces, "{} {} {}\n",
-                     cp.m_interpenG2X[j],
-                     cp.m_interpenG2Y[j],
-                     dim==3 ? cp.m_interpenG2Z[j] : 0.);
+                     cp3.m_interpenG2X[j],
+                     cp3.m_interpenG2Y[j],
+                     cp3.m_interpenG2Z[j]);
                }
             } // end if-cpMrg.m_interpenOverlap[i]
 
+            else if (cp.m_interpenOverlap)
+            {
+               auto& cp2 = static_cast<const ContactPlane2D&>(cp);
+               for (int j=0; j<cp2.m_numInterpenPoly1Vert; ++j)
+               {
+                  axom::fmt::print(faces, "{} {} {}\n",
+                     cp2.m_interpenG1X[j],
+                     cp2.m_interpenG1Y[j],
+                     0.);
+               }
+
+               for (int j=0; j<cp2.m_numInterpenPoly2Vert; ++j)
+               {
+                  axom::fmt::print(faces, "{} {} {}\n",
+                     cp2.m_interpenG2X[j],
+                     cp2.m_interpenG2Y[j],
+                     0.);
+               }
+            } // end if-2D interpen overlap
+
             else // print the current configuration faces
             {
                for (int j=0; j<mesh1.numberOfNodesPerElement(); ++j)
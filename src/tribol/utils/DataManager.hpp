@@ -19,26 +19,60 @@
 namespace tribol
 {
 
+/**
+ * @brief Registry of data (meshes, coupling schemes) keyed by an integer id
+ *
+ * Each Context owns one DataManager per data type. getInstance() returns the
+ * DataManager of the calling thread's current context, which is the default 
+ * (process-wide) DataManager unless a ContextScope is active on the thread.
+ */
 template <typename T>
 class DataManager
 {
 public:
+  DataManager() = default;
+  ~DataManager() = default;
+
   DataManager(const DataManager& other) = delete;
   DataManager(DataManager&& other) = delete;
   void operator=(const DataManager& other) = delete;
   void operator=(DataManager&& other) = delete;
 
   /**
-   * @brief Return the instance of the DataManager singleton
+   * @brief Return the DataManager of the current context of the calling thread
    * 
    * @return Reference to the DataManager
    */
   static DataManager& getInstance()
+  {
+    return current_ ? *current_ : getDefaultInstance();
+  }
+
+  /**
+   * @brief Return the DataManager of the default context
+   * 
+   * @return Reference to the DataManager
+   */
+  static DataManager& getDefaultInstance()
   {
     static DataManager instance_;
     return instance_;
   }
 
+  /**
+   * @brief Sets the DataManager returned by getInstance() on the calling thread
+   *
+   * @param [in] data_manager DataManager to use; nullptr selects the default instance
+   * 
+   * @return Pointer to the previously set DataManager (nullptr if default)
+   */
+  static DataManager* setCurrentInstance(DataManager* data_manager)
+  {
+    DataManager* prev = current_;
+    current_ = data_manager;
+    return prev;
+  }
+
   /**
    * @brief Returns the element at id
    * 
@@ -151,8 +185,10 @@ public:
   }
 
 private:
-  DataManager() = default;
-  ~DataManager() = default;
+  /**
+   * @brief DataManager of the current context on this thread (nullptr if default)
+   */
+  static thread_local DataManager* current_;
 
   /**
    * @brief Map holding elements with an integer key
@@ -160,6 +196,9 @@ private:
   std::unordered_map<IndexT, T> data_map_;
 };
 
+template <typename T>
+thread_local DataManager<T>* DataManager<T>::current_ = nullptr;
+
 } // end namespace tribol
 
 #endif /* SRC_UTILS_DATAMANAGER_HPP_ */
@@ -0,0 +1,84 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#include "LoadBalance.hpp"
+
+#include "tribol/mesh/CouplingScheme.hpp"
+
+#include "axom/slic.hpp"
+
+namespace tribol
+{
+
+//------------------------------------------------------------------------------
+void computeLoadBalance( CouplingScheme& cs, int cycle )
+{
+   auto& data = cs.getLoadBalanceData();
+
+   double sum[NUM_LB_QUANTITIES];
+   int num_ranks = 1;
+
+#ifdef TRIBOL_USE_MPI
+   CommT comm = cs.getParameters().problem_comm;
+   MPI_Comm_size( comm, &num_ranks );
+
+   MPI_Allreduce( data.m_local, sum, NUM_LB_QUANTITIES, MPI_DOUBLE, MPI_SUM, comm );
+
+   // the maximum and its rank
+   struct { double value; int rank; } local_max[NUM_LB_QUANTITIES], global_max[NUM_LB_QUANTITIES];
+   int rank = 0;
+   MPI_Comm_rank( comm, &rank );
+   for (int i{0}; i < NUM_LB_QUANTITIES; ++i)
+   {
+      local_max[i].value = data.m_local[i];
+      local_max[i].rank = rank;
+   }
+   MPI_Allreduce( local_max, global_max, NUM_LB_QUANTITIES, MPI_DOUBLE_INT, MPI_MAXLOC, comm );
+   for (int i{0}; i < NUM_LB_QUANTITIES; ++i)
+   {
+      data.m_max[i] = global_max[i].value;
+      data.m_max_rank[i] = global_max[i].rank;
+   }
+#else
+   for (int i{0}; i < NUM_LB_QUANTITIES; ++i)
+   {
+      sum[i] = data.m_local[i];
+      data.m_max[i] = data.m_local[i];
+      data.m_max_rank[i] = 0;
+   }
+#endif
+
+   for (int i{0}; i < NUM_LB_QUANTITIES; ++i)
+   {
+      data.m_avg[i] = sum[i] / num_ranks;
+      data.m_imbalance[i] = (data.m_avg[i] > 0.) ? data.m_max[i] / data.m_avg[i] : 1.;
+      SLIC_INFO_ROOT("Coupling scheme " << cs.getId() << " cycle " << cycle << ": " <<
+                     getLoadBalanceQuantityName( static_cast<LoadBalanceQuantity>(i) ) <<
+                     " max/avg = " << data.m_imbalance[i] << " (max " << data.m_max[i] << 
+                     " on rank " << data.m_max_rank[i] << ", avg " << data.m_avg[i] << ").");
+   }
+   ++data.m_num_reports;
+
+} // end computeLoadBalance()
+
+//------------------------------------------------------------------------------
+const char* getLoadBalanceQuantityName( LoadBalanceQuantity quantity )
+{
+   switch (quantity)
+   {
+      case LB_CANDIDATE_PAIRS:
+         return "candidate pairs";
+      case LB_ACTIVE_PAIRS:
+         return "active pairs";
+      case LB_GEOMETRY_TIME:
+         return "geometry time";
+      case LB_ENFORCEMENT_TIME:
+         return "enforcement time";
+      default:
+         return "unknown";
+   }
+} // end getLoadBalanceQuantityName()
+
+} // end namespace tribol
@@ -0,0 +1,94 @@
+// Copyright (c) 2017-2023, Lawrence Livermore National Security, LLC and
+// other Tribol Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (MIT)
+
+#ifndef SRC_UTILS_LOADBALANCE_HPP_
+#define SRC_UTILS_LOADBALANCE_HPP_
+
+#include "tribol/common/BasicTypes.hpp"
+
+namespace tribol
+{
+
+// Forward Declarations
+class CouplingScheme;
+
+/**
+ * @brief Enumerates the per-rank contact work measures of a coupling scheme
+ */
+enum LoadBalanceQuantity
+{
+   LB_CANDIDATE_PAIRS,   ///! Number of interface pairs from binning
+   LB_ACTIVE_PAIRS,      ///! Number of contact planes (active pairs)
+   LB_GEOMETRY_TIME,     ///! Wall time (seconds) of the contact plane computation
+   LB_ENFORCEMENT_TIME,  ///! Wall time (seconds) of the interface physics
+   NUM_LB_QUANTITIES
+};
+
+/**
+ * @brief Per-rank contact work of a coupling scheme and its distribution 
+ *        across ranks
+ *
+ * The local values are recorded on every call to apply() and are zero if the
+ * coupling scheme was skipped on this rank. The cross-rank statistics are 
+ * updated by the collective computeLoadBalance(), which tribol::update() runs
+ * every load_balance_interval cycles for every registered coupling scheme.
+ */
+struct LoadBalanceData
+{
+public:
+
+   LoadBalanceData()
+   {
+      clearLocal();
+      for (int i{0}; i < NUM_LB_QUANTITIES; ++i)
+      {
+         m_max[i] = 0.;
+         m_avg[i] = 0.;
+         m_imbalance[i] = 1.;
+         m_max_rank[i] = 0;
+      }
+   }
+
+   /// Zeros the work on this rank
+   void clearLocal()
+   {
+      for (int i{0}; i < NUM_LB_QUANTITIES; ++i)
+      {
+         m_local[i] = 0.;
+      }
+   }
+
+   double m_local[NUM_LB_QUANTITIES];     ///< Work on this rank in the last apply()
+   double m_max[NUM_LB_QUANTITIES];       ///< Maximum work over all ranks
+   double m_avg[NUM_LB_QUANTITIES];       ///< Average work over all ranks
+   double m_imbalance[NUM_LB_QUANTITIES]; ///< Ratio of maximum to average work (1 if no work)
+   int m_max_rank[NUM_LB_QUANTITIES];     ///< Rank with the maximum work
+
+   int m_num_reports {0}; ///< Number of times the statistics have been computed
+};
+
+/**
+ * @brief Gathers the per-rank work of a coupling scheme and computes the 
+ *        imbalance ratios and the most loaded ranks
+ *
+ * The statistics are stored in the coupling scheme's LoadBalanceData and 
+ * logged on the root rank. This requires two small reductions over the
+ * coupling scheme's communicator.
+ *
+ * @param [in,out] cs coupling scheme
+ * @param [in] cycle current cycle (for logging)
+ *
+ * @note This routine is collective and must be called on all ranks.
+ */
+void computeLoadBalance( CouplingScheme& cs, int cycle );
+
+/**
+ * @brief Returns the name of a load balance quantity, e.g. "active pairs"
+ */
+const char* getLoadBalanceQuantityName( LoadBalanceQuantity quantity );
+
+} // end namespace tribol
+
+#endif /* SRC_UTILS_LOADBALANCE_HPP_ */
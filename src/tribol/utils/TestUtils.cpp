@@ -1184,7 +1184,7 @@ int TestMesh::tribolSetupAndUpdate( ContactMethod method,
 
    setLoggingLevel(csIndex, TRIBOL_WARNING);
 
-   if (method == COMMON_PLANE && enforcement == PENALTY)
+   if ((method == COMMON_PLANE || method == NODE_TO_SURFACE) && enforcement == PENALTY)
    {
       PenaltyConstraintType constraint_type = (params.constant_rate_penalty || params.percent_rate_penalty) 
                                             ? KINEMATIC_AND_RATE : KINEMATIC; 
@@ -1230,6 +1230,39 @@ int TestMesh::tribolSetupAndUpdate( ContactMethod method,
    return err;
 
 } // end tribolSetupAndUpdate()
+
+//------------------------------------------------------------------------------
+int TestMesh::setupPenaltyBlocksAndUpdate( ContactMethod method,
+                                           int numElemsXY2,
+                                           RealT xMin2, RealT xMax2, RealT yMax2 )
+{
+   this->mortarMeshId = 0;
+   this->nonmortarMeshId = 1;
+
+   this->setupContactMeshHex( 4, 4, 4, 0., 0., 0., 1., 1., 1.005,
+                              numElemsXY2, numElemsXY2, 5, xMin2, 0., 0.95, 
+                              xMax2, yMax2, 2.,
+                              0., 0. );
+
+   TestControlParameters parameters;
+   parameters.penalty_ratio = false;
+   parameters.const_penalty = 0.75;
+   parameters.dt = 1.;
+
+   return this->tribolSetupAndUpdate( method, PENALTY, FRICTIONLESS, NO_CASE,
+                                      false, parameters );
+
+} // end setupPenaltyBlocksAndUpdate()
+
+//------------------------------------------------------------------------------
+void TestMesh::zeroForces()
+{
+   for (int n{0}; n < this->numTotalNodes; ++n)
+   {
+      this->fx1[n] = 0.; this->fy1[n] = 0.; this->fz1[n] = 0.;
+      this->fx2[n] = 0.; this->fy2[n] = 0.; this->fz2[n] = 0.;
+   }
+} // end TestMesh::zeroForces()
       
 //------------------------------------------------------------------------------
 void TestMesh::setupPatchTestDirichletBCs( IndexT mesh_id, 
@@ -110,6 +110,29 @@ public:
                                    TestControlParameters & params  ///< control parameters struct
                                  );
 
+  /*!
+   * \brief sets up two interpenetrating hex blocks and calls tribolSetupAndUpdate() 
+   *        with a frictionless, constant penalty
+   *
+   * The first block has 4x4x4 elements on [0,1] x [0,1] x [0,1.005]. The second 
+   * block has numElemsXY2 x numElemsXY2 x 5 elements on [xMin2,xMax2] x [0,yMax2] 
+   * x [0.95,2], giving a uniform interpenetration of 0.055 where the blocks overlap.
+   *
+   * \param [in] method contact method
+   * \param [in] numElemsXY2 number of elements in the x- and y-directions for second block
+   * \param [in] xMin2 minimum x-coordinate location of second block
+   * \param [in] xMax2 maximum x-coordinate location of second block
+   * \param [in] yMax2 maximum y-coordinate location of second block
+   *
+   * \return error code returned by tribolSetupAndUpdate()
+   */
+   int setupPenaltyBlocksAndUpdate( ContactMethod method = COMMON_PLANE,
+                                    int numElemsXY2 = 5,
+                                    RealT xMin2 = 0., RealT xMax2 = 1., RealT yMax2 = 1. );
+
+   /// zeros the nodal force arrays of both blocks
+   void zeroForces();
+
   /*!
    * \brief setups of a 3D contact hex mesh consisting of two blocks
    *